@@ -34,6 +34,13 @@ AC_DEFUN([AX_EVTXTOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  dnl Headers and functions used in evtxtools/evtxtools_prefetch.c
+  AC_CHECK_HEADERS([errno.h fcntl.h])
+
+  AC_CHECK_FUNCS([open])
+
+  AX_LIBCFILE_CHECK_FUNC_POSIX_FADVISE
+
   dnl Headers included in evtxtools/log_handle.c
   AC_CHECK_HEADERS([stdarg.h varargs.h])
 
@@ -0,0 +1,349 @@
+/*
+ * Checkpoint file
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "checkpoint_file.h"
+#include "evtxtools_libcerror.h"
+
+/* The checkpoint file signature
+ */
+const uint8_t *checkpoint_file_signature = (uint8_t *) "EVTXCKPT";
+
+/* Creates a checkpoint file
+ * Make sure the value checkpoint_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_initialize(
+     checkpoint_file_t **checkpoint_file,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_file_initialize";
+
+	if( checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid checkpoint file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*checkpoint_file = memory_allocate_structure(
+	                    checkpoint_file_t );
+
+	if( *checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *checkpoint_file,
+	     0,
+	     sizeof( checkpoint_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear checkpoint file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *checkpoint_file != NULL )
+	{
+		memory_free(
+		 *checkpoint_file );
+
+		*checkpoint_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_free(
+     checkpoint_file_t **checkpoint_file,
+     libcerror_error_t **error )
+{
+	static char *function = "checkpoint_file_free";
+
+	if( checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *checkpoint_file != NULL )
+	{
+		memory_free(
+		 *checkpoint_file );
+
+		*checkpoint_file = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads a checkpoint file
+ * Returns 1 if successful, 0 if the file could not be opened or -1 on error
+ */
+int checkpoint_file_read(
+     checkpoint_file_t *checkpoint_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t data[ CHECKPOINT_FILE_DATA_SIZE ];
+
+	FILE *stream          = NULL;
+	static char *function = "checkpoint_file_read";
+	size_t read_count     = 0;
+
+	if( checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_READ ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_READ );
+#endif
+	if( stream == NULL )
+	{
+		return( 0 );
+	}
+	read_count = file_stream_read(
+	              stream,
+	              data,
+	              CHECKPOINT_FILE_DATA_SIZE );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_count != (size_t) CHECKPOINT_FILE_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     data,
+	     checkpoint_file_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported checkpoint file signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 checkpoint_file->record_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 checkpoint_file->written_time );
+
+	return( 1 );
+}
+
+/* Writes a checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int checkpoint_file_write(
+     checkpoint_file_t *checkpoint_file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	uint8_t data[ CHECKPOINT_FILE_DATA_SIZE ];
+
+	FILE *stream          = NULL;
+	static char *function = "checkpoint_file_write";
+	size_t write_count    = 0;
+
+	if( checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     data,
+	     checkpoint_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 8 ] ),
+	 checkpoint_file->record_identifier );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 &( data[ 16 ] ),
+	 checkpoint_file->written_time );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	stream = file_stream_open_wide(
+	          filename,
+	          _SYSTEM_STRING( FILE_STREAM_BINARY_OPEN_WRITE ) );
+#else
+	stream = file_stream_open(
+	          filename,
+	          FILE_STREAM_BINARY_OPEN_WRITE );
+#endif
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               stream,
+	               data,
+	               CHECKPOINT_FILE_DATA_SIZE );
+
+	if( file_stream_close(
+	     stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_count != (size_t) CHECKPOINT_FILE_DATA_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,77 @@
+/*
+ * Checkpoint file
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CHECKPOINT_FILE_H )
+#define _CHECKPOINT_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the checkpoint file data
+ */
+#define CHECKPOINT_FILE_DATA_SIZE		24
+
+extern const uint8_t *checkpoint_file_signature;
+
+typedef struct checkpoint_file checkpoint_file_t;
+
+struct checkpoint_file
+{
+	/* The identifier of the last exported record
+	 */
+	uint64_t record_identifier;
+
+	/* The written time of the last exported record
+	 * Contains a FILETIME value
+	 */
+	uint64_t written_time;
+};
+
+int checkpoint_file_initialize(
+     checkpoint_file_t **checkpoint_file,
+     libcerror_error_t **error );
+
+int checkpoint_file_free(
+     checkpoint_file_t **checkpoint_file,
+     libcerror_error_t **error );
+
+int checkpoint_file_read(
+     checkpoint_file_t *checkpoint_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int checkpoint_file_write(
+     checkpoint_file_t *checkpoint_file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CHECKPOINT_FILE_H ) */
+
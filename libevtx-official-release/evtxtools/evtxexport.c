@@ -38,9 +38,11 @@
 #include "evtxtools_libcnotify.h"
 #include "evtxtools_libevtx.h"
 #include "evtxtools_output.h"
+#include "evtxtools_prefetch.h"
 #include "evtxtools_signal.h"
 #include "evtxtools_unused.h"
 #include "export_handle.h"
+#include "input_list.h"
 #include "log_handle.h"
 
 export_handle_t *evtxexport_export_handle = NULL;
@@ -58,27 +60,48 @@ void usage_fprint(
 	fprintf( stream, "Use evtxexport to export items stored in a Windows XML Event Viewer\n"
 	                 "Log (EVTX) file.\n\n" );
 
-	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -f format ] [ -l log_file ]\n"
-	                 "                  [ -m mode ] [ -p resource_files_path ]\n"
+	fprintf( stream, "Usage: evtxexport [ -c codepage ] [ -d date_time_format ]\n"
+	                 "                  [ -f format ] [ -i checkpoint_file ]\n"
+	                 "                  [ -j number_of_threads ] [ -l log_file ]\n"
+	                 "                  [ -m mode ]\n"
+	                 "                  [ -p resource_files_path ]\n"
 	                 "                  [ -r registy_files_path ] [ -s system_file ]\n"
 	                 "                  [ -S software_file ] [ -t event_log_type ]\n"
-	                 "                  [ -hTvV ] source\n\n" );
+	                 "                  [ -hCFOTvV ] source [ source ... ]\n\n" );
 
 
-	fprintf( stream, "\tsource: the source file\n\n" );
+	fprintf( stream, "\tsource: the source file or a directory containing the source files,\n"
+	                 "\t        multiple sources are exported in a single run that shares the\n"
+	                 "\t        Windows Registry and resource file caches\n\n" );
 
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     carve the chunks from the sources, such as disk images,\n"
+	                 "\t        pagefiles or memory dumps, and export the records with\n"
+	                 "\t        the offset they were carved from\n" );
+	fprintf( stream, "\t-d:     date and time format of the text output, options: ctime\n"
+	                 "\t        (default), iso8601\n" );
 	fprintf( stream, "\t-f:     output format, options: xml, text (default)\n" );
+	fprintf( stream, "\t-F:     follow the source, export the records as they are appended\n"
+	                 "\t        to it until interrupted\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     incremental export, export only the records that follow\n"
+	                 "\t        the last record stored in the checkpoint file and store\n"
+	                 "\t        the last exported record in the checkpoint file\n" );
+	fprintf( stream, "\t-j:     number of threads that decode the records of a chunk in\n"
+	                 "\t        parallel, options: 0 (default) to 64, where 0 decodes\n"
+	                 "\t        the records in the export thread\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, items (default), recovered\n"
 	                 "\t        'all' exports the (allocated) items and recovered items,\n"
 	                 "\t        'items' exports the (allocated) items and 'recovered' exports\n"
 	                 "\t        the recovered items\n" );
+	fprintf( stream, "\t-O:     merge the records of multiple sources in written time order,\n"
+	                 "\t        the recovered records are exported per source after the\n"
+	                 "\t        merged records\n" );
 	fprintf( stream, "\t-p:     search PATH for the resource files\n" );
 	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
 	                 "\t        (Windows) Registry file\n" );
@@ -146,12 +169,16 @@ int wmain( int argc, wchar_t * const argv[] )
 int main( int argc, char * const argv[] )
 #endif
 {
+	input_list_t *input_list                              = NULL;
 	libcerror_error_t *error                              = NULL;
 	log_handle_t *log_handle                              = NULL;
 	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_checkpoint_filename        = NULL;
+	system_character_t *option_date_time_format           = NULL;
 	system_character_t *option_event_log_type             = NULL;
 	system_character_t *option_export_format              = NULL;
 	system_character_t *option_export_mode                = NULL;
+	system_character_t *option_number_of_decode_threads   = NULL;
 	system_character_t *option_log_filename               = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
@@ -161,7 +188,17 @@ int main( int argc, char * const argv[] )
 	system_character_t *source                            = NULL;
 	char *program                                         = "evtxexport";
 	system_integer_t option                               = 0;
+	int carve_sources                                     = 0;
+	int event_log_type                                    = 0;
+	int event_log_type_from_filename                      = 0;
+	int export_result                                     = 0;
+	int filename_index                                    = 0;
+	int follow_source                                     = 0;
+	int merge_sources                                     = 0;
+	int prefetch_end_index                                = 0;
+	int prefetch_filename_index                           = 0;
 	int result                                            = 0;
+	int source_index                                      = 0;
 	int use_template_definition                           = 0;
 	int verbose                                           = 0;
 
@@ -198,7 +235,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evtxtools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:f:hl:m:p:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "c:Cd:f:Fhi:j:l:m:Op:r:s:S:t:TvV" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -219,17 +256,42 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'C':
+				carve_sources = 1;
+
+				break;
+
+			case (system_integer_t) 'd':
+				option_date_time_format = optarg;
+
+				break;
+
 			case (system_integer_t) 'f':
 				option_export_format = optarg;
 
 				break;
 
+			case (system_integer_t) 'F':
+				follow_source = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_checkpoint_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_number_of_decode_threads = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				option_log_filename = optarg;
 
@@ -240,6 +302,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'O':
+				merge_sources = 1;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_resource_files_path = optarg;
 
@@ -293,8 +360,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libevtx_notify_set_stream(
@@ -323,6 +388,21 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	/* The signal handler is used to stop following the source
+	 */
+	if( follow_source != 0 )
+	{
+		if( evtxtools_signal_attach(
+		     evtxexport_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -361,6 +441,28 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_date_time_format != NULL )
+	{
+		result = export_handle_set_date_time_format(
+			  evtxexport_export_handle,
+			  option_date_time_format,
+			  &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set date and time format.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported date and time format defaulting to: ctime.\n" );
+		}
+	}
 	if( option_export_format != NULL )
 	{
 		result = export_handle_set_export_format(
@@ -408,19 +510,31 @@ int main( int argc, char * const argv[] )
 	if( ( option_event_log_type == NULL )
 	 || ( result == 0 ) )
 	{
-		result = export_handle_set_event_log_type_from_filename(
+		event_log_type_from_filename = 1;
+	}
+	event_log_type = evtxexport_export_handle->event_log_type;
+
+	if( option_number_of_decode_threads != NULL )
+	{
+		result = export_handle_set_number_of_decode_threads(
 			  evtxexport_export_handle,
-			  source,
+			  option_number_of_decode_threads,
 			  &error );
 
 		if( result == -1 )
 		{
 			fprintf(
 			 stderr,
-			 "Unable to set event log type from filename in export handle.\n" );
+			 "Unable to set number of decode threads.\n" );
 
 			goto on_error;
 		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of decode threads defaulting to: 0.\n" );
+		}
 	}
 	if( option_resource_files_path != NULL )
 	{
@@ -508,41 +622,309 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( export_handle_open_input(
-	     evtxexport_export_handle,
-	     source,
+	if( input_list_initialize(
+	     &input_list,
 	     &error ) != 1 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to open: %" PRIs_SYSTEM ".\n",
-		 source );
+		 "Unable to initialize input list.\n" );
 
 		goto on_error;
 	}
-	result = export_handle_export_file(
-	          evtxexport_export_handle,
-	          log_handle,
-	          &error );
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( input_list_append_source(
+		     input_list,
+		     argv[ source_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM " to input list.\n",
+			 argv[ source_index ] );
 
-	if( result == -1 )
+			goto on_error;
+		}
+	}
+	if( input_list->number_of_filenames == 0 )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to export file.\n" );
+		 "Missing source file.\n" );
 
 		goto on_error;
 	}
-	if( export_handle_close_input(
-	     evtxexport_export_handle,
-	     &error ) != 0 )
+	if( ( follow_source != 0 )
+	 && ( ( carve_sources != 0 )
+	  || ( merge_sources != 0 )
+	  || ( input_list->number_of_filenames > 1 ) ) )
 	{
 		fprintf(
 		 stderr,
-		 "Unable to close export handle.\n" );
+		 "Following a source is only supported for a single source file.\n" );
 
 		goto on_error;
 	}
+	if( option_checkpoint_filename != NULL )
+	{
+		if( ( carve_sources != 0 )
+		 || ( follow_source != 0 )
+		 || ( merge_sources != 0 )
+		 || ( input_list->number_of_filenames > 1 ) )
+		{
+			fprintf(
+			 stderr,
+			 "Incremental export is only supported for a single source file.\n" );
+
+			goto on_error;
+		}
+		if( export_handle_read_checkpoint_file(
+		     evtxexport_export_handle,
+		     option_checkpoint_filename,
+		     &error ) == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read checkpoint file: %" PRIs_SYSTEM ".\n",
+			 option_checkpoint_filename );
+
+			goto on_error;
+		}
+	}
+	if( carve_sources != 0 )
+	{
+		for( filename_index = 0;
+		     filename_index < input_list->number_of_filenames;
+		     filename_index++ )
+		{
+			if( evtxexport_abort != 0 )
+			{
+				break;
+			}
+			source = input_list->filenames[ filename_index ];
+
+			if( event_log_type_from_filename != 0 )
+			{
+				evtxexport_export_handle->event_log_type = event_log_type;
+
+				if( export_handle_set_event_log_type_from_filename(
+				     evtxexport_export_handle,
+				     source,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to set event log type from filename in export handle.\n" );
+
+					goto on_error;
+				}
+			}
+			if( input_list->number_of_filenames > 1 )
+			{
+				fprintf(
+				 stdout,
+				 "Carved source: %" PRIs_SYSTEM "\n\n",
+				 source );
+			}
+			result = export_handle_export_carved_file(
+			          evtxexport_export_handle,
+			          source,
+			          log_handle,
+			          &error );
+
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to carve: %" PRIs_SYSTEM ".\n",
+				 source );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				export_result = 1;
+			}
+		}
+	}
+	else if( ( merge_sources != 0 )
+	      && ( input_list->number_of_filenames > 1 ) )
+	{
+		result = export_handle_export_merged_files(
+		          evtxexport_export_handle,
+		          input_list->filenames,
+		          input_list->number_of_filenames,
+		          event_log_type_from_filename,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export merged files.\n" );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			export_result = 1;
+		}
+	}
+	else
+	{
+		for( filename_index = 0;
+		     filename_index < input_list->number_of_filenames;
+		     filename_index++ )
+		{
+			if( evtxexport_abort != 0 )
+			{
+				break;
+			}
+			source = input_list->filenames[ filename_index ];
+
+			if( event_log_type_from_filename != 0 )
+			{
+				evtxexport_export_handle->event_log_type = event_log_type;
+
+				if( export_handle_set_event_log_type_from_filename(
+				     evtxexport_export_handle,
+				     source,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to set event log type from filename in export handle.\n" );
+
+					goto on_error;
+				}
+			}
+			if( input_list->number_of_filenames > 1 )
+			{
+				fprintf(
+				 stdout,
+				 "Event log file: %" PRIs_SYSTEM "\n\n",
+				 source );
+			}
+			/* The next input files are read into the system cache in the background
+			 * while this input file is exported
+			 */
+			if( prefetch_filename_index <= filename_index )
+			{
+				prefetch_filename_index = filename_index + 1;
+			}
+			prefetch_end_index = filename_index + 1 + EVTXTOOLS_PREFETCH_NUMBER_OF_FILES_AHEAD;
+
+			if( prefetch_end_index > input_list->number_of_filenames )
+			{
+				prefetch_end_index = input_list->number_of_filenames;
+			}
+			if( prefetch_filename_index < prefetch_end_index )
+			{
+				if( evtxtools_prefetch_files(
+				     &( input_list->filenames[ prefetch_filename_index ] ),
+				     prefetch_end_index - prefetch_filename_index,
+				     &error ) == -1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to prefetch input files.\n" );
+
+					goto on_error;
+				}
+				prefetch_filename_index = prefetch_end_index;
+			}
+			if( export_handle_open_input(
+			     evtxexport_export_handle,
+			     source,
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open: %" PRIs_SYSTEM ".\n",
+				 source );
+
+				goto on_error;
+			}
+			if( follow_source != 0 )
+			{
+				result = export_handle_export_followed_file(
+				          evtxexport_export_handle,
+				          log_handle,
+				          &error );
+			}
+			else
+			{
+				result = export_handle_export_file(
+				          evtxexport_export_handle,
+				          log_handle,
+				          &error );
+			}
+			if( result == -1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to export file.\n" );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				export_result = 1;
+			}
+			if( ( option_checkpoint_filename != NULL )
+			 && ( evtxexport_abort == 0 ) )
+			{
+				if( export_handle_write_checkpoint_file(
+				     evtxexport_export_handle,
+				     option_checkpoint_filename,
+				     &error ) != 1 )
+				{
+					fprintf(
+					 stderr,
+					 "Unable to write checkpoint file: %" PRIs_SYSTEM ".\n",
+					 option_checkpoint_filename );
+
+					goto on_error;
+				}
+			}
+			if( export_handle_close_input(
+			     evtxexport_export_handle,
+			     &error ) != 0 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to close export handle.\n" );
+
+				goto on_error;
+			}
+		}
+	}
+	if( input_list_free(
+	     &input_list,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free input list.\n" );
+
+		goto on_error;
+	}
+	if( follow_source != 0 )
+	{
+		if( evtxtools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			goto on_error;
+		}
+	}
 	if( export_handle_free(
 	     &evtxexport_export_handle,
 	     &error ) != 1 )
@@ -573,7 +955,7 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( result == 0 )
+	if( export_result == 0 )
 	{
 		fprintf(
 		 stdout,
@@ -589,8 +971,19 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( input_list != NULL )
+	{
+		input_list_free(
+		 &input_list,
+		 NULL );
+	}
 	if( evtxexport_export_handle != NULL )
 	{
+		if( follow_source != 0 )
+		{
+			evtxtools_signal_detach(
+			 NULL );
+		}
 		export_handle_free(
 		 &evtxexport_export_handle,
 		 NULL );
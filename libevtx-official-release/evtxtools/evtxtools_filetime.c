@@ -0,0 +1,450 @@
+/*
+ * FILETIME formatting functions for the evtxtools
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_filetime.h"
+#include "evtxtools_libcerror.h"
+
+/* The number of 100 nano seconds intervals in a day
+ */
+#define EVTXTOOLS_FILETIME_INTERVALS_PER_DAY	864000000000ULL
+
+/* The number of 100 nano seconds intervals in a second
+ */
+#define EVTXTOOLS_FILETIME_INTERVALS_PER_SECOND	10000000UL
+
+/* The number of days between January 1, 1601 and March 1, 0000
+ * in the proleptic Gregorian calendar
+ */
+#define EVTXTOOLS_FILETIME_DAYS_SINCE_MARCH_0000	584694UL
+
+/* Creates a FILETIME formatter
+ * Make sure the value filetime_formatter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_filetime_formatter_initialize(
+     evtxtools_filetime_formatter_t **filetime_formatter,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_filetime_formatter_initialize";
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filetime_formatter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid FILETIME formatter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != EVTXTOOLS_FILETIME_FORMAT_CTIME )
+	 && ( format != EVTXTOOLS_FILETIME_FORMAT_ISO8601 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	*filetime_formatter = memory_allocate_structure(
+	                       evtxtools_filetime_formatter_t );
+
+	if( *filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *filetime_formatter,
+	     0,
+	     sizeof( evtxtools_filetime_formatter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
+	( *filetime_formatter )->format = format;
+
+	return( 1 );
+
+on_error:
+	if( *filetime_formatter != NULL )
+	{
+		memory_free(
+		 *filetime_formatter );
+
+		*filetime_formatter = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a FILETIME formatter
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_filetime_formatter_free(
+     evtxtools_filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_filetime_formatter_free";
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filetime_formatter != NULL )
+	{
+		memory_free(
+		 *filetime_formatter );
+
+		*filetime_formatter = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the format
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_filetime_formatter_set_format(
+     evtxtools_filetime_formatter_t *filetime_formatter,
+     int format,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_filetime_formatter_set_format";
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( format != EVTXTOOLS_FILETIME_FORMAT_CTIME )
+	 && ( format != EVTXTOOLS_FILETIME_FORMAT_ISO8601 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format.",
+		 function );
+
+		return( -1 );
+	}
+	filetime_formatter->format                 = format;
+	filetime_formatter->has_cached_date_string = 0;
+
+	return( 1 );
+}
+
+/* Copies a FILETIME to a string
+ * The ctime format is "Mon dd, yyyy hh:mm:ss.fffffff00 UTC" and the ISO 8601
+ * format is "yyyy-mm-ddThh:mm:ss.fffffffZ", both with 100 nano seconds precision.
+ * The date is determined with a days to civil date conversion and the date string
+ * is cached, so that consecutive timestamps on the same day only format the time
+ * of day. A FILETIME after the year 9999 is formatted as "(0x%08x 0x%08x)"
+ * The string size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_filetime_formatter_copy_to_string(
+     evtxtools_filetime_formatter_t *filetime_formatter,
+     uint64_t filetime,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error )
+{
+	const char *month_names     = "JanFebMarAprMayJunJulAugSepOctNovDec";
+	const char *month_name      = NULL;
+	static char *function       = "evtxtools_filetime_formatter_copy_to_string";
+	size_t string_index         = 0;
+	uint64_t day_of_era         = 0;
+	uint64_t day_of_year        = 0;
+	uint64_t era                = 0;
+	uint64_t number_of_days     = 0;
+	uint64_t shifted_month      = 0;
+	uint64_t time_of_day        = 0;
+	uint64_t year               = 0;
+	uint64_t year_of_era        = 0;
+	uint32_t day_of_month       = 0;
+	uint32_t fraction_of_second = 0;
+	uint32_t month              = 0;
+	uint32_t seconds_of_day     = 0;
+	uint32_t value_32bit        = 0;
+	uint8_t digit_index         = 0;
+	uint8_t nibble              = 0;
+	int8_t bit_shift            = 0;
+
+	if( filetime_formatter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid FILETIME formatter.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size < EVTXTOOLS_FILETIME_STRING_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: string too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* The divisions are by constants, which compilers replace by multiplications
+	 */
+	number_of_days = filetime / EVTXTOOLS_FILETIME_INTERVALS_PER_DAY;
+	time_of_day    = filetime - ( number_of_days * EVTXTOOLS_FILETIME_INTERVALS_PER_DAY );
+
+	if( ( filetime_formatter->has_cached_date_string == 0 )
+	 || ( filetime_formatter->cached_number_of_days != number_of_days ) )
+	{
+		/* Determine the civil date from the number of days relative to March 1, 0000
+		 * so that the leap day is the last day of the year
+		 */
+		day_of_era  = number_of_days + EVTXTOOLS_FILETIME_DAYS_SINCE_MARCH_0000;
+		era         = day_of_era / 146097;
+		day_of_era -= era * 146097;
+
+		year_of_era = ( day_of_era - ( day_of_era / 1460 ) + ( day_of_era / 36524 ) - ( day_of_era / 146096 ) ) / 365;
+		day_of_year = day_of_era - ( ( 365 * year_of_era ) + ( year_of_era / 4 ) - ( year_of_era / 100 ) );
+
+		shifted_month = ( ( 5 * day_of_year ) + 2 ) / 153;
+		day_of_month  = (uint32_t) ( day_of_year - ( ( ( 153 * shifted_month ) + 2 ) / 5 ) ) + 1;
+		month         = (uint32_t) ( ( shifted_month < 10 ) ? ( shifted_month + 3 ) : ( shifted_month - 9 ) );
+		year          = year_of_era + ( era * 400 ) + ( ( month <= 2 ) ? 1 : 0 );
+
+		if( year > 9999 )
+		{
+			string[ string_index++ ] = (system_character_t) '(';
+
+			for( bit_shift = 60;
+			     bit_shift >= 0;
+			     bit_shift -= 4 )
+			{
+				if( ( bit_shift == 60 )
+				 || ( bit_shift == 28 ) )
+				{
+					if( bit_shift == 28 )
+					{
+						string[ string_index++ ] = (system_character_t) ' ';
+					}
+					string[ string_index++ ] = (system_character_t) '0';
+					string[ string_index++ ] = (system_character_t) 'x';
+				}
+				nibble = (uint8_t) ( ( filetime >> bit_shift ) & 0x0f );
+
+				if( nibble <= 9 )
+				{
+					string[ string_index++ ] = (system_character_t) ( '0' + nibble );
+				}
+				else
+				{
+					string[ string_index++ ] = (system_character_t) ( 'a' + nibble - 10 );
+				}
+			}
+			string[ string_index++ ] = (system_character_t) ')';
+
+			if( filetime_formatter->format == EVTXTOOLS_FILETIME_FORMAT_CTIME )
+			{
+				string[ string_index++ ] = (system_character_t) ' ';
+				string[ string_index++ ] = (system_character_t) 'U';
+				string[ string_index++ ] = (system_character_t) 'T';
+				string[ string_index++ ] = (system_character_t) 'C';
+			}
+			string[ string_index ] = 0;
+
+			return( 1 );
+		}
+		value_32bit = (uint32_t) year;
+
+		if( filetime_formatter->format == EVTXTOOLS_FILETIME_FORMAT_CTIME )
+		{
+			/* Format: Mon dd, yyyy
+			 */
+			month_name = &( month_names[ ( month - 1 ) * 3 ] );
+
+			filetime_formatter->cached_date_string[ 0 ]  = (system_character_t) month_name[ 0 ];
+			filetime_formatter->cached_date_string[ 1 ]  = (system_character_t) month_name[ 1 ];
+			filetime_formatter->cached_date_string[ 2 ]  = (system_character_t) month_name[ 2 ];
+			filetime_formatter->cached_date_string[ 3 ]  = (system_character_t) ' ';
+			filetime_formatter->cached_date_string[ 4 ]  = (system_character_t) ( '0' + ( day_of_month / 10 ) );
+			filetime_formatter->cached_date_string[ 5 ]  = (system_character_t) ( '0' + ( day_of_month % 10 ) );
+			filetime_formatter->cached_date_string[ 6 ]  = (system_character_t) ',';
+			filetime_formatter->cached_date_string[ 7 ]  = (system_character_t) ' ';
+			filetime_formatter->cached_date_string[ 8 ]  = (system_character_t) ( '0' + ( value_32bit / 1000 ) );
+			filetime_formatter->cached_date_string[ 9 ]  = (system_character_t) ( '0' + ( ( value_32bit / 100 ) % 10 ) );
+			filetime_formatter->cached_date_string[ 10 ] = (system_character_t) ( '0' + ( ( value_32bit / 10 ) % 10 ) );
+			filetime_formatter->cached_date_string[ 11 ] = (system_character_t) ( '0' + ( value_32bit % 10 ) );
+			filetime_formatter->cached_date_string[ 12 ] = (system_character_t) ' ';
+
+			filetime_formatter->cached_date_string_length = 13;
+		}
+		else
+		{
+			/* Format: yyyy-mm-dd
+			 */
+			filetime_formatter->cached_date_string[ 0 ]  = (system_character_t) ( '0' + ( value_32bit / 1000 ) );
+			filetime_formatter->cached_date_string[ 1 ]  = (system_character_t) ( '0' + ( ( value_32bit / 100 ) % 10 ) );
+			filetime_formatter->cached_date_string[ 2 ]  = (system_character_t) ( '0' + ( ( value_32bit / 10 ) % 10 ) );
+			filetime_formatter->cached_date_string[ 3 ]  = (system_character_t) ( '0' + ( value_32bit % 10 ) );
+			filetime_formatter->cached_date_string[ 4 ]  = (system_character_t) '-';
+			filetime_formatter->cached_date_string[ 5 ]  = (system_character_t) ( '0' + ( month / 10 ) );
+			filetime_formatter->cached_date_string[ 6 ]  = (system_character_t) ( '0' + ( month % 10 ) );
+			filetime_formatter->cached_date_string[ 7 ]  = (system_character_t) '-';
+			filetime_formatter->cached_date_string[ 8 ]  = (system_character_t) ( '0' + ( day_of_month / 10 ) );
+			filetime_formatter->cached_date_string[ 9 ]  = (system_character_t) ( '0' + ( day_of_month % 10 ) );
+			filetime_formatter->cached_date_string[ 10 ] = (system_character_t) 'T';
+
+			filetime_formatter->cached_date_string_length = 11;
+		}
+		filetime_formatter->cached_number_of_days  = number_of_days;
+		filetime_formatter->has_cached_date_string = 1;
+	}
+	if( memory_copy(
+	     string,
+	     filetime_formatter->cached_date_string,
+	     sizeof( system_character_t ) * filetime_formatter->cached_date_string_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy date string.",
+		 function );
+
+		return( -1 );
+	}
+	string_index = filetime_formatter->cached_date_string_length;
+
+	/* Format: hh:mm:ss
+	 */
+	seconds_of_day     = (uint32_t) ( time_of_day / EVTXTOOLS_FILETIME_INTERVALS_PER_SECOND );
+	fraction_of_second = (uint32_t) ( time_of_day % EVTXTOOLS_FILETIME_INTERVALS_PER_SECOND );
+
+	value_32bit = seconds_of_day / 3600;
+
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit / 10 ) );
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit % 10 ) );
+	string[ string_index++ ] = (system_character_t) ':';
+
+	value_32bit = ( seconds_of_day / 60 ) % 60;
+
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit / 10 ) );
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit % 10 ) );
+	string[ string_index++ ] = (system_character_t) ':';
+
+	value_32bit = seconds_of_day % 60;
+
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit / 10 ) );
+	string[ string_index++ ] = (system_character_t) ( '0' + ( value_32bit % 10 ) );
+	string[ string_index++ ] = (system_character_t) '.';
+
+	/* Format: fffffff
+	 */
+	for( digit_index = 7;
+	     digit_index > 0;
+	     digit_index-- )
+	{
+		string[ string_index + digit_index - 1 ] = (system_character_t) ( '0' + ( fraction_of_second % 10 ) );
+
+		fraction_of_second /= 10;
+	}
+	string_index += 7;
+
+	if( filetime_formatter->format == EVTXTOOLS_FILETIME_FORMAT_CTIME )
+	{
+		/* The ctime format has nano seconds precision
+		 */
+		string[ string_index++ ] = (system_character_t) '0';
+		string[ string_index++ ] = (system_character_t) '0';
+		string[ string_index++ ] = (system_character_t) ' ';
+		string[ string_index++ ] = (system_character_t) 'U';
+		string[ string_index++ ] = (system_character_t) 'T';
+		string[ string_index++ ] = (system_character_t) 'C';
+	}
+	else
+	{
+		string[ string_index++ ] = (system_character_t) 'Z';
+	}
+	string[ string_index ] = 0;
+
+	return( 1 );
+}
+
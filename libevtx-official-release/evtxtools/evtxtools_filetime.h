@@ -0,0 +1,97 @@
+/*
+ * FILETIME formatting functions for the evtxtools
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTXTOOLS_FILETIME_H )
+#define _EVTXTOOLS_FILETIME_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+enum EVTXTOOLS_FILETIME_FORMATS
+{
+	EVTXTOOLS_FILETIME_FORMAT_CTIME		= (int) 'c',
+	EVTXTOOLS_FILETIME_FORMAT_ISO8601	= (int) 'i'
+};
+
+/* The size of a FILETIME string in system characters, which is sufficient
+ * for all formats including the end of string character
+ */
+#define EVTXTOOLS_FILETIME_STRING_SIZE		48
+
+typedef struct evtxtools_filetime_formatter evtxtools_filetime_formatter_t;
+
+struct evtxtools_filetime_formatter
+{
+	/* The format
+	 */
+	int format;
+
+	/* The number of days since January 1, 1601 of the cached date string
+	 */
+	uint64_t cached_number_of_days;
+
+	/* The cached date string, which includes the date and time separator
+	 */
+	system_character_t cached_date_string[ 16 ];
+
+	/* The length of the cached date string
+	 */
+	size_t cached_date_string_length;
+
+	/* Value to indicate the cached date string is set
+	 */
+	uint8_t has_cached_date_string;
+};
+
+int evtxtools_filetime_formatter_initialize(
+     evtxtools_filetime_formatter_t **filetime_formatter,
+     int format,
+     libcerror_error_t **error );
+
+int evtxtools_filetime_formatter_free(
+     evtxtools_filetime_formatter_t **filetime_formatter,
+     libcerror_error_t **error );
+
+int evtxtools_filetime_formatter_set_format(
+     evtxtools_filetime_formatter_t *filetime_formatter,
+     int format,
+     libcerror_error_t **error );
+
+int evtxtools_filetime_formatter_copy_to_string(
+     evtxtools_filetime_formatter_t *filetime_formatter,
+     uint64_t filetime,
+     system_character_t *string,
+     size_t string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTXTOOLS_FILETIME_H ) */
+
@@ -205,3 +205,468 @@ void evtxoutput_version_detailed_fprint(
 	 ")\n\n" );
 }
 
+/* Creates an output buffer
+ * Make sure the value output_buffer is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_initialize(
+     evtxtools_output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_initialize";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid output buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size < 64 )
+	 || ( buffer_size > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*output_buffer = memory_allocate_structure(
+	                  evtxtools_output_buffer_t );
+
+	if( *output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *output_buffer,
+	     0,
+	     sizeof( evtxtools_output_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear output buffer.",
+		 function );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+
+		return( -1 );
+	}
+	/* The additional character is used for the end-of-string character
+	 */
+	( *output_buffer )->buffer = system_string_allocate(
+	                              buffer_size + 1 );
+
+	if( ( *output_buffer )->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		goto on_error;
+	}
+	( *output_buffer )->stream      = stream;
+	( *output_buffer )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an output buffer
+ * Data that was not flushed is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_free(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_free";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *output_buffer != NULL )
+	{
+		memory_free(
+		 ( *output_buffer )->buffer );
+
+		memory_free(
+		 *output_buffer );
+
+		*output_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Writes the buffered data to the output stream
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_flush(
+     evtxtools_output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_flush";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->buffer_offset == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* The wide character data is converted by the stream
+	 */
+	output_buffer->buffer[ output_buffer->buffer_offset ] = 0;
+
+	if( fprintf(
+	     output_buffer->stream,
+	     "%" PRIs_SYSTEM "",
+	     output_buffer->buffer ) < 0 )
+#else
+	if( fwrite(
+	     output_buffer->buffer,
+	     sizeof( system_character_t ),
+	     output_buffer->buffer_offset,
+	     output_buffer->stream ) != output_buffer->buffer_offset )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to stream.",
+		 function );
+
+		output_buffer->buffer_offset = 0;
+
+		return( -1 );
+	}
+	output_buffer->buffer_offset = 0;
+
+	return( 1 );
+}
+
+/* Appends a string to the output buffer
+ * The buffer is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_append_string(
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_append_string";
+	size_t copy_length    = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_length > 0 )
+	{
+		if( output_buffer->buffer_offset >= output_buffer->buffer_size )
+		{
+			if( evtxtools_output_buffer_flush(
+			     output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		copy_length = output_buffer->buffer_size - output_buffer->buffer_offset;
+
+		if( copy_length > string_length )
+		{
+			copy_length = string_length;
+		}
+		if( system_string_copy(
+		     &( output_buffer->buffer[ output_buffer->buffer_offset ] ),
+		     string,
+		     copy_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy string to buffer.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->buffer_offset += copy_length;
+		string                       += copy_length;
+		string_length                -= copy_length;
+	}
+	return( 1 );
+}
+
+/* Appends an ASCII string to the output buffer
+ * The buffer is flushed when it is full
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_append_ascii_string(
+     evtxtools_output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_output_buffer_append_ascii_string";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	while( string_length > 0 )
+	{
+		if( output_buffer->buffer_offset >= output_buffer->buffer_size )
+		{
+			if( evtxtools_output_buffer_flush(
+			     output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		output_buffer->buffer[ output_buffer->buffer_offset++ ] = (system_character_t) *string;
+
+		string        += 1;
+		string_length -= 1;
+	}
+#else
+	if( evtxtools_output_buffer_append_string(
+	     output_buffer,
+	     (system_character_t *) string,
+	     string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append string.",
+		 function );
+
+		return( -1 );
+	}
+#endif /* defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	return( 1 );
+}
+
+/* Appends the decimal representation of a value to the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_append_decimal(
+     evtxtools_output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error )
+{
+	char value_string[ 20 ];
+
+	static char *function = "evtxtools_output_buffer_append_decimal";
+	size_t string_index   = 20;
+
+	do
+	{
+		string_index -= 1;
+
+		value_string[ string_index ] = (char) ( '0' + ( value % 10 ) );
+
+		value /= 10;
+	}
+	while( value > 0 );
+
+	if( evtxtools_output_buffer_append_ascii_string(
+	     output_buffer,
+	     &( value_string[ string_index ] ),
+	     20 - string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends the hexadecimal representation of a 32-bit value to the output buffer
+ * The value is formatted as 0x%08x
+ * Returns 1 if successful or -1 on error
+ */
+int evtxtools_output_buffer_append_hexadecimal(
+     evtxtools_output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error )
+{
+	char value_string[ 10 ];
+
+	static char *function = "evtxtools_output_buffer_append_hexadecimal";
+	size_t string_index   = 10;
+	uint8_t nibble        = 0;
+
+	while( string_index > 2 )
+	{
+		string_index -= 1;
+
+		nibble = (uint8_t) ( value & 0x0f );
+
+		if( nibble < 10 )
+		{
+			value_string[ string_index ] = (char) ( '0' + nibble );
+		}
+		else
+		{
+			value_string[ string_index ] = (char) ( 'a' + nibble - 10 );
+		}
+		value >>= 4;
+	}
+	value_string[ 0 ] = '0';
+	value_string[ 1 ] = 'x';
+
+	if( evtxtools_output_buffer_append_ascii_string(
+	     output_buffer,
+	     value_string,
+	     10,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -24,6 +24,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <system_string.h>
 #include <types.h>
 
 #include "evtxtools_libcerror.h"
@@ -32,6 +33,31 @@
 extern "C" {
 #endif
 
+/* The default size of the output buffer in system characters
+ */
+#define EVTXTOOLS_OUTPUT_BUFFER_SIZE			65536
+
+typedef struct evtxtools_output_buffer evtxtools_output_buffer_t;
+
+struct evtxtools_output_buffer
+{
+	/* The output stream
+	 */
+	FILE *stream;
+
+	/* The buffer
+	 */
+	system_character_t *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The buffer offset
+	 */
+	size_t buffer_offset;
+};
+
 int evtxtools_output_initialize(
      int stdio_mode,
      libcerror_error_t **error );
@@ -47,6 +73,42 @@ void evtxoutput_version_detailed_fprint(
       FILE *stream,
       const char *program );
 
+int evtxtools_output_buffer_initialize(
+     evtxtools_output_buffer_t **output_buffer,
+     FILE *stream,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_free(
+     evtxtools_output_buffer_t **output_buffer,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_flush(
+     evtxtools_output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_append_string(
+     evtxtools_output_buffer_t *output_buffer,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_append_ascii_string(
+     evtxtools_output_buffer_t *output_buffer,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_append_decimal(
+     evtxtools_output_buffer_t *output_buffer,
+     uint64_t value,
+     libcerror_error_t **error );
+
+int evtxtools_output_buffer_append_hexadecimal(
+     evtxtools_output_buffer_t *output_buffer,
+     uint32_t value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,178 @@
+/*
+ * File prefetch functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_prefetch.h"
+
+/* Requests the operating system to read the data of a file in the background
+ * The reads of the file that follow are then served from the system cache
+ * This is a hint, the file is not prefetched if the system does not support it
+ * Returns 1 if successful, 0 if not supported or -1 on error
+ */
+int evtxtools_prefetch_file(
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_prefetch_file";
+
+#if defined( HAVE_OPEN ) && defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	int file_descriptor   = -1;
+	int result            = 0;
+#endif
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_OPEN ) && defined( HAVE_POSIX_FADVISE ) && !defined( WINAPI ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	/* A file that cannot be opened is not prefetched, opening the file
+	 * for reading reports the error
+	 */
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		return( 0 );
+	}
+	/* POSIX_FADV_WILLNEED starts reading the file data into the system cache
+	 * without waiting for the reads to complete
+	 */
+	result = posix_fadvise(
+	          file_descriptor,
+	          0,
+	          0,
+	          POSIX_FADV_WILLNEED );
+
+	if( close(
+	     file_descriptor ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 errno,
+		 "%s: unable to close file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Safely ignore if the file system does not support fadvise
+	 */
+	if( result != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+#else
+	return( 0 );
+#endif
+}
+
+/* Requests the operating system to read the data of multiple files in the background
+ * The requests are issued without waiting for the data of the previous files,
+ * so the reads of the files overlap with each other and with the file being read
+ * Returns 1 if successful, 0 if no file was prefetched or -1 on error
+ */
+int evtxtools_prefetch_files(
+     system_character_t * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error )
+{
+	static char *function = "evtxtools_prefetch_files";
+	int filename_index    = 0;
+	int prefetch_result   = 0;
+	int result            = 0;
+
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_filenames < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of filenames value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( filename_index = 0;
+	     filename_index < number_of_filenames;
+	     filename_index++ )
+	{
+		prefetch_result = evtxtools_prefetch_file(
+		                   filenames[ filename_index ],
+		                   error );
+
+		if( prefetch_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 "%s: unable to prefetch file: %d.",
+			 function,
+			 filename_index );
+
+			return( -1 );
+		}
+		else if( prefetch_result != 0 )
+		{
+			result = 1;
+		}
+	}
+	return( result );
+}
+
@@ -0,0 +1,54 @@
+/*
+ * File prefetch functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVTXTOOLS_PREFETCH_H )
+#define _EVTXTOOLS_PREFETCH_H
+
+#include <common.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of input files that are prefetched ahead of the input file
+ * that is being exported
+ */
+#define EVTXTOOLS_PREFETCH_NUMBER_OF_FILES_AHEAD	4
+
+int evtxtools_prefetch_file(
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int evtxtools_prefetch_files(
+     system_character_t * const *filenames,
+     int number_of_filenames,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVTXTOOLS_PREFETCH_H ) */
+
@@ -26,19 +26,26 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "checkpoint_file.h"
 #include "evtxinput.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libcnotify.h"
 #include "evtxtools_libclocale.h"
 #include "evtxtools_libevtx.h"
-#include "evtxtools_libfdatetime.h"
 #include "evtxtools_libfguid.h"
 #include "evtxtools_libfwevt.h"
+#include "evtxtools_output.h"
+#include "evtxtools_prefetch.h"
 #include "export_handle.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "resource_file.h"
+#include "template_definition_cache.h"
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
@@ -177,6 +184,48 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
+	if( template_definition_cache_initialize(
+	     &( ( *export_handle )->template_definition_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_initialize(
+	     &( ( *export_handle )->output_buffer ),
+	     EXPORT_HANDLE_NOTIFY_STREAM,
+	     EVTXTOOLS_OUTPUT_BUFFER_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_filetime_formatter_initialize(
+	     &( ( *export_handle )->filetime_formatter ),
+	     EVTXTOOLS_FILETIME_FORMAT_CTIME,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create FILETIME formatter.",
+		 function );
+
+		goto on_error;
+	}
 	if( libevtx_file_initialize(
 	     &( ( *export_handle )->input_file ),
 	     error ) != 1 )
@@ -201,6 +250,24 @@ int export_handle_initialize(
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->filetime_formatter != NULL )
+		{
+			evtxtools_filetime_formatter_free(
+			 &( ( *export_handle )->filetime_formatter ),
+			 NULL );
+		}
+		if( ( *export_handle )->output_buffer != NULL )
+		{
+			evtxtools_output_buffer_free(
+			 &( ( *export_handle )->output_buffer ),
+			 NULL );
+		}
+		if( ( *export_handle )->template_definition_cache != NULL )
+		{
+			template_definition_cache_free(
+			 &( ( *export_handle )->template_definition_cache ),
+			 NULL );
+		}
 		if( ( *export_handle )->message_handle != NULL )
 		{
 			message_handle_free(
@@ -254,6 +321,22 @@ int export_handle_free(
 				result = -1;
 			}
 		}
+		if( ( *export_handle )->message_handle_input_is_open != 0 )
+		{
+			if( message_handle_close_input(
+			     ( *export_handle )->message_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input of message handle.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( message_handle_free(
 		     &( ( *export_handle )->message_handle ),
 		     error ) != 1 )
@@ -267,6 +350,58 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( template_definition_cache_free(
+		     &( ( *export_handle )->template_definition_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition cache.",
+			 function );
+
+			result = -1;
+		}
+		if( evtxtools_output_buffer_free(
+		     &( ( *export_handle )->output_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free output buffer.",
+			 function );
+
+			result = -1;
+		}
+		if( evtxtools_filetime_formatter_free(
+		     &( ( *export_handle )->filetime_formatter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free FILETIME formatter.",
+			 function );
+
+			result = -1;
+		}
+		if( checkpoint_file_free(
+		     &( ( *export_handle )->checkpoint_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free checkpoint file.",
+			 function );
+
+			result = -1;
+		}
 		if( libevtx_file_free(
 		     &( ( *export_handle )->input_file ),
 		     error ) != 1 )
@@ -471,6 +606,126 @@ int export_handle_set_export_format(
 	return( result );
 }
 
+/* Sets the date and time format
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_date_time_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_date_time_format";
+	size_t string_length  = 0;
+	int format            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 5 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "ctime" ),
+		     5 ) == 0 )
+		{
+			format = EVTXTOOLS_FILETIME_FORMAT_CTIME;
+		}
+	}
+	else if( string_length == 7 )
+	{
+		if( system_string_compare(
+		     string,
+		     _SYSTEM_STRING( "iso8601" ),
+		     7 ) == 0 )
+		{
+			format = EVTXTOOLS_FILETIME_FORMAT_ISO8601;
+		}
+	}
+	if( format == 0 )
+	{
+		return( 0 );
+	}
+	if( evtxtools_filetime_formatter_set_format(
+	     export_handle->filetime_formatter,
+	     format,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set FILETIME formatter format.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the number of decode threads
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_number_of_decode_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_set_number_of_decode_threads";
+	size_t string_index          = 0;
+	size_t string_length         = 0;
+	int number_of_decode_threads = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length == 0 )
+	 || ( string_length > 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( string[ string_index ] < (system_character_t) '0' )
+		 || ( string[ string_index ] > (system_character_t) '9' ) )
+		{
+			return( 0 );
+		}
+		number_of_decode_threads *= 10;
+		number_of_decode_threads += (int) ( string[ string_index ] - (system_character_t) '0' );
+	}
+	if( number_of_decode_threads > 64 )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_decode_threads = number_of_decode_threads;
+
+	return( 1 );
+}
+
 /* Sets the ascii codepage
  * Returns 1 if successful or -1 on error
  */
@@ -819,15 +1074,16 @@ int export_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the input
+/* Sets the event log type of the message handle
+ * The input of the message handle is opened on the first call
  * Returns 1 if successful or -1 on error
  */
-int export_handle_open_input(
+int export_handle_set_message_handle_event_log_type(
      export_handle_t *export_handle,
-     const system_character_t *filename,
+     int event_log_type,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_set_message_handle_event_log_type";
 
 	if( export_handle == NULL )
 	{
@@ -840,34 +1096,71 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	/* The input of the message handle remains open when multiple input files
+	 * are exported, so that the Windows Registry files and the resource file
+	 * caches are shared by the input files
+	 */
+	if( export_handle->message_handle_input_is_open == 0 )
+	{
+		if( message_handle_open_input(
+		     export_handle->message_handle,
+		     export_handle_get_event_log_key_name(
+		      event_log_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input of message handle.",
+			 function );
+
+			return( -1 );
+		}
+		export_handle->message_handle_input_is_open = 1;
+	}
+	else if( message_handle_set_eventlog_key_name(
+	          export_handle->message_handle,
+	          export_handle_get_event_log_key_name(
+	           event_log_type ),
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid export handle input is already open.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set eventlog key name in message handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( message_handle_open_input(
-	     export_handle->message_handle,
-	     export_handle_get_event_log_key_name(
-	      export_handle->event_log_type ),
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Opens a file for export
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_file";
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input of message handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
 		return( -1 );
 	}
 	if( libevtx_file_set_ascii_codepage(
-	     export_handle->input_file,
+	     file,
 	     export_handle->ascii_codepage,
 	     error ) != 1 )
 	{
@@ -875,93 +1168,316 @@ int export_handle_open_input(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set ASCII codepage in input file.",
+		 "%s: unable to set ASCII codepage in file.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevtx_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libevtx_file_open(
-	     export_handle->input_file,
+	/* The file data is read into the system cache in the background while
+	 * the records are exported
+	 */
+	if( evtxtools_prefetch_file(
 	     filename,
-	     LIBEVTX_OPEN_READ,
-	     error ) != 1 )
-#endif
+	     error ) == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to prefetch file.",
 		 function );
 
 		return( -1 );
 	}
-	export_handle->input_is_open = 1;
-
-	return( 1 );
-}
-
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
- */
-int export_handle_close_input(
-     export_handle_t *export_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "export_handle_close_input";
-	int result            = 0;
-
-	if( export_handle == NULL )
+	/* The records are exported in order so the chunks are read in large blocks
+	 */
+	if( libevtx_file_set_read_buffer_size(
+	     file,
+	     4 * 1024 * 1024,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read buffer size in file.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	/* The records are exported in order so the chunks are read ahead
+	 */
+	if( libevtx_file_set_read_ahead_depth(
+	     file,
+	     4,
+	     error ) != 1 )
 	{
-		if( message_handle_close_input(
-		     export_handle->message_handle,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set read-ahead depth in file.",
+		 function );
+
+		return( -1 );
+	}
+	/* The records of a chunk are decoded by worker threads while the records are exported
+	 */
+	if( libevtx_file_set_number_of_decode_threads(
+	     file,
+	     export_handle->number_of_decode_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of decode threads in file.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_file_open_wide(
+	     file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_file_open(
+	     file,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_message_handle_event_log_type(
+	     export_handle,
+	     export_handle->event_log_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event log type of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_open_file(
+	     export_handle,
+	     export_handle->input_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->input_is_open = 1;
+
+	return( 1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		if( libevtx_file_close(
+		     export_handle->input_file,
 		     error ) != 0 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input of message handle.",
+			 "%s: unable to close input file.",
 			 function );
 
 			result = -1;
 		}
-		if( libevtx_file_close(
-		     export_handle->input_file,
-		     error ) != 0 )
+		export_handle->input_is_open = 0;
+	}
+	return( result );
+}
+
+/* Reads the checkpoint file, which enables the incremental export of the records
+ * Returns 1 if successful, 0 if the checkpoint file could not be opened or -1 on error
+ */
+int export_handle_read_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_read_checkpoint_file";
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->checkpoint_file == NULL )
+	{
+		if( checkpoint_file_initialize(
+		     &( export_handle->checkpoint_file ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input file.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create checkpoint file.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		export_handle->input_is_open = 0;
+	}
+	result = checkpoint_file_read(
+	          export_handle->checkpoint_file,
+	          filename,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read checkpoint file.",
+		 function );
+
+		return( -1 );
 	}
 	return( result );
 }
 
+/* Writes the checkpoint file
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_write_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_write_checkpoint_file";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( checkpoint_file_write(
+	     export_handle->checkpoint_file,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Copies the GUID string to a byte stream
  * Returns 1 if successful or -1 on error
  */
@@ -1069,6 +1585,7 @@ on_error:
 }
 
 /* Retrieves the template definition from the resource file
+ * The template definition is owned by the template definition cache of the export handle
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int export_handle_resource_file_get_template_definition(
@@ -1111,6 +1628,33 @@ int export_handle_resource_file_get_template_definition(
 
 		return( -1 );
 	}
+	result = template_definition_cache_get_template_definition(
+	          export_handle->template_definition_cache,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          template_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( *template_definition == NULL )
+		{
+			return( 0 );
+		}
+		return( 1 );
+	}
 	result = resource_file_get_template_definition(
 		  resource_file,
 		  provider_identifier,
@@ -1234,6 +1778,26 @@ int export_handle_resource_file_get_template_definition(
 			goto on_error;
 		}
 	}
+	/* A template definition that is not available is cached as well
+	 * so that the resource file is not searched again for the same event
+	 */
+	if( template_definition_cache_set_template_definition(
+	     export_handle->template_definition_cache,
+	     provider_identifier,
+	     provider_identifier_size,
+	     event_identifier,
+	     *template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set template definition in cache.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
@@ -1379,12 +1943,54 @@ int export_handle_export_record_event_message(
 	}
 	if( resource_filename != NULL )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Resource filename\t\t: %" PRIs_SYSTEM "\n",
-		 resource_filename );
-	}
-	if( resource_filename != NULL )
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Resource filename\t\t: ",
+		     21,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     resource_filename,
+		     system_string_length(
+		      resource_filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append resource filename.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( resource_filename != NULL )
 	{
 		if( export_handle_guid_string_copy_to_byte_stream(
 		     export_handle,
@@ -1479,10 +2085,52 @@ int export_handle_export_record_event_message(
 	}
 	if( message_filename != NULL )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-		 message_filename );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Message filename\t\t: ",
+		     20,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     message_filename,
+		     system_string_length(
+		      message_filename ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message filename.",
+			 function );
+
+			goto on_error;
+		}
 
 		if( message_identifier == 0 )
 		{
@@ -1506,10 +2154,50 @@ int export_handle_export_record_event_message(
 			{
 				if( export_handle->verbose != 0 )
 				{
-					fprintf(
-					 export_handle->notify_stream,
-					 "Event identifier qualifiers\t: 0x%08" PRIx32 "\n",
-					 event_identifier_qualifiers );
+					if( evtxtools_output_buffer_append_ascii_string(
+					     export_handle->output_buffer,
+					     "Event identifier qualifiers\t: ",
+					     30,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append event identifier qualifiers.",
+						 function );
+
+						goto on_error;
+					}
+					if( evtxtools_output_buffer_append_hexadecimal(
+					     export_handle->output_buffer,
+					     event_identifier_qualifiers,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append event identifier qualifiers.",
+						 function );
+
+						goto on_error;
+					}
+					if( evtxtools_output_buffer_append_ascii_string(
+					     export_handle->output_buffer,
+					     "\n",
+					     1,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+						 "%s: unable to append event identifier qualifiers.",
+						 function );
+
+						goto on_error;
+					}
 				}
 				message_identifier = event_identifier_qualifiers << 16;
 			}
@@ -1517,10 +2205,50 @@ int export_handle_export_record_event_message(
 		}
 		if( export_handle->verbose != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Message identifier\t\t: 0x%08" PRIx32 "\n",
-			 message_identifier );
+			if( evtxtools_output_buffer_append_ascii_string(
+			     export_handle->output_buffer,
+			     "Message identifier\t\t: ",
+			     22,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( evtxtools_output_buffer_append_hexadecimal(
+			     export_handle->output_buffer,
+			     message_identifier,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( evtxtools_output_buffer_append_ascii_string(
+			     export_handle->output_buffer,
+			     "\n",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append message identifier.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		result = message_handle_get_message_string(
 			  export_handle->message_handle,
@@ -1573,19 +2301,6 @@ int export_handle_export_record_event_message(
 			libcerror_error_free(
 			 error );
 		}
-		if( libevtx_template_definition_free(
-		     &template_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free template definition.",
-			 function );
-
-			goto on_error;
-		}
 	}
 	if( libevtx_record_get_number_of_strings(
 	     record,
@@ -1601,19 +2316,99 @@ int export_handle_export_record_event_message(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "Number of strings\t\t: ",
+	     21,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_decimal(
+	     export_handle->output_buffer,
+	     (uint64_t) number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append number of strings.",
+		 function );
+
+		goto on_error;
+	}
 
 	for( value_string_index = 0;
 	     value_string_index < number_of_strings;
 	     value_string_index++ )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "String: ",
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_decimal(
+		     export_handle->output_buffer,
+		     (uint64_t) value_string_index + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\t\t\t: ",
+		     5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append string.",
+			 function );
+
+			goto on_error;
+		}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libevtx_record_get_utf16_string_size(
@@ -1683,22 +2478,61 @@ int export_handle_export_record_event_message(
 
 				goto on_error;
 			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
+			if( evtxtools_output_buffer_append_string(
+			     export_handle->output_buffer,
+			     value_string,
+			     system_string_length(
+			      value_string ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append string.",
+				 function );
+
+				goto on_error;
+			}
 
 			memory_free(
 			 value_string );
 
 			value_string = NULL;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of line.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( message_string != NULL )
 	{
+		/* The message string is written directly to the stream
+		 */
+		if( evtxtools_output_buffer_flush(
+		     export_handle->output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			goto on_error;
+		}
 		if( message_string_fprint(
 		     message_string,
 		     record,
@@ -1724,12 +2558,6 @@ on_error:
 		memory_free(
 		 value_string );
 	}
-	if( template_definition != NULL )
-	{
-		libevtx_template_definition_free(
-		 &template_definition,
-		 NULL );
-	}
 	if( message_filename != NULL )
 	{
 		memory_free(
@@ -1813,9 +2641,9 @@ int export_handle_export_record_text(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	system_character_t filetime_string[ 48 ];
+	system_character_t filetime_string[ EVTXTOOLS_FILETIME_STRING_SIZE ];
 
-	libfdatetime_filetime_t *filetime       = NULL;
+	const char *event_level_string          = NULL;
 	system_character_t *source_name         = NULL;
 	system_character_t *provider_identifier = NULL;
 	system_character_t *value_string        = NULL;
@@ -1851,37 +2679,64 @@ int export_handle_export_record_text(
 
 		return( -1 );
 	}
-	if( libfdatetime_filetime_initialize(
-	     &filetime,
+	if( libevtx_record_get_identifier(
+	     record,
+	     &value_64bit,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create filetime.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevtx_record_get_identifier(
-	     record,
-	     &value_64bit,
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "Event number\t\t\t: ",
+	     17,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_decimal(
+	     export_handle->output_buffer,
+	     value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event number.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event number\t\t\t: %" PRIu64 "\n",
-	 value_64bit );
 
 	result = libevtx_record_get_creation_time(
 	          record,
@@ -1901,50 +2756,68 @@ int export_handle_export_record_text(
 	}
 	else if( result != 0 )
 	{
-		if( libfdatetime_filetime_copy_from_64bit(
-		     filetime,
+		if( evtxtools_filetime_formatter_copy_to_string(
+		     export_handle->filetime_formatter,
 		     value_64bit,
+		     filetime_string,
+		     EVTXTOOLS_FILETIME_STRING_SIZE,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy filetime from 64-bit.",
+			 "%s: unable to copy filetime to string.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_filetime_copy_to_utf16_string(
-			  filetime,
-			  (uint16_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#else
-		result = libfdatetime_filetime_copy_to_utf8_string(
-			  filetime,
-			  (uint8_t *) filetime_string,
-			  48,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-			  error );
-#endif
-		if( result != 1 )
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Creation time\t\t\t: ",
+		     18,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy filetime to string.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     filetime_string,
+		     system_string_length(
+		      filetime_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append creation time.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Creation time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-		 filetime_string );
 	}
 	if( libevtx_record_get_written_time(
 	     record,
@@ -1960,68 +2833,72 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	if( libfdatetime_filetime_copy_from_64bit(
-	     filetime,
+	if( evtxtools_filetime_formatter_copy_to_string(
+	     export_handle->filetime_formatter,
 	     value_64bit,
+	     filetime_string,
+	     EVTXTOOLS_FILETIME_STRING_SIZE,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime from 64-bit.",
+		 "%s: unable to copy filetime to string.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libfdatetime_filetime_copy_to_utf16_string(
-		  filetime,
-		  (uint16_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#else
-	result = libfdatetime_filetime_copy_to_utf8_string(
-		  filetime,
-		  (uint8_t *) filetime_string,
-		  48,
-		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME_NANO_SECONDS,
-		  error );
-#endif
-	if( result != 1 )
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "Written time\t\t\t: ",
+	     17,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to copy filetime to string.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Written time\t\t\t: %" PRIs_SYSTEM " UTC\n",
-	 filetime_string );
-
-	if( libfdatetime_filetime_free(
-	     &filetime,
+	if( evtxtools_output_buffer_append_string(
+	     export_handle->output_buffer,
+	     filetime_string,
+	     system_string_length(
+	      filetime_string ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free filetime.",
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
 		 function );
 
 		goto on_error;
 	}
-	result = libevtx_record_get_event_version(
-	          record,
-	          &event_version,
-	          error );
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append written time.",
+		 function );
+
+		goto on_error;
+	}
+	result = libevtx_record_get_event_version(
+	          record,
+	          &event_version,
+	          error );
 
 	if( result == -1 )
 	{
@@ -2036,10 +2913,50 @@ int export_handle_export_record_text(
 	}
 	else if( result != 0 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event version\t\t\t: %d\n",
-		 event_version );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Event version\t\t\t: ",
+		     18,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_decimal(
+		     export_handle->output_buffer,
+		     (uint64_t) event_version,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event version.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libevtx_record_get_event_level(
 	     record,
@@ -2055,12 +2972,84 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event level\t\t\t: %s (%d)\n",
-	 export_handle_get_event_level(
-	  event_level ),
-	 event_level );
+	event_level_string = export_handle_get_event_level(
+	                      event_level );
+
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "Event level\t\t\t: ",
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     event_level_string,
+	     narrow_string_length(
+	      event_level_string ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     " (",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_decimal(
+	     export_handle->output_buffer,
+	     (uint64_t) event_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     ")\n",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event level.",
+		 function );
+
+		goto on_error;
+	}
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libevtx_record_get_utf16_user_security_identifier_size(
@@ -2125,10 +3114,52 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "User security identifier\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "User security identifier\t: ",
+		     27,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     value_string,
+		     system_string_length(
+		      value_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append user security identifier.",
+			 function );
+
+			goto on_error;
+		}
 
 		memory_free(
 		 value_string );
@@ -2198,10 +3229,52 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Computer name\t\t\t: ",
+		     18,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     value_string,
+		     system_string_length(
+		      value_string ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append computer name.",
+			 function );
+
+			goto on_error;
+		}
 
 		memory_free(
 		 value_string );
@@ -2273,10 +3346,52 @@ int export_handle_export_record_text(
 		}
 		if( export_handle->verbose != 0 )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Provider identifier\t\t: %" PRIs_SYSTEM "\n",
-			 provider_identifier );
+			if( evtxtools_output_buffer_append_ascii_string(
+			     export_handle->output_buffer,
+			     "Provider identifier\t\t: ",
+			     23,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( evtxtools_output_buffer_append_string(
+			     export_handle->output_buffer,
+			     provider_identifier,
+			     system_string_length(
+			      provider_identifier ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
+			if( evtxtools_output_buffer_append_ascii_string(
+			     export_handle->output_buffer,
+			     "\n",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append provider identifier.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -2342,10 +3457,52 @@ int export_handle_export_record_text(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
-		 source_name );
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Source name\t\t\t: ",
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     source_name,
+		     system_string_length(
+		      source_name ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source name.",
+			 function );
+
+			goto on_error;
+		}
 	}
 /* TODO category ? */
 
@@ -2363,11 +3520,79 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-	 event_identifier,
-	 event_identifier );
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "Event identifier\t\t: ",
+	     20,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_hexadecimal(
+	     export_handle->output_buffer,
+	     event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     " (",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_decimal(
+	     export_handle->output_buffer,
+	     (uint64_t) event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     ")\n",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append event identifier.",
+		 function );
+
+		goto on_error;
+	}
 
 	if( export_handle_export_record_event_message(
 	     export_handle,
@@ -2389,9 +3614,21 @@ int export_handle_export_record_text(
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of line.",
+		 function );
+
+		goto on_error;
+	}
 
 	if( provider_identifier != NULL )
 	{
@@ -2425,12 +3662,6 @@ on_error:
 		memory_free(
 		 value_string );
 	}
-	if( filetime != NULL )
-	{
-		libfdatetime_filetime_free(
-		 &filetime,
-		 NULL );
-	}
 	return( -1 );
 }
 
@@ -2531,19 +3762,43 @@ int export_handle_export_record_xml(
 		}
 		/* Note that the event XML ends with a new line
 		 */
-		fprintf(
-		 export_handle->notify_stream,
-		 "%" PRIs_SYSTEM "",
-		 event_xml );
+		if( evtxtools_output_buffer_append_string(
+		     export_handle->output_buffer,
+		     event_xml,
+		     system_string_length(
+		      event_xml ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event XML.",
+			 function );
+
+			goto on_error;
+		}
 
 		memory_free(
 		 event_xml );
 
 		event_xml = NULL;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
+	if( evtxtools_output_buffer_append_ascii_string(
+	     export_handle->output_buffer,
+	     "\n",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of line.",
+		 function );
+
+		goto on_error;
+	}
 
 	return( 1 );
 
@@ -2556,12 +3811,13 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the records
+/* Exports the records starting with a specific record index
  * Returns the 1 if succesful, 0 if no records are available or -1 on error
  */
 int export_handle_export_records(
      export_handle_t *export_handle,
      libevtx_file_t *file,
+     int first_record_index,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
@@ -2592,6 +3848,17 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
 	if( libevtx_file_get_number_of_records(
 	     file,
 	     &number_of_records,
@@ -2606,19 +3873,21 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
-	if( number_of_records == 0 )
+	if( first_record_index >= number_of_records )
 	{
 		return( 0 );
 	}
-	for( record_index = 0;
+	for( record_index = first_record_index;
 	     record_index < number_of_records;
 	     record_index++ )
 	{
 		if( export_handle->abort != 0 )
 		{
-			return( -1 );
+			goto on_error;
 		}
-		if( libevtx_file_get_record_by_index(
+		/* The record is reused for every record index
+		 */
+		if( libevtx_file_get_record_by_index_into(
 		     file,
 		     record_index,
 		     &record,
@@ -2632,7 +3901,7 @@ int export_handle_export_records(
 			 function,
 			 record_index );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( export_handle_export_record(
 		     export_handle,
@@ -2640,6 +3909,10 @@ int export_handle_export_records(
 		     log_handle,
 		     error ) != 1 )
 		{
+			evtxtools_output_buffer_flush(
+			 export_handle->output_buffer,
+			 NULL );
+
 			fprintf(
 			 export_handle->notify_stream,
 			 "Unable to export record: %d.\n\n",
@@ -2664,22 +3937,284 @@ int export_handle_export_records(
 			libcerror_error_free(
 			 error );
 		}
-		if( libevtx_record_free(
-		     &record,
+	}
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the records that follow the last record of the checkpoint file
+ * The records are exported in order of their identifier. All the records are
+ * exported when the last record of the checkpoint file is no longer in the file,
+ * such as when the log was cleared or the record was overwritten.
+ * The checkpoint file is updated with the last exported record
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records_after_checkpoint(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_record_t *record   = NULL;
+	static char *function      = "export_handle_export_records_after_checkpoint";
+	off64_t offset             = 0;
+	uint64_t record_identifier = 0;
+	uint64_t written_time      = 0;
+	uint32_t size              = 0;
+	int chunk_index            = 0;
+	int export_index           = 0;
+	int first_record_index     = 0;
+	int number_of_new_records  = 0;
+	int number_of_records      = 0;
+	int record_index           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->checkpoint_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing checkpoint file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_records_after_identifier(
+	     file,
+	     export_handle->checkpoint_file->record_identifier,
+	     &first_record_index,
+	     &number_of_new_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records after checkpoint.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record that precedes the new records must be the last record
+	 * of the checkpoint file otherwise the checkpoint does not apply
+	 */
+	if( ( export_handle->checkpoint_file->record_identifier != 0 )
+	 && ( number_of_new_records < number_of_records ) )
+	{
+		record_index = ( first_record_index + number_of_records - 1 ) % number_of_records;
+
+		if( libevtx_file_get_record_header_values_by_index(
+		     file,
+		     record_index,
+		     &record_identifier,
+		     &written_time,
+		     &chunk_index,
+		     &offset,
+		     &size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header values of record: %d.",
 			 function,
 			 record_index );
 
 			return( -1 );
 		}
+		if( ( record_identifier != export_handle->checkpoint_file->record_identifier )
+		 || ( written_time != export_handle->checkpoint_file->written_time ) )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Last exported record not found, exporting all records.\n\n" );
+
+			if( libevtx_file_get_records_after_identifier(
+			     file,
+			     0,
+			     &first_record_index,
+			     &number_of_new_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve records.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( number_of_new_records == 0 )
+	{
+		return( 0 );
+	}
+	for( export_index = 0;
+	     export_index < number_of_new_records;
+	     export_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		record_index = ( first_record_index + export_index ) % number_of_records;
+
+		/* The record is reused for every record index
+		 */
+		if( libevtx_file_get_record_by_index_into(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			evtxtools_output_buffer_flush(
+			 export_handle->output_buffer,
+			 NULL );
+
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export record: %d.\n\n",
+			 record_index );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( libevtx_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_get_record_header_values_by_index(
+	     file,
+	     record_index,
+	     &( export_handle->checkpoint_file->record_identifier ),
+	     &( export_handle->checkpoint_file->written_time ),
+	     &chunk_index,
+	     &offset,
+	     &size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header values of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Exports the recovered records
@@ -2775,6 +4310,10 @@ int export_handle_export_recovered_records(
 		          log_handle,
 		          error ) != 1 )
 		{
+			evtxtools_output_buffer_flush(
+			 export_handle->output_buffer,
+			 NULL );
+
 			fprintf(
 			 export_handle->notify_stream,
 			 "Unable to export recovered record: %d.\n\n",
@@ -2842,11 +4381,23 @@ int export_handle_export_file(
 	}
 	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
 	{
-		result_records = export_handle_export_records(
-				  export_handle,
-				  export_handle->input_file,
-				  log_handle,
-				  error );
+		if( export_handle->checkpoint_file != NULL )
+		{
+			result_records = export_handle_export_records_after_checkpoint(
+					  export_handle,
+					  export_handle->input_file,
+					  log_handle,
+					  error );
+		}
+		else
+		{
+			result_records = export_handle_export_records(
+					  export_handle,
+					  export_handle->input_file,
+					  0,
+					  log_handle,
+					  error );
+		}
 
 		if( result_records == -1 )
 		{
@@ -2857,7 +4408,7 @@ int export_handle_export_file(
 			 "%s: unable to export records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
@@ -2877,14 +4428,1064 @@ int export_handle_export_file(
 			 "%s: unable to export recovered records.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
+	if( evtxtools_output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( result_records != 0 )
 	 || ( result_recovered_records != 0 ) )
 	{
 		return( 1 );
 	}
 	return( 0 );
+
+on_error:
+	evtxtools_output_buffer_flush(
+	 export_handle->output_buffer,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Exports the records of multiple files merged in written time order
+ * The recovered records, which have no meaningful order, are exported per file after the merged records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_merged_files(
+     export_handle_t *export_handle,
+     system_character_t * const *filenames,
+     int number_of_filenames,
+     int event_log_type_from_filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_file_t **files        = NULL;
+	libevtx_merge_t *merge        = NULL;
+	libevtx_record_t *record      = NULL;
+	int *event_log_types          = NULL;
+	static char *function         = "export_handle_export_merged_files";
+	int export_result             = 0;
+	int file_index                = 0;
+	int message_handle_file_index = -1;
+	int result                    = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filenames.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_filenames <= 0 )
+	 || ( (size_t) number_of_filenames > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevtx_file_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	files = (libevtx_file_t **) memory_allocate(
+	                             sizeof( libevtx_file_t * ) * number_of_filenames );
+
+	if( files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create files.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     files,
+	     0,
+	     sizeof( libevtx_file_t * ) * number_of_filenames ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear files.",
+		 function );
+
+		goto on_error;
+	}
+	event_log_types = (int *) memory_allocate(
+	                           sizeof( int ) * number_of_filenames );
+
+	if( event_log_types == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create event log types.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_merge_initialize(
+	     &merge,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize merge.",
+		 function );
+
+		goto on_error;
+	}
+	/* All the files are opened before the records are merged, so the reads
+	 * of the files are requested at once to let them overlap
+	 */
+	if( evtxtools_prefetch_files(
+	     filenames,
+	     number_of_filenames,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to prefetch files.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_filenames;
+	     file_index++ )
+	{
+		event_log_types[ file_index ] = export_handle->event_log_type;
+
+		if( event_log_type_from_filename != 0 )
+		{
+			if( evtxinput_determine_event_log_type_from_filename(
+			     filenames[ file_index ],
+			     &( event_log_types[ file_index ] ),
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine event log type from filename: %" PRIs_SYSTEM ".",
+				 function,
+				 filenames[ file_index ] );
+
+				goto on_error;
+			}
+		}
+		if( libevtx_file_initialize(
+		     &( files[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( export_handle_open_file(
+		     export_handle,
+		     files[ file_index ],
+		     filenames[ file_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file: %" PRIs_SYSTEM ".",
+			 function,
+			 filenames[ file_index ] );
+
+			goto on_error;
+		}
+		if( libevtx_merge_append_file(
+		     merge,
+		     files[ file_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append file: %d to merge.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	while( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		result = libevtx_merge_get_next_record(
+		          merge,
+		          &file_index,
+		          &record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next record from merge.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		export_result = 1;
+
+		/* The eventlog key of the message handle only changes when the file
+		 * of the record has a different event log type
+		 */
+		if( ( message_handle_file_index == -1 )
+		 || ( event_log_types[ file_index ] != event_log_types[ message_handle_file_index ] ) )
+		{
+			if( export_handle_set_message_handle_event_log_type(
+			     export_handle,
+			     event_log_types[ file_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set event log type of message handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		message_handle_file_index = file_index;
+
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			evtxtools_output_buffer_flush(
+			 export_handle->output_buffer,
+			 NULL );
+
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to export record of file: %" PRIs_SYSTEM ".\n\n",
+			 filenames[ file_index ] );
+
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	{
+		for( file_index = 0;
+		     file_index < number_of_filenames;
+		     file_index++ )
+		{
+			if( export_handle_set_message_handle_event_log_type(
+			     export_handle,
+			     event_log_types[ file_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set event log type of message handle.",
+				 function );
+
+				goto on_error;
+			}
+			result = export_handle_export_recovered_records(
+			          export_handle,
+			          files[ file_index ],
+			          log_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export recovered records of file: %" PRIs_SYSTEM ".",
+				 function,
+				 filenames[ file_index ] );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				export_result = 1;
+			}
+		}
+	}
+	if( evtxtools_output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_merge_free(
+	     &merge,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free merge.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < number_of_filenames;
+	     file_index++ )
+	{
+		if( libevtx_file_close(
+		     files[ file_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+		if( libevtx_file_free(
+		     &( files[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file: %d.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 event_log_types );
+
+	memory_free(
+	 files );
+
+	return( export_result );
+
+on_error:
+	evtxtools_output_buffer_flush(
+	 export_handle->output_buffer,
+	 NULL );
+
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( merge != NULL )
+	{
+		libevtx_merge_free(
+		 &merge,
+		 NULL );
+	}
+	if( event_log_types != NULL )
+	{
+		memory_free(
+		 event_log_types );
+	}
+	if( files != NULL )
+	{
+		for( file_index = 0;
+		     file_index < number_of_filenames;
+		     file_index++ )
+		{
+			if( files[ file_index ] != NULL )
+			{
+				libevtx_file_free(
+				 &( files[ file_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 files );
+	}
+	return( -1 );
+}
+
+/* Exports the records of the file and then the records appended to it
+ * The file is refreshed every follow interval until the export is aborted
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_followed_file(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function          = "export_handle_export_followed_file";
+	int number_of_exported_records = 0;
+	int number_of_records          = 0;
+	int result                     = 0;
+	int result_records             = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = export_handle_export_file(
+	          export_handle,
+	          log_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     export_handle->input_file,
+	     &number_of_exported_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_handle->abort == 0 )
+	{
+#if defined( WINAPI )
+		Sleep(
+		 EXPORT_HANDLE_FOLLOW_INTERVAL * 1000 );
+#else
+		sleep(
+		 EXPORT_HANDLE_FOLLOW_INTERVAL );
+#endif
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libevtx_file_refresh(
+		     export_handle->input_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to refresh file.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_file_get_number_of_records(
+		     export_handle->input_file,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+		/* Recovered records are only exported by the initial export since
+		 * the free space they are recovered from is overwritten by new records
+		 */
+		if( ( number_of_records > number_of_exported_records )
+		 && ( export_handle->export_mode != EXPORT_MODE_RECOVERED ) )
+		{
+			result_records = export_handle_export_records(
+			                  export_handle,
+			                  export_handle->input_file,
+			                  number_of_exported_records,
+			                  log_handle,
+			                  error );
+
+			if( result_records == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export records.",
+				 function );
+
+				evtxtools_output_buffer_flush(
+				 export_handle->output_buffer,
+				 NULL );
+
+				return( -1 );
+			}
+			else if( result_records != 0 )
+			{
+				result = 1;
+			}
+			if( evtxtools_output_buffer_flush(
+			     export_handle->output_buffer,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		number_of_exported_records = number_of_records;
+	}
+	return( result );
+}
+
+/* Exports the offset of a carved record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_carved_record_offset(
+     export_handle_t *export_handle,
+     off64_t record_offset,
+     uint8_t record_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_carved_record_offset";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* In the XML format the offset is exported as a comment
+	 * so that the output remains valid XML
+	 */
+	if( export_handle->export_format == EXPORT_FORMAT_XML )
+	{
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "<!-- Carved record offset: ",
+		     27,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append carved record offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "Carved record offset\t\t: ",
+		     24,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append carved record offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( evtxtools_output_buffer_append_decimal(
+	     export_handle->output_buffer,
+	     (uint64_t) record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append carved record offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_flags & LIBEVTX_CARVED_RECORD_FLAG_IS_RECOVERED ) != 0 )
+	{
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     " (recovered)",
+		     12,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append carved record offset.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->export_format == EXPORT_FORMAT_XML )
+	{
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     " -->\n",
+		     5,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of comment.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		if( evtxtools_output_buffer_append_ascii_string(
+		     export_handle->output_buffer,
+		     "\n",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of line.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the records carved from a file or image, such as a disk image or memory dump
+ * The chunks are located by their signature, where each record is exported with its offset
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_carved_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevtx_carver_t *carver = NULL;
+	libevtx_record_t *record = NULL;
+	static char *function    = "export_handle_export_carved_file";
+	off64_t record_offset    = 0;
+	uint8_t record_flags     = 0;
+	int export_result        = 0;
+	int result               = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_set_message_handle_event_log_type(
+	     export_handle,
+	     export_handle->event_log_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event log type of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_initialize(
+	     &carver,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_set_ascii_codepage(
+	     carver,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in carver.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	/* The regions are carved by worker threads while the records are exported
+	 */
+	if( libevtx_carver_set_number_of_threads(
+	     carver,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set number of threads in carver.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevtx_carver_open_wide(
+	     carver,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevtx_carver_open(
+	     carver,
+	     filename,
+	     LIBEVTX_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open carver.",
+		 function );
+
+		goto on_error;
+	}
+	while( export_handle->abort == 0 )
+	{
+		result = libevtx_carver_get_next_record(
+		          carver,
+		          &record,
+		          &record_flags,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next carved record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( ( ( record_flags & LIBEVTX_CARVED_RECORD_FLAG_IS_RECOVERED ) == 0 )
+		 && ( export_handle->export_mode == EXPORT_MODE_RECOVERED ) )
+		{
+			result = 0;
+		}
+		else if( ( ( record_flags & LIBEVTX_CARVED_RECORD_FLAG_IS_RECOVERED ) != 0 )
+		      && ( export_handle->export_mode == EXPORT_MODE_ITEMS ) )
+		{
+			result = 0;
+		}
+		if( result != 0 )
+		{
+			export_result = 1;
+
+			if( libevtx_record_get_offset(
+			     record,
+			     &record_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( export_handle_export_carved_record_offset(
+			     export_handle,
+			     record_offset,
+			     record_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export carved record offset.",
+				 function );
+
+				goto on_error;
+			}
+			if( export_handle_export_record(
+			     export_handle,
+			     record,
+			     log_handle,
+			     error ) != 1 )
+			{
+				evtxtools_output_buffer_flush(
+				 export_handle->output_buffer,
+				 NULL );
+
+				fprintf(
+				 export_handle->notify_stream,
+				 "Unable to export record at offset: %" PRIi64 ".\n\n",
+				 record_offset );
+
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record at offset: %" PRIi64 ".",
+				 function,
+				 record_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+#endif
+				libcerror_error_free(
+				 error );
+			}
+		}
+		if( libevtx_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( export_handle->abort != 0 )
+	{
+		goto on_error;
+	}
+	if( evtxtools_output_buffer_flush(
+	     export_handle->output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_close(
+	     carver,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_free(
+	     &carver,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free carver.",
+		 function );
+
+		goto on_error;
+	}
+	return( export_result );
+
+on_error:
+	evtxtools_output_buffer_flush(
+	 export_handle->output_buffer,
+	 NULL );
+
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( carver != NULL )
+	{
+		libevtx_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( -1 );
 }
 
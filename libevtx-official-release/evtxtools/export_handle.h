@@ -26,12 +26,16 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "checkpoint_file.h"
+#include "evtxtools_filetime.h"
 #include "evtxtools_libcerror.h"
 #include "evtxtools_libevtx.h"
+#include "evtxtools_output.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "resource_file.h"
+#include "template_definition_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -50,6 +54,10 @@ enum EXPORT_FORMATS
 	EXPORT_FORMAT_XML			= (int) 'x'
 };
 
+/* The number of seconds to wait between refreshes of a followed file
+ */
+#define EXPORT_HANDLE_FOLLOW_INTERVAL		1
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -78,10 +86,18 @@ struct export_handle
 	 */
 	int use_template_definition;
 
+	/* The template definition cache
+	 */
+	template_definition_cache_t *template_definition_cache;
+
 	/* Value to indicate the input is open
 	 */
 	int input_is_open;
 
+	/* Value to indicate the input of the message handle is open
+	 */
+	int message_handle_input_is_open;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
@@ -90,6 +106,22 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The output buffer
+	 */
+	evtxtools_output_buffer_t *output_buffer;
+
+	/* The FILETIME formatter
+	 */
+	evtxtools_filetime_formatter_t *filetime_formatter;
+
+	/* The checkpoint file, which is set when the records are exported incrementally
+	 */
+	checkpoint_file_t *checkpoint_file;
+
+	/* The number of threads that decode the records of a chunk in parallel
+	 */
+	int number_of_decode_threads;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -127,6 +159,16 @@ int export_handle_set_export_format(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_date_time_format(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_number_of_decode_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_ascii_codepage(
      export_handle_t *export_handle,
      const system_character_t *string,
@@ -167,6 +209,17 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_set_message_handle_event_log_type(
+     export_handle_t *export_handle,
+     int event_log_type,
+     libcerror_error_t **error );
+
+int export_handle_open_file(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
@@ -176,6 +229,16 @@ int export_handle_close_input(
      export_handle_t *export_handle,
      libcerror_error_t **error );
 
+int export_handle_read_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_write_checkpoint_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 /* Record specific export functions
  */
 int export_handle_guid_string_copy_to_byte_stream(
@@ -233,6 +296,13 @@ int export_handle_export_record_xml(
 /* File export functions
  */
 int export_handle_export_records(
+     export_handle_t *export_handle,
+     libevtx_file_t *file,
+     int first_record_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_records_after_checkpoint(
      export_handle_t *export_handle,
      libevtx_file_t *file,
      log_handle_t *log_handle,
@@ -249,6 +319,35 @@ int export_handle_export_file(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_merged_files(
+     export_handle_t *export_handle,
+     system_character_t * const *filenames,
+     int number_of_filenames,
+     int event_log_type_from_filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+/* Follow export functions
+ */
+int export_handle_export_followed_file(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+/* Carve export functions
+ */
+int export_handle_export_carved_record_offset(
+     export_handle_t *export_handle,
+     off64_t record_offset,
+     uint8_t record_flags,
+     libcerror_error_t **error );
+
+int export_handle_export_carved_file(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,642 @@
+/*
+ * Input list
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evtxtools_libcdirectory.h"
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libcpath.h"
+#include "input_list.h"
+
+/* Creates an input list
+ * Make sure the value input_list is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int input_list_initialize(
+     input_list_t **input_list,
+     libcerror_error_t **error )
+{
+	static char *function = "input_list_initialize";
+
+	if( input_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_list != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid input list value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*input_list = memory_allocate_structure(
+	               input_list_t );
+
+	if( *input_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create input list.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *input_list,
+	     0,
+	     sizeof( input_list_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear input list.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *input_list != NULL )
+	{
+		memory_free(
+		 *input_list );
+
+		*input_list = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an input list
+ * Returns 1 if successful or -1 on error
+ */
+int input_list_free(
+     input_list_t **input_list,
+     libcerror_error_t **error )
+{
+	static char *function = "input_list_free";
+	int filename_index    = 0;
+
+	if( input_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input list.",
+		 function );
+
+		return( -1 );
+	}
+	if( *input_list != NULL )
+	{
+		if( ( *input_list )->filenames != NULL )
+		{
+			for( filename_index = 0;
+			     filename_index < ( *input_list )->number_of_filenames;
+			     filename_index++ )
+			{
+				memory_free(
+				 ( *input_list )->filenames[ filename_index ] );
+			}
+			memory_free(
+			 ( *input_list )->filenames );
+		}
+		memory_free(
+		 *input_list );
+
+		*input_list = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a filename to the input list
+ * The input list takes over the management of the filename, which must be
+ * allocated with memory_allocate
+ * Returns 1 if successful or -1 on error
+ */
+int input_list_append_filename(
+     input_list_t *input_list,
+     system_character_t *filename,
+     libcerror_error_t **error )
+{
+	system_character_t **filenames    = NULL;
+	static char *function             = "input_list_append_filename";
+	int number_of_allocated_filenames = 0;
+
+	if( input_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input list.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( input_list->number_of_filenames >= input_list->number_of_allocated_filenames )
+	{
+		number_of_allocated_filenames = input_list->number_of_allocated_filenames;
+
+		if( number_of_allocated_filenames == 0 )
+		{
+			number_of_allocated_filenames = 16;
+		}
+		else if( number_of_allocated_filenames < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_filenames *= 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of filenames value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		filenames = (system_character_t **) memory_reallocate(
+		                                     input_list->filenames,
+		                                     sizeof( system_character_t * ) * number_of_allocated_filenames );
+
+		if( filenames == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize filenames.",
+			 function );
+
+			return( -1 );
+		}
+		input_list->filenames                     = filenames;
+		input_list->number_of_allocated_filenames = number_of_allocated_filenames;
+	}
+	input_list->filenames[ input_list->number_of_filenames ] = filename;
+
+	input_list->number_of_filenames += 1;
+
+	return( 1 );
+}
+
+/* Appends the event log files in a directory to the input list
+ * The files with an .evtx extension are appended in name order
+ * Returns 1 if successful, 0 if the directory could not be opened or -1 on error
+ */
+int input_list_append_directory(
+     input_list_t *input_list,
+     const system_character_t *directory_name,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	system_character_t *filename                     = NULL;
+	system_character_t *previous_filename            = NULL;
+	static char *function                            = "input_list_append_directory";
+	size_t directory_entry_name_length               = 0;
+	size_t directory_name_length                     = 0;
+	size_t filename_size                             = 0;
+	uint8_t directory_entry_type                     = 0;
+	int filename_index                               = 0;
+	int first_filename_index                         = 0;
+	int result                                       = 0;
+
+	if( input_list == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid input list.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory name.",
+		 function );
+
+		return( -1 );
+	}
+	directory_name_length = system_string_length(
+	                         directory_name );
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  directory_name,
+		  NULL );
+#else
+	result = libcdirectory_directory_open(
+		  directory,
+		  directory_name,
+		  NULL );
+#endif
+	if( result != 1 )
+	{
+		/* The source is not a directory or cannot be opened as one
+		 */
+		if( libcdirectory_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	first_filename_index = input_list->number_of_filenames;
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+			  directory,
+			  directory_entry,
+			  error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+		if( directory_entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry name.",
+			 function );
+
+			goto on_error;
+		}
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( ( directory_entry_name_length <= 5 )
+		 || ( system_string_compare_no_case(
+		       &( directory_entry_name[ directory_entry_name_length - 5 ] ),
+		       _SYSTEM_STRING( ".evtx" ),
+		       5 ) != 0 ) )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &filename,
+			  &filename_size,
+			  directory_name,
+			  directory_name_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( input_list_append_filename(
+		     input_list,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append filename.",
+			 function );
+
+			goto on_error;
+		}
+		filename = NULL;
+
+		/* Insert the filename in name order with the other filenames of the directory
+		 */
+		for( filename_index = input_list->number_of_filenames - 1;
+		     filename_index > first_filename_index;
+		     filename_index-- )
+		{
+			previous_filename = input_list->filenames[ filename_index - 1 ];
+
+			if( system_string_compare(
+			     previous_filename,
+			     input_list->filenames[ filename_index ],
+			     system_string_length( previous_filename ) + 1 ) <= 0 )
+			{
+				break;
+			}
+			input_list->filenames[ filename_index - 1 ] = input_list->filenames[ filename_index ];
+			input_list->filenames[ filename_index ]     = previous_filename;
+		}
+	}
+	while( result != 0 );
+
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a source to the input list
+ * A source that is a directory is expanded into the event log files it contains
+ * Returns 1 if successful or -1 on error
+ */
+int input_list_append_source(
+     input_list_t *input_list,
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	system_character_t *filename = NULL;
+	static char *function        = "input_list_append_source";
+	size_t source_length         = 0;
+	int result                   = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	result = input_list_append_directory(
+	          input_list,
+	          source,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append directory.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+	filename = system_string_allocate(
+	            source_length + 1 );
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     filename,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy filename.",
+		 function );
+
+		goto on_error;
+	}
+	filename[ source_length ] = 0;
+
+	if( input_list_append_filename(
+	     input_list,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append filename.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( filename != NULL )
+	{
+		memory_free(
+		 filename );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Input list
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _INPUT_LIST_H )
+#define _INPUT_LIST_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct input_list input_list_t;
+
+struct input_list
+{
+	/* The filenames
+	 */
+	system_character_t **filenames;
+
+	/* The number of filenames
+	 */
+	int number_of_filenames;
+
+	/* The number of allocated filenames
+	 */
+	int number_of_allocated_filenames;
+};
+
+int input_list_initialize(
+     input_list_t **input_list,
+     libcerror_error_t **error );
+
+int input_list_free(
+     input_list_t **input_list,
+     libcerror_error_t **error );
+
+int input_list_append_filename(
+     input_list_t *input_list,
+     system_character_t *filename,
+     libcerror_error_t **error );
+
+int input_list_append_directory(
+     input_list_t *input_list,
+     const system_character_t *directory_name,
+     libcerror_error_t **error );
+
+int input_list_append_source(
+     input_list_t *input_list,
+     const system_character_t *source,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _INPUT_LIST_H ) */
+
@@ -0,0 +1,1308 @@
+/*
+ * Instrumentation manifest index
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libfwevt.h"
+#include "manifest_index.h"
+
+/* Calculates the hash of a 32-bit key
+ * Returns the hash
+ */
+uint32_t manifest_index_get_key_hash(
+          uint32_t key )
+{
+	key ^= key >> 16;
+	key *= 0x7feb352dUL;
+	key ^= key >> 15;
+	key *= 0x846ca68bUL;
+	key ^= key >> 16;
+
+	return( key );
+}
+
+/* Creates a values hash table
+ * The number of buckets is a power of 2 of at least the number of values
+ * Make sure the value values_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_values_table_initialize(
+     manifest_index_value_t ***values_table,
+     uint32_t *values_table_size,
+     int number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function      = "manifest_index_values_table_initialize";
+	uint32_t safe_table_size   = 16;
+
+	if( values_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *values_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid values table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_table_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_values < 0 )
+	 || ( number_of_values > (int) ( (uint32_t) 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	while( safe_table_size < (uint32_t) number_of_values )
+	{
+		safe_table_size <<= 1;
+	}
+	*values_table = (manifest_index_value_t **) memory_allocate(
+	                                             sizeof( manifest_index_value_t * ) * safe_table_size );
+
+	if( *values_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create values table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *values_table,
+	     0,
+	     sizeof( manifest_index_value_t * ) * safe_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear values table.",
+		 function );
+
+		goto on_error;
+	}
+	*values_table_size = safe_table_size;
+
+	return( 1 );
+
+on_error:
+	if( *values_table != NULL )
+	{
+		memory_free(
+		 *values_table );
+
+		*values_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a values hash table
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_values_table_free(
+     manifest_index_value_t ***values_table,
+     uint32_t values_table_size,
+     libcerror_error_t **error )
+{
+	manifest_index_value_t *index_value = NULL;
+	static char *function               = "manifest_index_values_table_free";
+	uint32_t table_index                = 0;
+
+	if( values_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *values_table != NULL )
+	{
+		for( table_index = 0;
+		     table_index < values_table_size;
+		     table_index++ )
+		{
+			while( ( *values_table )[ table_index ] != NULL )
+			{
+				index_value = ( *values_table )[ table_index ];
+
+				( *values_table )[ table_index ] = index_value->next_value;
+
+				memory_free(
+				 index_value );
+			}
+		}
+		memory_free(
+		 *values_table );
+
+		*values_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends a value to a values hash table
+ * The value is added to the end of its bucket so that the first value
+ * appended for a specific key is the one that is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_values_table_append_value(
+     manifest_index_value_t **values_table,
+     uint32_t values_table_size,
+     uint32_t key,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	manifest_index_value_t *index_value = NULL;
+	manifest_index_value_t *last_value  = NULL;
+	static char *function               = "manifest_index_values_table_append_value";
+	uint32_t table_index                = 0;
+
+	if( values_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid values table.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_table_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid values table size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	index_value = memory_allocate_structure(
+	               manifest_index_value_t );
+
+	if( index_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index value.",
+		 function );
+
+		return( -1 );
+	}
+	index_value->key        = key;
+	index_value->value      = value;
+	index_value->next_value = NULL;
+
+	table_index = manifest_index_get_key_hash(
+	               key ) & ( values_table_size - 1 );
+
+	if( values_table[ table_index ] == NULL )
+	{
+		values_table[ table_index ] = index_value;
+	}
+	else
+	{
+		last_value = values_table[ table_index ];
+
+		while( last_value->next_value != NULL )
+		{
+			last_value = last_value->next_value;
+		}
+		last_value->next_value = index_value;
+	}
+	return( 1 );
+}
+
+/* Retrieves a value by key from a values hash table
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int manifest_index_values_table_get_value_by_key(
+     manifest_index_value_t **values_table,
+     uint32_t values_table_size,
+     uint32_t key,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	manifest_index_value_t *index_value = NULL;
+	static char *function               = "manifest_index_values_table_get_value_by_key";
+
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	*value = NULL;
+
+	if( ( values_table == NULL )
+	 || ( values_table_size == 0 ) )
+	{
+		return( 0 );
+	}
+	index_value = values_table[ manifest_index_get_key_hash( key ) & ( values_table_size - 1 ) ];
+
+	while( index_value != NULL )
+	{
+		if( index_value->key == key )
+		{
+			*value = index_value->value;
+
+			return( 1 );
+		}
+		index_value = index_value->next_value;
+	}
+	return( 0 );
+}
+
+/* Creates a manifest index
+ * Make sure the value manifest_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_initialize(
+     manifest_index_t **manifest_index,
+     libcerror_error_t **error )
+{
+	static char *function = "manifest_index_initialize";
+
+	if( manifest_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*manifest_index = memory_allocate_structure(
+	                   manifest_index_t );
+
+	if( *manifest_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *manifest_index,
+	     0,
+	     sizeof( manifest_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *manifest_index != NULL )
+	{
+		memory_free(
+		 *manifest_index );
+
+		*manifest_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a manifest index
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_free(
+     manifest_index_t **manifest_index,
+     libcerror_error_t **error )
+{
+	manifest_index_provider_t *index_provider = NULL;
+	static char *function                     = "manifest_index_free";
+	uint32_t table_index                      = 0;
+	int result                                = 1;
+
+	if( manifest_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest_index != NULL )
+	{
+		if( ( *manifest_index )->providers_table != NULL )
+		{
+			for( table_index = 0;
+			     table_index < ( *manifest_index )->providers_table_size;
+			     table_index++ )
+			{
+				while( ( *manifest_index )->providers_table[ table_index ] != NULL )
+				{
+					index_provider = ( *manifest_index )->providers_table[ table_index ];
+
+					( *manifest_index )->providers_table[ table_index ] = index_provider->next_provider;
+
+					if( manifest_index_provider_free(
+					     &index_provider,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free index provider.",
+						 function );
+
+						result = -1;
+					}
+				}
+			}
+			memory_free(
+			 ( *manifest_index )->providers_table );
+		}
+		memory_free(
+		 *manifest_index );
+
+		*manifest_index = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a provider identifier
+ * Returns the hash
+ */
+uint32_t manifest_index_get_provider_identifier_hash(
+          const uint8_t *provider_identifier )
+{
+	uint32_t identifier_hash = 0;
+	uint32_t value_32bit     = 0;
+	uint8_t byte_index       = 0;
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( provider_identifier[ byte_index ] ),
+		 value_32bit );
+
+		identifier_hash ^= value_32bit;
+	}
+	return( manifest_index_get_key_hash(
+	         identifier_hash ) );
+}
+
+/* Reads the providers of a manifest into the index
+ * The events and templates of a provider are indexed on first access
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_read_manifest(
+     manifest_index_t *manifest_index,
+     libfwevt_manifest_t *manifest,
+     libcerror_error_t **error )
+{
+	manifest_index_provider_t *index_provider = NULL;
+	manifest_index_provider_t *last_provider  = NULL;
+	libfwevt_provider_t *provider             = NULL;
+	static char *function                     = "manifest_index_read_manifest";
+	uint32_t table_index                      = 0;
+	int number_of_providers                   = 0;
+	int provider_index                        = 0;
+
+	if( manifest_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest index.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest_index->providers_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest index - providers table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_manifest_get_number_of_providers(
+	     manifest,
+	     &number_of_providers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of providers.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_providers < 0 )
+	 || ( number_of_providers > (int) ( (uint32_t) 1 << 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of providers value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	manifest_index->providers_table_size = 16;
+
+	while( manifest_index->providers_table_size < (uint32_t) number_of_providers )
+	{
+		manifest_index->providers_table_size <<= 1;
+	}
+	manifest_index->providers_table = (manifest_index_provider_t **) memory_allocate(
+	                                                                  sizeof( manifest_index_provider_t * ) * manifest_index->providers_table_size );
+
+	if( manifest_index->providers_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create providers table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     manifest_index->providers_table,
+	     0,
+	     sizeof( manifest_index_provider_t * ) * manifest_index->providers_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear providers table.",
+		 function );
+
+		goto on_error;
+	}
+	for( provider_index = 0;
+	     provider_index < number_of_providers;
+	     provider_index++ )
+	{
+		if( libfwevt_manifest_get_provider_by_index(
+		     manifest,
+		     provider_index,
+		     &provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider: %d.",
+			 function,
+			 provider_index );
+
+			goto on_error;
+		}
+		if( manifest_index_provider_initialize(
+		     &index_provider,
+		     provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create index provider: %d.",
+			 function,
+			 provider_index );
+
+			goto on_error;
+		}
+		provider = NULL;
+
+		/* The provider is added to the end of its bucket so that the first
+		 * provider in the manifest with a specific identifier is retrieved
+		 */
+		table_index = manifest_index_get_provider_identifier_hash(
+		               index_provider->identifier ) & ( manifest_index->providers_table_size - 1 );
+
+		if( manifest_index->providers_table[ table_index ] == NULL )
+		{
+			manifest_index->providers_table[ table_index ] = index_provider;
+		}
+		else
+		{
+			last_provider = manifest_index->providers_table[ table_index ];
+
+			while( last_provider->next_provider != NULL )
+			{
+				last_provider = last_provider->next_provider;
+			}
+			last_provider->next_provider = index_provider;
+		}
+		index_provider = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( index_provider != NULL )
+	{
+		manifest_index_provider_free(
+		 &index_provider,
+		 NULL );
+	}
+	if( manifest_index->providers_table != NULL )
+	{
+		for( table_index = 0;
+		     table_index < manifest_index->providers_table_size;
+		     table_index++ )
+		{
+			while( manifest_index->providers_table[ table_index ] != NULL )
+			{
+				index_provider = manifest_index->providers_table[ table_index ];
+
+				manifest_index->providers_table[ table_index ] = index_provider->next_provider;
+
+				manifest_index_provider_free(
+				 &index_provider,
+				 NULL );
+			}
+		}
+		memory_free(
+		 manifest_index->providers_table );
+
+		manifest_index->providers_table = NULL;
+	}
+	manifest_index->providers_table_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific provider by identifier (GUID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int manifest_index_get_provider_by_identifier(
+     manifest_index_t *manifest_index,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     manifest_index_provider_t **index_provider,
+     libcerror_error_t **error )
+{
+	manifest_index_provider_t *safe_index_provider = NULL;
+	static char *function                          = "manifest_index_get_provider_by_identifier";
+	uint32_t table_index                           = 0;
+
+	if( manifest_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest index.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	*index_provider = NULL;
+
+	if( manifest_index->providers_table == NULL )
+	{
+		return( 0 );
+	}
+	table_index = manifest_index_get_provider_identifier_hash(
+	               provider_identifier ) & ( manifest_index->providers_table_size - 1 );
+
+	safe_index_provider = manifest_index->providers_table[ table_index ];
+
+	while( safe_index_provider != NULL )
+	{
+		if( memory_compare(
+		     safe_index_provider->identifier,
+		     provider_identifier,
+		     16 ) == 0 )
+		{
+			*index_provider = safe_index_provider;
+
+			return( 1 );
+		}
+		safe_index_provider = safe_index_provider->next_provider;
+	}
+	return( 0 );
+}
+
+/* Creates an index provider
+ * Make sure the value index_provider is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_provider_initialize(
+     manifest_index_provider_t **index_provider,
+     libfwevt_provider_t *provider,
+     libcerror_error_t **error )
+{
+	static char *function = "manifest_index_provider_initialize";
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_provider != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index provider value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	*index_provider = memory_allocate_structure(
+	                   manifest_index_provider_t );
+
+	if( *index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index provider.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *index_provider,
+	     0,
+	     sizeof( manifest_index_provider_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index provider.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_provider_get_identifier(
+	     provider,
+	     ( *index_provider )->identifier,
+	     16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve provider identifier.",
+		 function );
+
+		goto on_error;
+	}
+	( *index_provider )->provider = provider;
+
+	return( 1 );
+
+on_error:
+	if( *index_provider != NULL )
+	{
+		memory_free(
+		 *index_provider );
+
+		*index_provider = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an index provider
+ * The provider itself is managed by the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_provider_free(
+     manifest_index_provider_t **index_provider,
+     libcerror_error_t **error )
+{
+	static char *function = "manifest_index_provider_free";
+	int result            = 1;
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_provider != NULL )
+	{
+		if( manifest_index_values_table_free(
+		     &( ( *index_provider )->events_table ),
+		     ( *index_provider )->events_table_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free events table.",
+			 function );
+
+			result = -1;
+		}
+		if( manifest_index_values_table_free(
+		     &( ( *index_provider )->templates_table ),
+		     ( *index_provider )->templates_table_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free templates table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *index_provider );
+
+		*index_provider = NULL;
+	}
+	return( result );
+}
+
+/* Reads the events of the provider into the events hash table
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_provider_read_events(
+     manifest_index_provider_t *index_provider,
+     libcerror_error_t **error )
+{
+	libfwevt_event_t *event  = NULL;
+	static char *function    = "manifest_index_provider_read_events";
+	uint32_t identifier      = 0;
+	int event_index          = 0;
+	int number_of_events     = 0;
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_provider->events_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index provider - events table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_get_number_of_events(
+	     index_provider->provider,
+	     &number_of_events,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of events.",
+		 function );
+
+		goto on_error;
+	}
+	if( manifest_index_values_table_initialize(
+	     &( index_provider->events_table ),
+	     &( index_provider->events_table_size ),
+	     number_of_events,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create events table.",
+		 function );
+
+		goto on_error;
+	}
+	for( event_index = 0;
+	     event_index < number_of_events;
+	     event_index++ )
+	{
+		if( libfwevt_provider_get_event_by_index(
+		     index_provider->provider,
+		     event_index,
+		     &event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( libfwevt_event_get_identifier(
+		     event,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event: %d identifier.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		if( manifest_index_values_table_append_value(
+		     index_provider->events_table,
+		     index_provider->events_table_size,
+		     identifier,
+		     (intptr_t *) event,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event: %d to table.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
+		event = NULL;
+	}
+	return( 1 );
+
+on_error:
+	manifest_index_values_table_free(
+	 &( index_provider->events_table ),
+	 index_provider->events_table_size,
+	 NULL );
+
+	index_provider->events_table_size = 0;
+
+	return( -1 );
+}
+
+/* Reads the templates of the provider into the templates hash table
+ * Returns 1 if successful or -1 on error
+ */
+int manifest_index_provider_read_templates(
+     manifest_index_provider_t *index_provider,
+     libcerror_error_t **error )
+{
+	libfwevt_template_t *wevt_template = NULL;
+	static char *function              = "manifest_index_provider_read_templates";
+	uint32_t template_offset           = 0;
+	int number_of_templates            = 0;
+	int template_index                 = 0;
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_provider->templates_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index provider - templates table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_get_number_of_templates(
+	     index_provider->provider,
+	     &number_of_templates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of templates.",
+		 function );
+
+		goto on_error;
+	}
+	if( manifest_index_values_table_initialize(
+	     &( index_provider->templates_table ),
+	     &( index_provider->templates_table_size ),
+	     number_of_templates,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create templates table.",
+		 function );
+
+		goto on_error;
+	}
+	for( template_index = 0;
+	     template_index < number_of_templates;
+	     template_index++ )
+	{
+		if( libfwevt_provider_get_template_by_index(
+		     index_provider->provider,
+		     template_index,
+		     &wevt_template,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template: %d.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( libfwevt_template_get_offset(
+		     wevt_template,
+		     &template_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template: %d offset.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( manifest_index_values_table_append_value(
+		     index_provider->templates_table,
+		     index_provider->templates_table_size,
+		     template_offset,
+		     (intptr_t *) wevt_template,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append template: %d to table.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		wevt_template = NULL;
+	}
+	return( 1 );
+
+on_error:
+	manifest_index_values_table_free(
+	 &( index_provider->templates_table ),
+	 index_provider->templates_table_size,
+	 NULL );
+
+	index_provider->templates_table_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific event by identifier
+ * The events table is read on first access
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int manifest_index_provider_get_event_by_identifier(
+     manifest_index_provider_t *index_provider,
+     uint32_t event_identifier,
+     libfwevt_event_t **event,
+     libcerror_error_t **error )
+{
+	static char *function = "manifest_index_provider_get_event_by_identifier";
+	int result            = 0;
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_provider->events_table == NULL )
+	{
+		if( manifest_index_provider_read_events(
+		     index_provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read events.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = manifest_index_values_table_get_value_by_key(
+	          index_provider->events_table,
+	          index_provider->events_table_size,
+	          event_identifier,
+	          (intptr_t **) event,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event: 0x%08" PRIx32 " from table.",
+		 function,
+		 event_identifier );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific template by offset
+ * The templates table is read on first access
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int manifest_index_provider_get_template_by_offset(
+     manifest_index_provider_t *index_provider,
+     uint32_t template_offset,
+     libfwevt_template_t **wevt_template,
+     libcerror_error_t **error )
+{
+	static char *function = "manifest_index_provider_get_template_by_offset";
+	int result            = 0;
+
+	if( index_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index provider.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_provider->templates_table == NULL )
+	{
+		if( manifest_index_provider_read_templates(
+		     index_provider,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read templates.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	result = manifest_index_values_table_get_value_by_key(
+	          index_provider->templates_table,
+	          index_provider->templates_table_size,
+	          template_offset,
+	          (intptr_t **) wevt_template,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template at offset: 0x%08" PRIx32 " from table.",
+		 function,
+		 template_offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,188 @@
+/*
+ * Instrumentation manifest index
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MANIFEST_INDEX_H )
+#define _MANIFEST_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libfwevt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct manifest_index_value manifest_index_value_t;
+
+struct manifest_index_value
+{
+	/* The key
+	 */
+	uint32_t key;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The next value in the hash bucket
+	 */
+	manifest_index_value_t *next_value;
+};
+
+typedef struct manifest_index_provider manifest_index_provider_t;
+
+struct manifest_index_provider
+{
+	/* The (provider) identifier
+	 * Contains a GUID
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The provider
+	 */
+	libfwevt_provider_t *provider;
+
+	/* The events hash table
+	 * The key is the event identifier
+	 * The table is read on first access
+	 */
+	manifest_index_value_t **events_table;
+
+	/* The number of buckets in the events hash table
+	 */
+	uint32_t events_table_size;
+
+	/* The templates hash table
+	 * The key is the template offset
+	 * The table is read on first access
+	 */
+	manifest_index_value_t **templates_table;
+
+	/* The number of buckets in the templates hash table
+	 */
+	uint32_t templates_table_size;
+
+	/* The next provider in the hash bucket
+	 */
+	manifest_index_provider_t *next_provider;
+};
+
+typedef struct manifest_index manifest_index_t;
+
+struct manifest_index
+{
+	/* The providers hash table
+	 */
+	manifest_index_provider_t **providers_table;
+
+	/* The number of buckets in the providers hash table
+	 */
+	uint32_t providers_table_size;
+};
+
+uint32_t manifest_index_get_key_hash(
+          uint32_t key );
+
+int manifest_index_values_table_initialize(
+     manifest_index_value_t ***values_table,
+     uint32_t *values_table_size,
+     int number_of_values,
+     libcerror_error_t **error );
+
+int manifest_index_values_table_free(
+     manifest_index_value_t ***values_table,
+     uint32_t values_table_size,
+     libcerror_error_t **error );
+
+int manifest_index_values_table_append_value(
+     manifest_index_value_t **values_table,
+     uint32_t values_table_size,
+     uint32_t key,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int manifest_index_values_table_get_value_by_key(
+     manifest_index_value_t **values_table,
+     uint32_t values_table_size,
+     uint32_t key,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int manifest_index_initialize(
+     manifest_index_t **manifest_index,
+     libcerror_error_t **error );
+
+int manifest_index_free(
+     manifest_index_t **manifest_index,
+     libcerror_error_t **error );
+
+uint32_t manifest_index_get_provider_identifier_hash(
+          const uint8_t *provider_identifier );
+
+int manifest_index_read_manifest(
+     manifest_index_t *manifest_index,
+     libfwevt_manifest_t *manifest,
+     libcerror_error_t **error );
+
+int manifest_index_get_provider_by_identifier(
+     manifest_index_t *manifest_index,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     manifest_index_provider_t **index_provider,
+     libcerror_error_t **error );
+
+int manifest_index_provider_initialize(
+     manifest_index_provider_t **index_provider,
+     libfwevt_provider_t *provider,
+     libcerror_error_t **error );
+
+int manifest_index_provider_free(
+     manifest_index_provider_t **index_provider,
+     libcerror_error_t **error );
+
+int manifest_index_provider_read_events(
+     manifest_index_provider_t *index_provider,
+     libcerror_error_t **error );
+
+int manifest_index_provider_read_templates(
+     manifest_index_provider_t *index_provider,
+     libcerror_error_t **error );
+
+int manifest_index_provider_get_event_by_identifier(
+     manifest_index_provider_t *index_provider,
+     uint32_t event_identifier,
+     libfwevt_event_t **event,
+     libcerror_error_t **error );
+
+int manifest_index_provider_get_template_by_offset(
+     manifest_index_provider_t *index_provider,
+     uint32_t template_offset,
+     libfwevt_template_t **wevt_template,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MANIFEST_INDEX_H ) */
+
@@ -1257,11 +1257,9 @@ int message_handle_open_system_registry_file(
      const char *eventlog_key_name,
      libcerror_error_t **error )
 {
-	libregf_key_t *sub_key              = NULL;
 	system_character_t *key_path        = NULL;
 	system_character_t *system_filename = NULL;
 	static char *function               = "message_handle_open_system_registry_file";
-	size_t eventlog_key_name_length     = 0;
 	size_t key_path_length              = 0;
 	int result                          = 0;
 
@@ -1287,9 +1285,6 @@ int message_handle_open_system_registry_file(
 
 		return( -1 );
 	}
-	eventlog_key_name_length = narrow_string_length(
-	                            eventlog_key_name );
-
 	if( ( message_handle->system_registry_filename == NULL )
 	 && ( message_handle->registry_directory_name != NULL ) )
 	{
@@ -1451,6 +1446,110 @@ int message_handle_open_system_registry_file(
 
 		goto on_error;
 	}
+	if( message_handle_set_eventlog_key_name(
+	     message_handle,
+	     eventlog_key_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set eventlog key name.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( system_filename != NULL )
+	{
+		memory_free(
+		 system_filename );
+	}
+	return( -1 );
+}
+
+/* Sets the eventlog key name
+ * The eventlog services keys of the eventlog key name are retrieved from the SYSTEM
+ * Windows Registry file if open, which allows to change the eventlog key name
+ * without reopening the input
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_eventlog_key_name(
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key          = NULL;
+	system_character_t *key_path    = NULL;
+	static char *function           = "message_handle_set_eventlog_key_name";
+	size_t eventlog_key_name_length = 0;
+	size_t key_path_length          = 0;
+	int result                      = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	eventlog_key_name_length = narrow_string_length(
+	                            eventlog_key_name );
+
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
+	{
+		if( libregf_key_free(
+		     &( message_handle->control_set_1_eventlog_services_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 1 eventlog services key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle->control_set_2_eventlog_services_key != NULL )
+	{
+		if( libregf_key_free(
+		     &( message_handle->control_set_2_eventlog_services_key ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free control set 2 eventlog services key.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle->system_registry_file == NULL )
+	{
+		return( 1 );
+	}
 	/* Get the control set 1 eventlog services key:
 	 * SYSTEM\ControlSet001\Services\Eventlog
 	 */
@@ -1584,11 +1683,6 @@ on_error:
 		 &sub_key,
 		 NULL );
 	}
-	if( system_filename != NULL )
-	{
-		memory_free(
-		 system_filename );
-	}
 	return( -1 );
 }
 
@@ -194,6 +194,11 @@ int message_handle_open_system_registry_file(
      const char *eventlog_key_name,
      libcerror_error_t **error );
 
+int message_handle_set_eventlog_key_name(
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
 int message_handle_open_input(
      message_handle_t *message_handle,
      const char *eventlog_key_name,
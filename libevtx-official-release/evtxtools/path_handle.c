@@ -26,10 +26,27 @@
 #include <types.h>
 #include <wide_string.h>
 
+#if defined( HAVE_WCTYPE_H ) && defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#include <wctype.h>
+#else
+#include <ctype.h>
+#endif
+
 #include "evtxtools_libcdirectory.h"
 #include "evtxtools_libcerror.h"
 #include "path_handle.h"
 
+/* The case folding of the name hash and the caseless name comparison
+ * must match, otherwise caseless matches end up in different buckets
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define path_handle_fold_character( character ) \
+	(uint32_t) towlower( (wint_t) character )
+#else
+#define path_handle_fold_character( character ) \
+	(uint32_t) tolower( (int) ( (uint8_t) character ) )
+#endif
+
 /* Creates a path handle
  * Make sure the value path_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -110,8 +127,10 @@ int path_handle_free(
      path_handle_t **path_handle,
      libcerror_error_t **error )
 {
-	static char *function = "path_handle_free";
-	int result            = 1;
+	path_handle_directory_t *directory = NULL;
+	static char *function              = "path_handle_free";
+	int table_index                    = 0;
+	int result                         = 1;
 
 	if( path_handle == NULL )
 	{
@@ -126,6 +145,31 @@ int path_handle_free(
 	}
 	if( *path_handle != NULL )
 	{
+		for( table_index = 0;
+		     table_index < PATH_HANDLE_DIRECTORIES_TABLE_SIZE;
+		     table_index++ )
+		{
+			while( ( *path_handle )->directories_table[ table_index ] != NULL )
+			{
+				directory = ( *path_handle )->directories_table[ table_index ];
+
+				( *path_handle )->directories_table[ table_index ] = directory->next_directory;
+
+				if( path_handle_directory_free(
+				     &directory,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free directory.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
 		if( ( *path_handle )->system_root_path != NULL )
 		{
 			memory_free(
@@ -139,84 +183,304 @@ int path_handle_free(
 	return( result );
 }
 
-/* Retrieves the name of a directory entry by name ignoring case
- * If a corresponding entry is found entry name is update
- * This function is needed to find case insensitive directory entries on a case sensitive system
- * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+/* Calculates the case folded hash of a name
+ * Returns the hash
  */
-int path_handle_get_directory_entry_name_by_name_no_case(
-     path_handle_t *path_handle,
+uint32_t path_handle_get_name_hash(
+          const system_character_t *name,
+          size_t name_length )
+{
+	size_t name_index  = 0;
+	uint32_t name_hash = 0;
+
+	if( name == NULL )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		name_hash *= 37;
+		name_hash += path_handle_fold_character(
+		              name[ name_index ] );
+	}
+	return( name_hash );
+}
+
+/* Compares two names without case, using the case folding of the name hash
+ * Returns 1 if the names match or 0 if not
+ */
+int path_handle_compare_name_no_case(
+     const system_character_t *first_name,
+     const system_character_t *second_name,
+     size_t name_length )
+{
+	size_t name_index = 0;
+
+	if( ( first_name == NULL )
+	 || ( second_name == NULL ) )
+	{
+		return( 0 );
+	}
+	for( name_index = 0;
+	     name_index < name_length;
+	     name_index++ )
+	{
+		if( path_handle_fold_character( first_name[ name_index ] ) != path_handle_fold_character( second_name[ name_index ] ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates a directory
+ * Make sure the value directory is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_initialize(
+     path_handle_directory_t **directory,
      const system_character_t *path,
      size_t path_length,
-     system_character_t *entry_name,
-     size_t entry_name_size,
-     uint8_t entry_type,
+     uint32_t path_hash,
      libcerror_error_t **error )
 {
-	libcdirectory_directory_t *directory             = NULL;
-	libcdirectory_directory_entry_t *directory_entry = NULL;
-	system_character_t *directory_entry_name         = NULL;
-	static char *function                            = "path_handle_get_directory_entry_name_by_name_no_case";
-	size_t directory_entry_name_length               = 0;
-	int result                                       = 0;
+	static char *function = "path_handle_directory_initialize";
 
-	if( path_handle == NULL )
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid path handle.",
+		 "%s: invalid directory.",
 		 function );
 
 		return( -1 );
 	}
-	if( path_length > (size_t) SSIZE_MAX )
+	if( *directory != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid path length value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	if( path == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid path.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name_size > (size_t) SSIZE_MAX )
+	if( ( path_length == 0 )
+	 || ( path_length > (size_t) ( SSIZE_MAX - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid entry name size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid path length value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( entry_name == NULL )
+	*directory = memory_allocate_structure(
+	              path_handle_directory_t );
+
+	if( *directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *directory,
+	     0,
+	     sizeof( path_handle_directory_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear directory.",
+		 function );
+
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+
+		return( -1 );
+	}
+	( *directory )->path = system_string_allocate(
+	                        path_length + 1 );
+
+	if( ( *directory )->path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *directory )->path,
+	     path,
+	     path_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy path.",
+		 function );
+
+		goto on_error;
+	}
+	( *directory )->path[ path_length ] = 0;
+
+	( *directory )->path_length = path_length;
+	( *directory )->path_hash   = path_hash;
+
+	return( 1 );
+
+on_error:
+	if( *directory != NULL )
+	{
+		if( ( *directory )->path != NULL )
+		{
+			memory_free(
+			 ( *directory )->path );
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a directory
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_free(
+     path_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	path_handle_directory_entry_t *entry = NULL;
+	static char *function                = "path_handle_directory_free";
+	uint32_t table_index                 = 0;
+
+	if( directory == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid entry name.",
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( *directory != NULL )
+	{
+		if( ( *directory )->entries_table != NULL )
+		{
+			for( table_index = 0;
+			     table_index < ( *directory )->entries_table_size;
+			     table_index++ )
+			{
+				while( ( *directory )->entries_table[ table_index ] != NULL )
+				{
+					entry = ( *directory )->entries_table[ table_index ];
+
+					( *directory )->entries_table[ table_index ] = entry->next_entry;
+
+					memory_free(
+					 entry->name );
+
+					memory_free(
+					 entry );
+				}
+			}
+			memory_free(
+			 ( *directory )->entries_table );
+		}
+		if( ( *directory )->path != NULL )
+		{
+			memory_free(
+			 ( *directory )->path );
+		}
+		memory_free(
+		 *directory );
+
+		*directory = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads the entries of a directory into the entries hash table
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_directory_read_entries(
+     path_handle_directory_t *directory,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *cdirectory            = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	path_handle_directory_entry_t *entries_list      = NULL;
+	path_handle_directory_entry_t *entry             = NULL;
+	path_handle_directory_entry_t *last_entry        = NULL;
+	path_handle_directory_entry_t *table_entry       = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	static char *function                            = "path_handle_directory_read_entries";
+	size_t directory_entry_name_length               = 0;
+	uint32_t number_of_entries                       = 0;
+	uint32_t table_index                             = 0;
+	uint8_t directory_entry_type                     = 0;
+	int result                                       = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory->entries_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid directory - entries table value already set.",
 		 function );
 
 		return( -1 );
 	}
 	if( libcdirectory_directory_initialize(
-	     &directory,
+	     &cdirectory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -230,13 +494,13 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 	}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 	result = libcdirectory_directory_open_wide(
-		  directory,
-		  path,
+		  cdirectory,
+		  directory->path,
 		  error );
 #else
 	result = libcdirectory_directory_open(
-		  directory,
-		  path,
+		  cdirectory,
+		  directory->path,
 		  error );
 #endif
 	if( result != 1 )
@@ -247,7 +511,7 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
 		 "%s: unable to open directory: %" PRIs_SYSTEM ".",
 		 function,
-		 path );
+		 directory->path );
 
 		goto on_error;
 	}
@@ -264,39 +528,45 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 
 		goto on_error;
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libcdirectory_directory_has_entry_wide(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#else
-	result = libcdirectory_directory_has_entry(
-		  directory,
-		  directory_entry,
-		  entry_name,
-		  entry_name_size - 1,
-		  entry_type,
-		  LIBCDIRECTORY_COMPARE_FLAG_NO_CASE,
-		  error );
-#endif
-	if( result == -1 )
+	/* The entries are first collected in directory order so that the
+	 * hash table buckets can be sized to the number of entries
+	 */
+	do
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_GENERIC,
-		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
-		 function,
-		 entry_name );
+		result = libcdirectory_directory_read_entry(
+			  cdirectory,
+			  directory_entry,
+			  error );
 
-		goto on_error;
-	}
-	else if( result != 0 )
-	{
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		result = libcdirectory_directory_entry_get_name_wide(
 			  directory_entry,
@@ -320,34 +590,82 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 			goto on_error;
 		}
 		directory_entry_name_length = system_string_length(
-					       directory_entry_name );
+		                               directory_entry_name );
 
-		if( ( directory_entry_name_length + 1 ) != entry_name_size )
+		entry = memory_allocate_structure(
+		         path_handle_directory_entry_t );
+
+		if( entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: entry name length value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		entry->name = system_string_allocate(
+		               directory_entry_name_length + 1 );
+
+		if( entry->name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entry name.",
 			 function );
 
+			memory_free(
+			 entry );
+
 			goto on_error;
 		}
 		if( system_string_copy(
-		     entry_name,
+		     entry->name,
 		     directory_entry_name,
 		     directory_entry_name_length ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set entry name.",
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy entry name.",
 			 function );
 
+			memory_free(
+			 entry->name );
+
+			memory_free(
+			 entry );
+
 			goto on_error;
 		}
+		entry->name[ directory_entry_name_length ] = 0;
+
+		entry->name_length = directory_entry_name_length;
+		entry->name_hash   = path_handle_get_name_hash(
+		                      entry->name,
+		                      entry->name_length );
+		entry->type        = directory_entry_type;
+		entry->next_entry  = NULL;
+
+		if( last_entry == NULL )
+		{
+			entries_list = entry;
+		}
+		else
+		{
+			last_entry->next_entry = entry;
+		}
+		last_entry = entry;
+
+		number_of_entries++;
 	}
+	while( result != 0 );
+
 	if( libcdirectory_directory_entry_free(
 	     &directory_entry,
 	     error ) != 1 )
@@ -362,7 +680,7 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 		goto on_error;
 	}
 	if( libcdirectory_directory_close(
-	     directory,
+	     cdirectory,
 	     error ) != 0 )
 	{
 		libcerror_error_set(
@@ -375,7 +693,7 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 		goto on_error;
 	}
 	if( libcdirectory_directory_free(
-	     &directory,
+	     &cdirectory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -387,21 +705,490 @@ int path_handle_get_directory_entry_name_by_name_no_case(
 
 		goto on_error;
 	}
-	return( result );
+	/* The number of buckets is a power of 2 of at least the number of entries
+	 */
+	directory->entries_table_size = 16;
 
-on_error:
-	if( directory_entry != NULL )
+	while( ( directory->entries_table_size < number_of_entries )
+	    && ( directory->entries_table_size < ( (uint32_t) 1 << 24 ) ) )
 	{
-		libcdirectory_directory_entry_free(
-		 &directory_entry,
-		 NULL );
+		directory->entries_table_size <<= 1;
 	}
-	if( directory != NULL )
+	directory->entries_table = (path_handle_directory_entry_t **) memory_allocate(
+	                                                               sizeof( path_handle_directory_entry_t * ) * directory->entries_table_size );
+
+	if( directory->entries_table == NULL )
 	{
-		libcdirectory_directory_free(
-		 &directory,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries table.",
+		 function );
+
+		goto on_error;
 	}
-	return( -1 );
+	if( memory_set(
+	     directory->entries_table,
+	     0,
+	     sizeof( path_handle_directory_entry_t * ) * directory->entries_table_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries table.",
+		 function );
+
+		goto on_error;
+	}
+	/* Append the entries to the end of their bucket to preserve directory order
+	 * which determines which caseless match takes precedence
+	 */
+	while( entries_list != NULL )
+	{
+		entry        = entries_list;
+		entries_list = entry->next_entry;
+
+		entry->next_entry = NULL;
+
+		table_index = entry->name_hash & ( directory->entries_table_size - 1 );
+
+		if( directory->entries_table[ table_index ] == NULL )
+		{
+			directory->entries_table[ table_index ] = entry;
+		}
+		else
+		{
+			table_entry = directory->entries_table[ table_index ];
+
+			while( table_entry->next_entry != NULL )
+			{
+				table_entry = table_entry->next_entry;
+			}
+			table_entry->next_entry = entry;
+		}
+	}
+	return( 1 );
+
+on_error:
+	while( entries_list != NULL )
+	{
+		entry        = entries_list;
+		entries_list = entry->next_entry;
+
+		memory_free(
+		 entry->name );
+
+		memory_free(
+		 entry );
+	}
+	if( directory->entries_table != NULL )
+	{
+		memory_free(
+		 directory->entries_table );
+
+		directory->entries_table = NULL;
+	}
+	directory->entries_table_size = 0;
+
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( cdirectory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &cdirectory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a directory entry by name ignoring case
+ * An exact match takes precedence over the first caseless match in directory order
+ * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+ */
+int path_handle_directory_get_entry_by_name_no_case(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t entry_type,
+     path_handle_directory_entry_t **entry,
+     libcerror_error_t **error )
+{
+	path_handle_directory_entry_t *table_entry = NULL;
+	static char *function                      = "path_handle_directory_get_entry_by_name_no_case";
+	uint32_t name_hash                         = 0;
+
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory->entries_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid directory - missing entries table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = NULL;
+
+	name_hash = path_handle_get_name_hash(
+	             name,
+	             name_length );
+
+	table_entry = directory->entries_table[ name_hash & ( directory->entries_table_size - 1 ) ];
+
+	while( table_entry != NULL )
+	{
+		if( ( table_entry->name_hash == name_hash )
+		 && ( table_entry->name_length == name_length )
+		 && ( table_entry->type == entry_type ) )
+		{
+			if( system_string_compare(
+			     table_entry->name,
+			     name,
+			     name_length ) == 0 )
+			{
+				*entry = table_entry;
+
+				break;
+			}
+			/* Ignore successive caseless matches
+			 */
+			if( ( *entry == NULL )
+			 && ( path_handle_compare_name_no_case(
+			       table_entry->name,
+			       name,
+			       name_length ) != 0 ) )
+			{
+				*entry = table_entry;
+			}
+		}
+		table_entry = table_entry->next_entry;
+	}
+	if( *entry == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a directory from the directories hash table
+ * The entries of the directory are read on first access
+ * Returns 1 if successful or -1 on error
+ */
+int path_handle_get_directory(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     path_handle_directory_t **directory,
+     libcerror_error_t **error )
+{
+	path_handle_directory_t *safe_directory = NULL;
+	static char *function                   = "path_handle_get_directory";
+	uint32_t path_hash                      = 0;
+	int table_index                         = 0;
+
+	if( path_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( directory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid directory.",
+		 function );
+
+		return( -1 );
+	}
+	path_hash = path_handle_get_name_hash(
+	             path,
+	             path_length );
+
+	table_index = (int) ( path_hash % PATH_HANDLE_DIRECTORIES_TABLE_SIZE );
+
+	safe_directory = path_handle->directories_table[ table_index ];
+
+	while( safe_directory != NULL )
+	{
+		if( ( safe_directory->path_hash == path_hash )
+		 && ( safe_directory->path_length == path_length )
+		 && ( system_string_compare(
+		       safe_directory->path,
+		       path,
+		       path_length ) == 0 ) )
+		{
+			*directory = safe_directory;
+
+			return( 1 );
+		}
+		safe_directory = safe_directory->next_directory;
+	}
+	if( path_handle_directory_initialize(
+	     &safe_directory,
+	     path,
+	     path_length,
+	     path_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( path_handle_directory_read_entries(
+	     safe_directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read directory entries: %" PRIs_SYSTEM ".",
+		 function,
+		 safe_directory->path );
+
+		goto on_error;
+	}
+	safe_directory->next_directory = path_handle->directories_table[ table_index ];
+
+	path_handle->directories_table[ table_index ] = safe_directory;
+
+	*directory = safe_directory;
+
+	return( 1 );
+
+on_error:
+	if( safe_directory != NULL )
+	{
+		path_handle_directory_free(
+		 &safe_directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the name of a directory entry by name ignoring case
+ * If a corresponding entry is found entry name is update
+ * This function is needed to find case insensitive directory entries on a case sensitive system
+ * The directory listing is cached so that successive lookups do not need to read the directory again
+ * Return 1 if successful, 0 if no corresponding entry was found or -1 on error
+ */
+int path_handle_get_directory_entry_name_by_name_no_case(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     system_character_t *entry_name,
+     size_t entry_name_size,
+     uint8_t entry_type,
+     libcerror_error_t **error )
+{
+	path_handle_directory_t *directory   = NULL;
+	path_handle_directory_entry_t *entry = NULL;
+	static char *function                = "path_handle_get_directory_entry_name_by_name_no_case";
+	int result                           = 0;
+
+	if( path_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_name_size == 0 )
+	 || ( entry_name_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Callers pass the path length both with and without the end-of-string character
+	 */
+	if( ( path_length > 0 )
+	 && ( path[ path_length - 1 ] == 0 ) )
+	{
+		path_length--;
+	}
+	if( path_handle_get_directory(
+	     path_handle,
+	     path,
+	     path_length,
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve directory: %" PRIs_SYSTEM ".",
+		 function,
+		 path );
+
+		return( -1 );
+	}
+	result = path_handle_directory_get_entry_by_name_no_case(
+	          directory,
+	          entry_name,
+	          entry_name_size - 1,
+	          entry_type,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if directory has entry: %" PRIs_SYSTEM ".",
+		 function,
+		 entry_name );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( ( entry->name_length + 1 ) != entry_name_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: entry name length value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( system_string_copy(
+		     entry_name,
+		     entry->name,
+		     entry->name_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set entry name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
 }
 
@@ -31,6 +31,64 @@
 extern "C" {
 #endif
 
+/* The number of buckets in the directories hash table
+ */
+#define PATH_HANDLE_DIRECTORIES_TABLE_SIZE		64
+
+typedef struct path_handle_directory_entry path_handle_directory_entry_t;
+
+struct path_handle_directory_entry
+{
+	/* The name
+	 */
+	system_character_t *name;
+
+	/* The name length
+	 */
+	size_t name_length;
+
+	/* The case folded name hash
+	 */
+	uint32_t name_hash;
+
+	/* The entry type
+	 */
+	uint8_t type;
+
+	/* The next entry in the hash bucket
+	 */
+	path_handle_directory_entry_t *next_entry;
+};
+
+typedef struct path_handle_directory path_handle_directory_t;
+
+struct path_handle_directory
+{
+	/* The path
+	 */
+	system_character_t *path;
+
+	/* The path length
+	 */
+	size_t path_length;
+
+	/* The path hash
+	 */
+	uint32_t path_hash;
+
+	/* The entries hash table
+	 */
+	path_handle_directory_entry_t **entries_table;
+
+	/* The number of buckets in the entries hash table
+	 */
+	uint32_t entries_table_size;
+
+	/* The next directory in the hash bucket
+	 */
+	path_handle_directory_t *next_directory;
+};
+
 typedef struct path_handle path_handle_t;
 
 struct path_handle
@@ -42,6 +100,11 @@ struct path_handle
 	/* The %SystemRoot% path size
 	 */
 	size_t system_root_path_size;
+
+	/* The directories hash table
+	 * Contains the directories that have been listed so far
+	 */
+	path_handle_directory_t *directories_table[ PATH_HANDLE_DIRECTORIES_TABLE_SIZE ];
 };
 
 int path_handle_initialize(
@@ -52,6 +115,45 @@ int path_handle_free(
      path_handle_t **path_handle,
      libcerror_error_t **error );
 
+uint32_t path_handle_get_name_hash(
+          const system_character_t *name,
+          size_t name_length );
+
+int path_handle_compare_name_no_case(
+     const system_character_t *first_name,
+     const system_character_t *second_name,
+     size_t name_length );
+
+int path_handle_directory_initialize(
+     path_handle_directory_t **directory,
+     const system_character_t *path,
+     size_t path_length,
+     uint32_t path_hash,
+     libcerror_error_t **error );
+
+int path_handle_directory_free(
+     path_handle_directory_t **directory,
+     libcerror_error_t **error );
+
+int path_handle_directory_read_entries(
+     path_handle_directory_t *directory,
+     libcerror_error_t **error );
+
+int path_handle_directory_get_entry_by_name_no_case(
+     path_handle_directory_t *directory,
+     const system_character_t *name,
+     size_t name_length,
+     uint8_t entry_type,
+     path_handle_directory_entry_t **entry,
+     libcerror_error_t **error );
+
+int path_handle_get_directory(
+     path_handle_t *path_handle,
+     const system_character_t *path,
+     size_t path_length,
+     path_handle_directory_t **directory,
+     libcerror_error_t **error );
+
 int path_handle_get_directory_entry_name_by_name_no_case(
      path_handle_t *path_handle,
      const system_character_t *path,
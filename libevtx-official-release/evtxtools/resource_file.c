@@ -33,6 +33,7 @@
 #include "evtxtools_libfcache.h"
 #include "evtxtools_libfwevt.h"
 #include "evtxtools_libwrc.h"
+#include "manifest_index.h"
 #include "message_string.h"
 #include "resource_file.h"
 
@@ -481,6 +482,22 @@ int resource_file_close(
 				result = -1;
 			}
 		}
+		if( resource_file->manifest_index != NULL )
+		{
+			if( manifest_index_free(
+			     &( resource_file->manifest_index ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free manifest index.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( resource_file->wevt_manifest != NULL )
 		{
 			if( libfwevt_manifest_free(
@@ -2141,17 +2158,18 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific provider from the WEVT_TEMPLATE resource
+/* Retrieves a specific index provider from the WEVT_TEMPLATE resource
+ * The manifest index is built the first time the WEVT manifest is read
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int resource_file_get_provider(
+int resource_file_get_index_provider(
      resource_file_t *resource_file,
      const uint8_t *provider_identifier,
      size_t provider_identifier_size,
-     libfwevt_provider_t **provider,
+     manifest_index_provider_t **index_provider,
      libcerror_error_t **error )
 {
-	static char *function = "resource_file_get_provider";
+	static char *function = "resource_file_get_index_provider";
 	int result            = 0;
 
 	if( resource_file == NULL )
@@ -2188,11 +2206,41 @@ int resource_file_get_provider(
 			return( 0 );
 		}
 	}
-	result = libfwevt_manifest_get_provider_by_identifier(
-	          resource_file->wevt_manifest,
+	if( resource_file->manifest_index == NULL )
+	{
+		if( manifest_index_initialize(
+		     &( resource_file->manifest_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create manifest index.",
+			 function );
+
+			goto on_error;
+		}
+		if( manifest_index_read_manifest(
+		     resource_file->manifest_index,
+		     resource_file->wevt_manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read manifest index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	result = manifest_index_get_provider_by_identifier(
+	          resource_file->manifest_index,
 	          provider_identifier,
 	          provider_identifier_size,
-	          provider,
+	          index_provider,
 	          error );
 
 	if( result == -1 )
@@ -2201,40 +2249,89 @@ int resource_file_get_provider(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve provider from WEVT manifest.",
+		 "%s: unable to retrieve provider from manifest index.",
 		 function );
 
 		return( -1 );
 	}
 	return( result );
+
+on_error:
+	if( resource_file->manifest_index != NULL )
+	{
+		manifest_index_free(
+		 &( resource_file->manifest_index ),
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves a specific event from a a specific provider from the WEVT_TEMPLATE resource
+/* Retrieves a specific provider from the WEVT_TEMPLATE resource
  * Returns 1 if successful, 0 if not available or -1 error
  */
-int resource_file_get_event(
+int resource_file_get_provider(
      resource_file_t *resource_file,
      const uint8_t *provider_identifier,
      size_t provider_identifier_size,
-     uint32_t event_identifier,
      libfwevt_provider_t **provider,
-     libfwevt_event_t **event,
      libcerror_error_t **error )
 {
-	static char *function = "resource_file_get_event_message_identifier";
-	int result            = 0;
+	manifest_index_provider_t *index_provider = NULL;
+	static char *function                     = "resource_file_get_provider";
+	int result                                = 0;
 
-	if( resource_file == NULL )
+	if( provider == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_get_index_provider(
+	          resource_file,
+	          provider_identifier,
+	          provider_identifier_size,
+	          &index_provider,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index provider.",
 		 function );
 
 		return( -1 );
 	}
+	else if( result != 0 )
+	{
+		*provider = index_provider->provider;
+	}
+	return( result );
+}
+
+/* Retrieves a specific event from a a specific provider from the WEVT_TEMPLATE resource
+ * Returns 1 if successful, 0 if not available or -1 error
+ */
+int resource_file_get_event(
+     resource_file_t *resource_file,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libfwevt_provider_t **provider,
+     libfwevt_event_t **event,
+     libcerror_error_t **error )
+{
+	manifest_index_provider_t *index_provider = NULL;
+	static char *function                     = "resource_file_get_event";
+	int result                                = 0;
+
 	if( provider == NULL )
 	{
 		libcerror_error_set(
@@ -2246,11 +2343,11 @@ int resource_file_get_event(
 
 		return( -1 );
 	}
-	result = resource_file_get_provider(
+	result = resource_file_get_index_provider(
 	          resource_file,
 	          provider_identifier,
 	          provider_identifier_size,
-	          provider,
+	          &index_provider,
 	          error );
 
 	if( result == -1 )
@@ -2259,15 +2356,15 @@ int resource_file_get_event(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve provider.",
+		 "%s: unable to retrieve index provider.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result != 0 )
 	{
-		result = libfwevt_provider_get_event_by_identifier(
-			  *provider,
+		result = manifest_index_provider_get_event_by_identifier(
+			  index_provider,
 			  event_identifier,
 			  event,
 			  error );
@@ -2281,19 +2378,11 @@ int resource_file_get_event(
 			 "%s: unable to retrieve event.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
+		*provider = index_provider->provider;
 	}
 	return( result );
-
-on_error:
-	if( *provider != NULL )
-	{
-		libfwevt_provider_free(
-		 provider,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the template definition from a specific event from a a specific provider from the WEVT_TEMPLATE resource
@@ -2309,23 +2398,12 @@ int resource_file_get_template_definition(
      libfwevt_template_t **template_definition,
      libcerror_error_t **error )
 {
-	libfwevt_event_t *safe_event       = NULL;
-	libfwevt_provider_t *safe_provider = NULL;
-	static char *function              = "resource_file_get_template_definition";
-	uint32_t template_offset           = 0;
-	int result                         = 0;
-
-	if( resource_file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
-		 function );
+	manifest_index_provider_t *index_provider = NULL;
+	libfwevt_event_t *safe_event              = NULL;
+	static char *function                     = "resource_file_get_template_definition";
+	uint32_t template_offset                  = 0;
+	int result                                = 0;
 
-		return( -1 );
-	}
 	if( provider == NULL )
 	{
 		libcerror_error_set(
@@ -2348,15 +2426,34 @@ int resource_file_get_template_definition(
 
 		return( -1 );
 	}
-	result = resource_file_get_event(
+	result = resource_file_get_index_provider(
 	          resource_file,
 	          provider_identifier,
 	          provider_identifier_size,
-	          event_identifier,
-	          &safe_provider,
-	          &safe_event,
+	          &index_provider,
 	          error );
 
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index provider.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = manifest_index_provider_get_event_by_identifier(
+		  index_provider,
+		  event_identifier,
+		  &safe_event,
+		  error );
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
@@ -2366,7 +2463,7 @@ int resource_file_get_template_definition(
 		 "%s: unable to retrieve event.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 	else if( result == 0 )
 	{
@@ -2384,80 +2481,35 @@ int resource_file_get_template_definition(
 		 "%s: unable to retrieve template offset.",
 		 function );
 
-		goto on_error;
-	}
-	result = 0;
-
-	if( template_offset != 0 )
-	{
-		result = libfwevt_provider_get_template_by_offset(
-			  safe_provider,
-			  template_offset,
-			  template_definition,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template by offset.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			*provider = safe_provider;
-			*event    = safe_event;
-		}
+		return( -1 );
 	}
-	if( result == 0 )
+	if( template_offset == 0 )
 	{
-		if( libfwevt_event_free(
-		     &safe_event,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free event.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfwevt_provider_free(
-		     &safe_provider,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free provider.",
-			 function );
-
-			goto on_error;
-		}
+		return( 0 );
 	}
-	return( result );
+	result = manifest_index_provider_get_template_by_offset(
+		  index_provider,
+		  template_offset,
+		  template_definition,
+		  error );
 
-on_error:
-	if( safe_event != NULL )
+	if( result == -1 )
 	{
-		libfwevt_event_free(
-		 &safe_event,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template by offset.",
+		 function );
+
+		return( -1 );
 	}
-	if( safe_provider != NULL )
+	else if( result != 0 )
 	{
-		libfwevt_provider_free(
-		 &safe_provider,
-		 NULL );
+		*provider = index_provider->provider;
+		*event    = safe_event;
 	}
-	return( -1 );
+	return( result );
 }
 
 /* Retrieves the message identifier from a specific event from a a specific provider from the WEVT_TEMPLATE resource
@@ -31,6 +31,7 @@
 #include "evtxtools_libfcache.h"
 #include "evtxtools_libfwevt.h"
 #include "evtxtools_libwrc.h"
+#include "manifest_index.h"
 #include "message_string.h"
 
 #if defined( __cplusplus )
@@ -81,6 +82,10 @@ struct resource_file
 	 */
 	libfwevt_manifest_t *wevt_manifest;
 
+	/* The index of the providers, events and templates in the WEVT manifest
+	 */
+	manifest_index_t *manifest_index;
+
 	/* The message string cache
 	 */
 	libfcache_cache_t *message_string_cache;
@@ -150,6 +155,13 @@ int resource_file_get_wevt_manifest(
      libfwevt_manifest_t **wevt_manifest,
      libcerror_error_t **error );
 
+int resource_file_get_index_provider(
+     resource_file_t *resource_file,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     manifest_index_provider_t **index_provider,
+     libcerror_error_t **error );
+
 int resource_file_get_provider(
      resource_file_t *resource_file,
      const uint8_t *provider_identifier,
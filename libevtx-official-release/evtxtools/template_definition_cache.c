@@ -0,0 +1,375 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+#include "template_definition_cache.h"
+
+/* Creates a template definition cache
+ * Make sure the value template_definition_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "template_definition_cache_initialize";
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition_cache = memory_allocate_structure(
+	                              template_definition_cache_t );
+
+	if( *template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_definition_cache,
+	     0,
+	     sizeof( template_definition_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *template_definition_cache != NULL )
+	{
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a template definition cache
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_free";
+	int result                                     = 1;
+	int table_index                                = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition_cache != NULL )
+	{
+		for( table_index = 0;
+		     table_index < TEMPLATE_DEFINITION_CACHE_TABLE_SIZE;
+		     table_index++ )
+		{
+			while( ( *template_definition_cache )->entries_table[ table_index ] != NULL )
+			{
+				cache_entry = ( *template_definition_cache )->entries_table[ table_index ];
+
+				( *template_definition_cache )->entries_table[ table_index ] = cache_entry->next_entry;
+
+				if( cache_entry->template_definition != NULL )
+				{
+					if( libevtx_template_definition_free(
+					     &( cache_entry->template_definition ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free template definition.",
+						 function );
+
+						result = -1;
+					}
+				}
+				memory_free(
+				 cache_entry );
+			}
+		}
+		memory_free(
+		 *template_definition_cache );
+
+		*template_definition_cache = NULL;
+	}
+	return( result );
+}
+
+/* Calculates the hash of a provider identifier and event identifier
+ * Returns the hash
+ */
+uint32_t template_definition_cache_get_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier )
+{
+	uint32_t hash        = event_identifier;
+	uint32_t value_32bit = 0;
+	uint8_t byte_index   = 0;
+
+	for( byte_index = 0;
+	     byte_index < 16;
+	     byte_index += 4 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( provider_identifier[ byte_index ] ),
+		 value_32bit );
+
+		hash = ( hash * 31 ) ^ value_32bit;
+	}
+	hash ^= hash >> 16;
+	hash *= 0x7feb352dUL;
+	hash ^= hash >> 15;
+
+	return( hash );
+}
+
+/* Retrieves a cached template definition
+ * The template definition is owned by the cache and can be NULL if the event
+ * was previously found to have no template definition
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	template_definition_cache_entry_t *cache_entry = NULL;
+	static char *function                          = "template_definition_cache_get_template_definition";
+	uint32_t table_index                           = 0;
+
+	if( template_definition_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	table_index = template_definition_cache_get_hash(
+	               provider_identifier,
+	               event_identifier ) % TEMPLATE_DEFINITION_CACHE_TABLE_SIZE;
+
+	cache_entry = template_definition_cache->entries_table[ table_index ];
+
+	while( cache_entry != NULL )
+	{
+		if( ( cache_entry->event_identifier == event_identifier )
+		 && ( memory_compare(
+		       cache_entry->provider_identifier,
+		       provider_identifier,
+		       16 ) == 0 ) )
+		{
+			*template_definition = cache_entry->template_definition;
+
+			return( 1 );
+		}
+		cache_entry = cache_entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Sets a template definition in the cache
+ * The cache takes over ownership of the template definition, which can be NULL
+ * to indicate the event has no template definition
+ * Returns 1 if successful or -1 on error
+ */
+int template_definition_cache_set_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	libevtx_template_definition_t *cached_template_definition = NULL;
+	template_definition_cache_entry_t *cache_entry            = NULL;
+	static char *function                                     = "template_definition_cache_set_template_definition";
+	uint32_t table_index                                      = 0;
+	int result                                                = 0;
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          provider_identifier_size,
+	          event_identifier,
+	          &cached_template_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition cache - template definition of event: %" PRIu32 " already set.",
+		 function,
+		 event_identifier );
+
+		return( -1 );
+	}
+	cache_entry = memory_allocate_structure(
+	               template_definition_cache_entry_t );
+
+	if( cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     cache_entry->provider_identifier,
+	     provider_identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier.",
+		 function );
+
+		memory_free(
+		 cache_entry );
+
+		return( -1 );
+	}
+	cache_entry->event_identifier    = event_identifier;
+	cache_entry->template_definition = template_definition;
+
+	table_index = template_definition_cache_get_hash(
+	               provider_identifier,
+	               event_identifier ) % TEMPLATE_DEFINITION_CACHE_TABLE_SIZE;
+
+	cache_entry->next_entry = template_definition_cache->entries_table[ table_index ];
+
+	template_definition_cache->entries_table[ table_index ] = cache_entry;
+
+	template_definition_cache->number_of_entries += 1;
+
+	return( 1 );
+}
+
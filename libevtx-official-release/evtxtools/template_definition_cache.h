@@ -0,0 +1,108 @@
+/*
+ * Template definition cache
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _TEMPLATE_DEFINITION_CACHE_H )
+#define _TEMPLATE_DEFINITION_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evtxtools_libcerror.h"
+#include "evtxtools_libevtx.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of buckets in the template definitions hash table
+ */
+#define TEMPLATE_DEFINITION_CACHE_TABLE_SIZE		256
+
+typedef struct template_definition_cache_entry template_definition_cache_entry_t;
+
+struct template_definition_cache_entry
+{
+	/* The provider identifier
+	 * Contains a GUID
+	 */
+	uint8_t provider_identifier[ 16 ];
+
+	/* The event identifier
+	 */
+	uint32_t event_identifier;
+
+	/* The template definition
+	 * NULL if the event has no template definition
+	 */
+	libevtx_template_definition_t *template_definition;
+
+	/* The next entry in the hash bucket
+	 */
+	template_definition_cache_entry_t *next_entry;
+};
+
+typedef struct template_definition_cache template_definition_cache_t;
+
+struct template_definition_cache
+{
+	/* The template definitions hash table
+	 */
+	template_definition_cache_entry_t *entries_table[ TEMPLATE_DEFINITION_CACHE_TABLE_SIZE ];
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+};
+
+int template_definition_cache_initialize(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+int template_definition_cache_free(
+     template_definition_cache_t **template_definition_cache,
+     libcerror_error_t **error );
+
+uint32_t template_definition_cache_get_hash(
+          const uint8_t *provider_identifier,
+          uint32_t event_identifier );
+
+int template_definition_cache_get_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int template_definition_cache_set_template_definition(
+     template_definition_cache_t *template_definition_cache,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     uint32_t event_identifier,
+     libevtx_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _TEMPLATE_DEFINITION_CACHE_H ) */
+
@@ -0,0 +1,2352 @@
+/*
+ * Chunk carver functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "libevtx_carver.h"
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_signature.h"
+#include "libevtx_codepage.h"
+#include "libevtx_definitions.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_record.h"
+#include "libevtx_record_values.h"
+
+/* The size of the scan data, which contains a region and the remainder
+ * of the header of a chunk that starts at the end of the region
+ */
+#define LIBEVTX_CARVER_SCAN_DATA_SIZE	( LIBEVTX_CARVER_REGION_SIZE + 511 )
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_initialize(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libevtx_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libevtx_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		memory_free(
+		 internal_carver );
+
+		return( -1 );
+	}
+	if( libevtx_io_handle_initialize(
+	     &( internal_carver->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	*carver = (libevtx_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_free(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_free";
+	int result                                 = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libevtx_internal_carver_t *) *carver;
+
+		if( internal_carver->file_io_handle != NULL )
+		{
+			if( libevtx_carver_close(
+			     *carver,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close carver.",
+				 function );
+
+				result = -1;
+			}
+		}
+		*carver = NULL;
+
+		if( libevtx_io_handle_free(
+		     &( internal_carver->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( result );
+}
+
+/* Signals a carver to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_signal_abort(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_signal_abort";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens a file or image to carve
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_open(
+     libevtx_carver_t *carver,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_open";
+	size_t filename_length                     = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_open_file_io_handle(
+	     carver,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_carver->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Opens a file or image to carve
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_open_wide(
+     libevtx_carver_t *carver,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle           = NULL;
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_open_wide";
+	size_t filename_length                     = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_carver_open_file_io_handle(
+	     carver,
+	     file_io_handle,
+	     access_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %ls.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	internal_carver->file_io_handle_created_in_library = 1;
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Opens a file or image to carve using a Basic File IO (bfio) handle
+ * The data of the file IO handle does not need to start with a file header
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_open_file_io_handle(
+     libevtx_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_open_file_io_handle";
+	size64_t number_of_regions                 = 0;
+	int bfio_access_flags                      = 0;
+	int file_io_handle_is_open                 = 0;
+	int file_io_handle_opened_in_library       = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( access_flags & LIBEVTX_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVTX_ACCESS_FLAG_WRITE ) == 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_WRITE ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( access_flags & LIBEVTX_ACCESS_FLAG_READ ) != 0 )
+	{
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_opened_in_library = 1;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_carver->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	number_of_regions = internal_carver->file_size / LIBEVTX_CARVER_REGION_SIZE;
+
+	if( ( internal_carver->file_size % LIBEVTX_CARVER_REGION_SIZE ) != 0 )
+	{
+		number_of_regions += 1;
+	}
+	if( number_of_regions > (size64_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of regions value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->file_io_handle                   = file_io_handle;
+	internal_carver->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_carver->number_of_regions                = (int) number_of_regions;
+	internal_carver->region_index                     = 0;
+	internal_carver->chunk_index                      = 0;
+	internal_carver->record_index                     = 0;
+	internal_carver->io_handle->abort                 = 0;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( ( internal_carver->number_of_threads > 0 )
+	 && ( internal_carver->number_of_regions > 0 ) )
+	{
+		if( libevtx_carver_start_worker_threads(
+		     internal_carver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to start worker threads.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+#endif
+	{
+		internal_carver->scan_data = (uint8_t *) memory_allocate(
+		                                          sizeof( uint8_t ) * LIBEVTX_CARVER_SCAN_DATA_SIZE );
+
+		if( internal_carver->scan_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create scan data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	internal_carver->file_io_handle                   = NULL;
+	internal_carver->file_io_handle_opened_in_library = 0;
+	internal_carver->number_of_regions                = 0;
+
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Closes a carver
+ * Returns 0 if successful or -1 on error
+ */
+int libevtx_carver_close(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_close";
+	int result                                 = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_carver_stop_worker_threads(
+	     internal_carver,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to stop worker threads.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_carver->chunks_array != NULL )
+	{
+		if( libcdata_array_free(
+		     &( internal_carver->chunks_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunks array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_carver->scan_data != NULL )
+	{
+		memory_free(
+		 internal_carver->scan_data );
+
+		internal_carver->scan_data = NULL;
+	}
+	if( internal_carver->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_carver->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_carver->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_carver->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_carver->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_carver->file_io_handle_created_in_library = 0;
+	}
+	internal_carver->file_io_handle    = NULL;
+	internal_carver->file_size         = 0;
+	internal_carver->number_of_regions = 0;
+	internal_carver->region_index      = 0;
+	internal_carver->chunk_index       = 0;
+	internal_carver->record_index      = 0;
+
+	return( result );
+}
+
+/* Starts the worker threads
+ * Each worker thread carves the pending regions with its own clone of the file IO handle
+ * The regions are assigned to the slots round-robin, so that slot N contains
+ * region N + ( M * number of slots )
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_start_worker_threads(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_carver_start_worker_threads";
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	int slot_index        = 0;
+	int thread_index      = 0;
+#endif
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_carver->worker_threads != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver - worker threads value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_carver->number_of_threads <= 0 )
+	 || ( internal_carver->number_of_threads > LIBEVTX_CARVER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid carver - number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Twice the number of slots than worker threads allows the worker threads
+	 * to carve ahead while the caller retrieves the records of a region
+	 */
+	internal_carver->number_of_slots = internal_carver->number_of_threads * 2;
+
+	if( internal_carver->number_of_slots > internal_carver->number_of_regions )
+	{
+		internal_carver->number_of_slots = internal_carver->number_of_regions;
+	}
+	internal_carver->slot_region_indexes = (int *) memory_allocate(
+	                                                sizeof( int ) * internal_carver->number_of_slots );
+
+	if( internal_carver->slot_region_indexes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot region indexes.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->slot_states = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * internal_carver->number_of_slots );
+
+	if( internal_carver->slot_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot states.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->slot_chunks_arrays = (libcdata_array_t **) memory_allocate(
+	                                                             sizeof( libcdata_array_t * ) * internal_carver->number_of_slots );
+
+	if( internal_carver->slot_chunks_arrays == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot chunks arrays.",
+		 function );
+
+		goto on_error;
+	}
+	for( slot_index = 0;
+	     slot_index < internal_carver->number_of_slots;
+	     slot_index++ )
+	{
+		internal_carver->slot_region_indexes[ slot_index ] = slot_index;
+		internal_carver->slot_states[ slot_index ]         = LIBEVTX_CARVER_SLOT_STATE_PENDING;
+		internal_carver->slot_chunks_arrays[ slot_index ]  = NULL;
+	}
+	internal_carver->worker_threads = (libcthreads_thread_t **) memory_allocate(
+	                                                             sizeof( libcthreads_thread_t * ) * internal_carver->number_of_threads );
+
+	if( internal_carver->worker_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver->worker_threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * internal_carver->number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_carver->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( internal_carver->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The CRC-32 table is computed on first use, which must not happen
+	 * concurrently in the worker threads
+	 */
+	if( libevtx_checksum_crc32_table_computed == 0 )
+	{
+		libevtx_checksum_initialize_crc32_table();
+	}
+	internal_carver->stop_worker_threads      = 0;
+	internal_carver->number_of_active_threads = internal_carver->number_of_threads;
+
+	for( thread_index = 0;
+	     thread_index < internal_carver->number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( internal_carver->worker_threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_carver_worker_thread_function,
+		     (void *) internal_carver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libevtx_carver_stop_worker_threads(
+	 internal_carver,
+	 NULL );
+
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: multi-thread support is required.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+}
+
+/* Stops the worker threads
+ * The chunks of the regions that were carved but not retrieved are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_stop_worker_threads(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_carver_stop_worker_threads";
+	int result            = 1;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	int slot_index        = 0;
+	int thread_index      = 0;
+#endif
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_carver->worker_threads != NULL )
+	{
+		if( internal_carver->mutex != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     internal_carver->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			internal_carver->stop_worker_threads = 1;
+
+			if( libcthreads_condition_broadcast(
+			     internal_carver->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     internal_carver->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		for( thread_index = 0;
+		     thread_index < internal_carver->number_of_threads;
+		     thread_index++ )
+		{
+			if( internal_carver->worker_threads[ thread_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcthreads_thread_join(
+			     &( internal_carver->worker_threads[ thread_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker thread: %d.",
+				 function,
+				 thread_index );
+
+				return( -1 );
+			}
+		}
+		memory_free(
+		 internal_carver->worker_threads );
+
+		internal_carver->worker_threads = NULL;
+	}
+	if( internal_carver->condition != NULL )
+	{
+		if( libcthreads_condition_free(
+		     &( internal_carver->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_carver->mutex != NULL )
+	{
+		if( libcthreads_mutex_free(
+		     &( internal_carver->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_carver->slot_chunks_arrays != NULL )
+	{
+		for( slot_index = 0;
+		     slot_index < internal_carver->number_of_slots;
+		     slot_index++ )
+		{
+			if( internal_carver->slot_chunks_arrays[ slot_index ] == NULL )
+			{
+				continue;
+			}
+			if( libcdata_array_free(
+			     &( internal_carver->slot_chunks_arrays[ slot_index ] ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunks array of slot: %d.",
+				 function,
+				 slot_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_carver->slot_chunks_arrays );
+
+		internal_carver->slot_chunks_arrays = NULL;
+	}
+	if( internal_carver->slot_states != NULL )
+	{
+		memory_free(
+		 internal_carver->slot_states );
+
+		internal_carver->slot_states = NULL;
+	}
+	if( internal_carver->slot_region_indexes != NULL )
+	{
+		memory_free(
+		 internal_carver->slot_region_indexes );
+
+		internal_carver->slot_region_indexes = NULL;
+	}
+	internal_carver->number_of_slots          = 0;
+	internal_carver->number_of_active_threads = 0;
+	internal_carver->stop_worker_threads      = 0;
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+	return( result );
+}
+
+/* Sets the ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_set_ascii_codepage(
+     libevtx_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_set_ascii_codepage";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_carver->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the number of worker threads
+ * The worker threads carve the regions ahead of the caller and require multi-thread support
+ * A number of threads of 0 represents that the regions are carved by the caller
+ * The number of threads must be set before the carver is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_set_number_of_threads(
+     libevtx_carver_t *carver,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_carver_t *internal_carver = NULL;
+	static char *function                      = "libevtx_carver_set_number_of_threads";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver - file IO handle already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads < 0 )
+	 || ( number_of_threads > LIBEVTX_CARVER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( number_of_threads != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of threads, multi-thread support is required.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_carver->number_of_threads = number_of_threads;
+
+	return( 1 );
+}
+
+/* Carves the chunks of a region
+ * The region is scanned for chunk signatures and the chunks with a valid
+ * header are read with their records, of which the XML documents are read
+ * A record of which the XML document cannot be read is kept without it
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_carve_region(
+     libevtx_internal_carver_t *internal_carver,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *scan_data,
+     int region_index,
+     libcdata_array_t **chunks_array,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *records_array         = NULL;
+	libcdata_array_t *safe_chunks_array     = NULL;
+	libevtx_chunk_t *chunk                  = NULL;
+	libevtx_record_values_t *record_values  = NULL;
+	static char *function                   = "libevtx_carver_carve_region";
+	size_t region_size                      = 0;
+	size_t scan_data_size                   = 0;
+	size_t scan_offset                      = 0;
+	size_t signature_offset                 = 0;
+	ssize_t read_count                      = 0;
+	off64_t chunk_offset                    = 0;
+	off64_t region_offset                   = 0;
+	int array_index                         = 0;
+	int entry_index                         = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( region_index < 0 )
+	 || ( region_index >= internal_carver->number_of_regions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid region index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks array.",
+		 function );
+
+		return( -1 );
+	}
+	region_offset  = (off64_t) region_index * LIBEVTX_CARVER_REGION_SIZE;
+	scan_data_size = LIBEVTX_CARVER_SCAN_DATA_SIZE;
+
+	if( ( (size64_t) region_offset + scan_data_size ) > internal_carver->file_size )
+	{
+		scan_data_size = (size_t) ( internal_carver->file_size - region_offset );
+	}
+	region_size = scan_data_size;
+
+	if( region_size > LIBEVTX_CARVER_REGION_SIZE )
+	{
+		region_size = LIBEVTX_CARVER_REGION_SIZE;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              scan_data,
+	              scan_data_size,
+	              region_offset,
+	              error );
+
+	if( read_count != (ssize_t) scan_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read region: %d data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 region_index,
+		 region_offset,
+		 region_offset );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &safe_chunks_array,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create chunks array.",
+		 function );
+
+		goto on_error;
+	}
+	while( scan_offset < region_size )
+	{
+		if( internal_carver->io_handle->abort != 0 )
+		{
+			break;
+		}
+		result = libevtx_chunk_signature_scan(
+		          scan_data,
+		          scan_data_size,
+		          scan_offset,
+		          &signature_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to scan for chunk signature.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( signature_offset >= region_size ) )
+		{
+			break;
+		}
+		scan_offset  = signature_offset + 1;
+		chunk_offset = region_offset + (off64_t) signature_offset;
+
+		if( ( (size64_t) chunk_offset + internal_carver->io_handle->chunk_size ) > internal_carver->file_size )
+		{
+			continue;
+		}
+		result = libevtx_chunk_signature_check_header(
+		          scan_data,
+		          scan_data_size,
+		          signature_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to check chunk header at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 chunk_offset,
+			 chunk_offset );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk.",
+			 function );
+
+			goto on_error;
+		}
+		result = libevtx_chunk_read(
+		          chunk,
+		          internal_carver->io_handle,
+		          file_io_handle,
+		          chunk_offset,
+		          error );
+
+		if( result != 1 )
+		{
+#if defined( HAVE_VERBOSE_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: unable to read chunk at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+				 function,
+				 chunk_offset,
+				 chunk_offset );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			if( libevtx_chunk_free(
+			     &chunk,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunk.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		for( array_index = 0;
+		     array_index < 2;
+		     array_index++ )
+		{
+			if( array_index == 0 )
+			{
+				records_array = chunk->records_array;
+			}
+			else
+			{
+				records_array = chunk->recovered_records_array;
+			}
+			if( libcdata_array_get_number_of_entries(
+			     records_array,
+			     &number_of_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of records.",
+				 function );
+
+				goto on_error;
+			}
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     records_array,
+				     entry_index,
+				     (intptr_t **) &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve record values: %d.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+				if( record_values == NULL )
+				{
+					continue;
+				}
+				record_values->offset = chunk_offset + (off64_t) record_values->chunk_data_offset;
+
+				if( libevtx_record_values_read_xml_document(
+				     record_values,
+				     internal_carver->io_handle,
+				     chunk->data,
+				     chunk->data_size,
+				     error ) != 1 )
+				{
+#if defined( HAVE_VERBOSE_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to read XML document of record at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+						 function,
+						 record_values->offset,
+						 record_values->offset );
+					}
+#endif
+					libcerror_error_free(
+					 error );
+				}
+			}
+		}
+		if( libcdata_array_append_entry(
+		     safe_chunks_array,
+		     &entry_index,
+		     (intptr_t *) chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append chunk to array.",
+			 function );
+
+			goto on_error;
+		}
+		chunk = NULL;
+
+		/* Chunks do not overlap so scanning continues after the chunk
+		 */
+		scan_offset = signature_offset + internal_carver->io_handle->chunk_size;
+	}
+	*chunks_array = safe_chunks_array;
+
+	return( 1 );
+
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	if( safe_chunks_array != NULL )
+	{
+		libcdata_array_free(
+		 &safe_chunks_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Carves the pending regions, in order of their region index
+ * This function runs in a worker thread until the worker threads are signalled to stop
+ * A region that cannot be carved is marked as failed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_worker_thread_function(
+     libevtx_internal_carver_t *internal_carver )
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcdata_array_t *chunks_array    = NULL;
+	libcerror_error_t *error          = NULL;
+	uint8_t *scan_data                = NULL;
+	static char *function             = "libevtx_carver_worker_thread_function";
+	int carve_slot_index              = 0;
+	int region_index                  = 0;
+	int result                        = 0;
+	int slot_index                    = 0;
+
+	if( internal_carver == NULL )
+	{
+		return( -1 );
+	}
+	scan_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * LIBEVTX_CARVER_SCAN_DATA_SIZE );
+
+	if( libcthreads_mutex_grab(
+	     internal_carver->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		internal_carver->number_of_active_threads -= 1;
+
+		goto on_error;
+	}
+	/* The file IO handle is cloned while the mutex is held so that
+	 * the worker threads do not clone it concurrently
+	 */
+	if( libbfio_handle_clone(
+	     &file_io_handle,
+	     internal_carver->file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+	}
+	else if( scan_data == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan data.",
+		 function );
+	}
+	while( ( error == NULL )
+	    && ( internal_carver->stop_worker_threads == 0 ) )
+	{
+		carve_slot_index = -1;
+
+		for( slot_index = 0;
+		     slot_index < internal_carver->number_of_slots;
+		     slot_index++ )
+		{
+			if( internal_carver->slot_states[ slot_index ] != LIBEVTX_CARVER_SLOT_STATE_PENDING )
+			{
+				continue;
+			}
+			if( ( carve_slot_index == -1 )
+			 || ( internal_carver->slot_region_indexes[ slot_index ] < internal_carver->slot_region_indexes[ carve_slot_index ] ) )
+			{
+				carve_slot_index = slot_index;
+			}
+		}
+		if( carve_slot_index == -1 )
+		{
+			if( libcthreads_condition_wait(
+			     internal_carver->condition,
+			     internal_carver->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+			}
+			continue;
+		}
+		internal_carver->slot_states[ carve_slot_index ] = LIBEVTX_CARVER_SLOT_STATE_CARVING;
+
+		region_index = internal_carver->slot_region_indexes[ carve_slot_index ];
+
+		/* A slot that is being carved is only accessed by its worker thread
+		 * so the mutex is not held while carving
+		 */
+		if( libcthreads_mutex_release(
+		     internal_carver->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			internal_carver->number_of_active_threads -= 1;
+
+			goto on_error;
+		}
+		result = libevtx_carver_carve_region(
+		          internal_carver,
+		          file_io_handle,
+		          scan_data,
+		          region_index,
+		          &chunks_array,
+		          &error );
+
+		if( error != NULL )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_print_error_backtrace(
+				 error );
+			}
+#endif
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     internal_carver->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			internal_carver->number_of_active_threads -= 1;
+
+			goto on_error;
+		}
+		if( result == 1 )
+		{
+			internal_carver->slot_chunks_arrays[ carve_slot_index ] = chunks_array;
+			internal_carver->slot_states[ carve_slot_index ]        = LIBEVTX_CARVER_SLOT_STATE_CARVED;
+
+			chunks_array = NULL;
+		}
+		else
+		{
+			internal_carver->slot_states[ carve_slot_index ] = LIBEVTX_CARVER_SLOT_STATE_FAILED;
+		}
+		if( libcthreads_condition_broadcast(
+		     internal_carver->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+		}
+	}
+	internal_carver->number_of_active_threads -= 1;
+
+	/* Wake up a caller that is waiting for a slot
+	 */
+	libcthreads_condition_broadcast(
+	 internal_carver->condition,
+	 NULL );
+
+	libcthreads_mutex_release(
+	 internal_carver->mutex,
+	 NULL );
+
+	if( error != NULL )
+	{
+		goto on_error;
+	}
+	libbfio_handle_free(
+	 &file_io_handle,
+	 NULL );
+
+	memory_free(
+	 scan_data );
+
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	if( chunks_array != NULL )
+	{
+		libcdata_array_free(
+		 &chunks_array,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( scan_data != NULL )
+	{
+		memory_free(
+		 scan_data );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+/* Retrieves the chunks of the next region
+ * The chunks are retrieved from the slot of the region if worker threads are used
+ * otherwise the region is carved by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_carver_get_region_chunks(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_carver_get_region_chunks";
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	int next_region_index  = 0;
+	int result             = 1;
+	int slot_index         = 0;
+#endif
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_carver->chunks_array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver - chunks array value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_carver->worker_threads != NULL )
+	{
+		slot_index = internal_carver->region_index % internal_carver->number_of_slots;
+
+		if( libcthreads_mutex_grab(
+		     internal_carver->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+		while( ( internal_carver->slot_states[ slot_index ] == LIBEVTX_CARVER_SLOT_STATE_PENDING )
+		    || ( internal_carver->slot_states[ slot_index ] == LIBEVTX_CARVER_SLOT_STATE_CARVING ) )
+		{
+			if( internal_carver->number_of_active_threads <= 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: invalid carver - missing active worker threads.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+			if( libcthreads_condition_wait(
+			     internal_carver->condition,
+			     internal_carver->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			if( ( internal_carver->slot_region_indexes[ slot_index ] != internal_carver->region_index )
+			 || ( internal_carver->slot_states[ slot_index ] != LIBEVTX_CARVER_SLOT_STATE_CARVED ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to carve region: %d.",
+				 function,
+				 internal_carver->region_index );
+
+				result = -1;
+			}
+			else
+			{
+				internal_carver->chunks_array = internal_carver->slot_chunks_arrays[ slot_index ];
+
+				internal_carver->slot_chunks_arrays[ slot_index ] = NULL;
+			}
+		}
+		/* The slot is reused for the region that is the number of slots further
+		 */
+		next_region_index = internal_carver->region_index + internal_carver->number_of_slots;
+
+		if( ( result == 1 )
+		 && ( next_region_index < internal_carver->number_of_regions ) )
+		{
+			internal_carver->slot_region_indexes[ slot_index ] = next_region_index;
+			internal_carver->slot_states[ slot_index ]         = LIBEVTX_CARVER_SLOT_STATE_PENDING;
+
+			if( libcthreads_condition_broadcast(
+			     internal_carver->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( result == 1 )
+		{
+			internal_carver->slot_states[ slot_index ] = LIBEVTX_CARVER_SLOT_STATE_UNUSED;
+		}
+		if( libcthreads_mutex_release(
+		     internal_carver->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+		return( result );
+	}
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+	if( libevtx_carver_carve_region(
+	     internal_carver,
+	     internal_carver->file_io_handle,
+	     internal_carver->scan_data,
+	     internal_carver->region_index,
+	     &( internal_carver->chunks_array ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to carve region: %d.",
+		 function,
+		 internal_carver->region_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the next carved record
+ * The records are retrieved in order of the offset of their chunk, where
+ * the recovered records of a chunk follow its records
+ * The offset of the record in the file or image can be retrieved with libevtx_record_get_offset
+ * The record must be freed before the carver is closed
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevtx_carver_get_next_record(
+     libevtx_carver_t *carver,
+     libevtx_record_t **record,
+     uint8_t *record_flags,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *records_array            = NULL;
+	libevtx_chunk_t *chunk                     = NULL;
+	libevtx_internal_carver_t *internal_carver = NULL;
+	libevtx_record_values_t *record_values     = NULL;
+	static char *function                      = "libevtx_carver_get_next_record";
+	uint16_t number_of_records                 = 0;
+	uint16_t number_of_recovered_records       = 0;
+	uint8_t safe_record_flags                  = 0;
+	int entry_index                            = 0;
+	int number_of_chunks                       = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevtx_internal_carver_t *) carver;
+
+	if( internal_carver->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record flags.",
+		 function );
+
+		return( -1 );
+	}
+	while( record_values == NULL )
+	{
+		if( internal_carver->chunks_array == NULL )
+		{
+			if( internal_carver->region_index >= internal_carver->number_of_regions )
+			{
+				return( 0 );
+			}
+			if( libevtx_carver_get_region_chunks(
+			     internal_carver,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunks of region: %d.",
+				 function,
+				 internal_carver->region_index );
+
+				return( -1 );
+			}
+			internal_carver->region_index += 1;
+			internal_carver->chunk_index   = 0;
+			internal_carver->record_index  = 0;
+		}
+		if( libcdata_array_get_number_of_entries(
+		     internal_carver->chunks_array,
+		     &number_of_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of chunks.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_carver->chunk_index >= number_of_chunks )
+		{
+			if( libcdata_array_free(
+			     &( internal_carver->chunks_array ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunk_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free chunks array.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( libcdata_array_get_entry_by_index(
+		     internal_carver->chunks_array,
+		     internal_carver->chunk_index,
+		     (intptr_t **) &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve chunk: %d.",
+			 function,
+			 internal_carver->chunk_index );
+
+			return( -1 );
+		}
+		if( libevtx_chunk_get_number_of_records(
+		     chunk,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevtx_chunk_get_number_of_recovered_records(
+		     chunk,
+		     &number_of_recovered_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of recovered records.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_carver->record_index < (int) number_of_records )
+		{
+			records_array     = chunk->records_array;
+			entry_index       = internal_carver->record_index;
+			safe_record_flags = 0;
+		}
+		else if( internal_carver->record_index < ( (int) number_of_records + (int) number_of_recovered_records ) )
+		{
+			records_array     = chunk->recovered_records_array;
+			entry_index       = internal_carver->record_index - (int) number_of_records;
+			safe_record_flags = LIBEVTX_CARVED_RECORD_FLAG_IS_RECOVERED;
+		}
+		else
+		{
+			internal_carver->chunk_index += 1;
+			internal_carver->record_index = 0;
+
+			continue;
+		}
+		internal_carver->record_index += 1;
+
+		if( libcdata_array_get_entry_by_index(
+		     records_array,
+		     entry_index,
+		     (intptr_t **) &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		/* The record values are moved from the chunk to the record
+		 */
+		if( libcdata_array_set_entry_by_index(
+		     records_array,
+		     entry_index,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set record values: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_record_initialize(
+	     record,
+	     internal_carver->io_handle,
+	     internal_carver->file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+
+		return( -1 );
+	}
+	*record_flags = safe_record_flags;
+
+	return( 1 );
+}
+
@@ -0,0 +1,238 @@
+/*
+ * Chunk carver functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_CARVER_H )
+#define _LIBEVTX_INTERNAL_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_io_handle.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcdata.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The size of the regions in which the data is scanned for chunks
+ * A chunk belongs to the region that contains its signature
+ */
+#define LIBEVTX_CARVER_REGION_SIZE				( 16 * 1024 * 1024 )
+
+/* The maximum number of worker threads
+ */
+#define LIBEVTX_CARVER_MAXIMUM_NUMBER_OF_THREADS		64
+
+typedef struct libevtx_internal_carver libevtx_internal_carver_t;
+
+struct libevtx_internal_carver
+{
+	/* The IO handle
+	 */
+	libevtx_io_handle_t *io_handle;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
+	/* Value to indicate if the file IO handle was opened inside the library
+	 */
+	uint8_t file_io_handle_opened_in_library;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The number of regions
+	 */
+	int number_of_regions;
+
+	/* The index of the next region to retrieve the chunks of
+	 */
+	int region_index;
+
+	/* The scan data, which is used when the regions are carved by the caller
+	 */
+	uint8_t *scan_data;
+
+	/* The chunks of the current region
+	 */
+	libcdata_array_t *chunks_array;
+
+	/* The index of the current chunk in the chunks array
+	 */
+	int chunk_index;
+
+	/* The index of the next record in the current chunk, where the recovered
+	 * records follow the records
+	 */
+	int record_index;
+
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The number of slots, where each slot contains the chunks of one region
+	 */
+	int number_of_slots;
+
+	/* The region index of each slot
+	 */
+	int *slot_region_indexes;
+
+	/* The state of each slot
+	 */
+	uint8_t *slot_states;
+
+	/* The chunks array of each slot
+	 */
+	libcdata_array_t **slot_chunks_arrays;
+
+	/* Value to indicate the worker threads should stop
+	 */
+	uint8_t stop_worker_threads;
+
+	/* The number of worker threads that are active
+	 */
+	int number_of_active_threads;
+
+	/* The mutex that protects the slots
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change in the slot states
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The worker threads
+	 */
+	libcthreads_thread_t **worker_threads;
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+};
+
+LIBEVTX_EXTERN \
+int libevtx_carver_initialize(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_free(
+     libevtx_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_signal_abort(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_open(
+     libevtx_carver_t *carver,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVTX_EXTERN \
+int libevtx_carver_open_wide(
+     libevtx_carver_t *carver,
+     const wchar_t *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBEVTX_EXTERN \
+int libevtx_carver_open_file_io_handle(
+     libevtx_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_close(
+     libevtx_carver_t *carver,
+     libcerror_error_t **error );
+
+int libevtx_carver_start_worker_threads(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error );
+
+int libevtx_carver_stop_worker_threads(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_set_ascii_codepage(
+     libevtx_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_set_number_of_threads(
+     libevtx_carver_t *carver,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libevtx_carver_carve_region(
+     libevtx_internal_carver_t *internal_carver,
+     libbfio_handle_t *file_io_handle,
+     uint8_t *scan_data,
+     int region_index,
+     libcdata_array_t **chunks_array,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+int libevtx_carver_worker_thread_function(
+     libevtx_internal_carver_t *internal_carver );
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+int libevtx_carver_get_region_chunks(
+     libevtx_internal_carver_t *internal_carver,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_carver_get_next_record(
+     libevtx_carver_t *carver,
+     libevtx_record_t **record,
+     uint8_t *record_flags,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_CARVER_H ) */
+
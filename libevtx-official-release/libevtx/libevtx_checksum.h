@@ -31,6 +31,8 @@
 extern "C" {
 #endif
 
+extern int libevtx_checksum_crc32_table_computed;
+
 void libevtx_checksum_initialize_crc32_table(
       void );
 
@@ -26,12 +26,15 @@
 #include "libevtx_byte_stream.h"
 #include "libevtx_checksum.h"
 #include "libevtx_chunk.h"
+#include "libevtx_chunk_read_ahead.h"
 #include "libevtx_definitions.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcdata.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libcnotify.h"
+#include "libevtx_read_buffer.h"
+#include "libevtx_record_signature.h"
 #include "libevtx_record_values.h"
 
 #include "evtx_chunk.h"
@@ -239,6 +242,7 @@ int libevtx_chunk_read(
 	uint64_t first_event_record_number          = 0;
 	uint64_t last_event_record_identifier       = 0;
 	uint64_t last_event_record_number           = 0;
+	uint64_t maximum_number_of_event_records    = 0;
 	uint64_t number_of_event_records            = 0;
 	uint32_t calculated_checksum                = 0;
 	uint32_t event_records_checksum             = 0;
@@ -247,6 +251,7 @@ int libevtx_chunk_read(
 	uint32_t last_event_record_offset           = 0;
 	uint32_t stored_checksum                    = 0;
 	int entry_index                             = 0;
+	int number_of_preallocated_records          = 0;
 	int result                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT ) || defined( HAVE_VERBOSE_OUTPUT )
@@ -334,25 +339,66 @@ int libevtx_chunk_read(
 		 file_offset );
 	}
 #endif
-	read_count = libbfio_handle_read_buffer_at_offset(
-	              file_io_handle,
-	              chunk->data,
-	              chunk->data_size,
-	              file_offset,
-	              error );
-
-	if( read_count != (ssize_t) chunk->data_size )
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( io_handle->chunk_read_ahead != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
-		 function,
-		 file_offset,
-		 file_offset );
+		result = libevtx_chunk_read_ahead_get_chunk_data(
+		          io_handle->chunk_read_ahead,
+		          file_offset,
+		          chunk->data,
+		          chunk->data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve read-ahead chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
 
-		goto on_error;
+			goto on_error;
+		}
+	}
+#endif
+	if( result == 0 )
+	{
+		if( io_handle->read_buffer != NULL )
+		{
+			read_count = libevtx_read_buffer_read_at_offset(
+			              io_handle->read_buffer,
+			              file_io_handle,
+			              file_offset,
+			              chunk->data,
+			              chunk->data_size,
+			              error );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              chunk->data,
+			              chunk->data_size,
+			              file_offset,
+			              error );
+		}
+
+		if( read_count != (ssize_t) chunk->data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			goto on_error;
+		}
 	}
 	chunk_data      = chunk->data;
 	chunk_data_size = chunk->data_size;
@@ -642,6 +688,36 @@ int libevtx_chunk_read(
 #endif
 			chunk->flags |= LIBEVTX_CHUNK_FLAG_IS_CORRUPTED;
 		}
+		/* Pre-size the records array from the number of event records in the chunk header
+		 * to prevent the array from being resized for every 16 records
+		 */
+		if( first_event_record_number <= last_event_record_number )
+		{
+			calculated_number_of_event_records = last_event_record_number - first_event_record_number + 1;
+			maximum_number_of_event_records    = ( chunk_data_size - chunk_data_offset ) / ( sizeof( evtx_event_record_header_t ) + 4 );
+
+			if( calculated_number_of_event_records > maximum_number_of_event_records )
+			{
+				calculated_number_of_event_records = maximum_number_of_event_records;
+			}
+			number_of_preallocated_records = (int) calculated_number_of_event_records;
+
+			if( libcdata_array_resize(
+			     chunk->records_array,
+			     number_of_preallocated_records,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize records array.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		while( chunk_data_offset <= last_event_record_offset )
 		{
 			if( libevtx_record_values_initialize(
@@ -705,11 +781,30 @@ int libevtx_chunk_read(
 			}
 			chunk_data_offset += record_values->data_size;
 
-			if( libcdata_array_append_entry(
-			     chunk->records_array,
-			     &entry_index,
-			     (intptr_t *) record_values,
-			     error ) != 1 )
+			if( number_of_event_records < (uint64_t) number_of_preallocated_records )
+			{
+				if( libcdata_array_set_entry_by_index(
+				     chunk->records_array,
+				     (int) number_of_event_records,
+				     (intptr_t *) record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set record values: %" PRIu64 " in records array.",
+					 function,
+					 number_of_event_records );
+
+					goto on_error;
+				}
+			}
+			else if( libcdata_array_append_entry(
+			          chunk->records_array,
+			          &entry_index,
+			          (intptr_t *) record_values,
+			          error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
@@ -724,6 +819,26 @@ int libevtx_chunk_read(
 
 			number_of_event_records++;
 		}
+		if( number_of_event_records < (uint64_t) number_of_preallocated_records )
+		{
+			/* The remaining pre-sized entries are empty and are removed
+			 */
+			if( libcdata_array_resize(
+			     chunk->records_array,
+			     (int) number_of_event_records,
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize records array.",
+				 function );
+
+				goto on_error;
+			}
+		}
 		if( first_event_record_number > last_event_record_number )
 		{
 #if defined( HAVE_VERBOSE_OUTPUT )
@@ -802,11 +917,47 @@ int libevtx_chunk_read(
 #endif
 		while( chunk_data_offset < ( chunk_data_size - 4 ) )
 		{
-/* TODO optimize scan ? */
-			if( memory_compare(
-			     &( chunk_data[ chunk_data_offset ] ),
-			     evtx_event_record_signature,
-			     4 ) == 0 )
+			result = libevtx_record_signature_scan(
+			          chunk_data,
+			          chunk_data_size,
+			          chunk_data_offset,
+			          &chunk_data_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan free space for event record signature.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				break;
+			}
+			result = libevtx_record_signature_check_header(
+			          chunk_data,
+			          chunk_data_size,
+			          chunk_data_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to check event record header at offset: %" PRIi64 ".",
+				 function,
+				 file_offset + chunk_data_offset );
+
+				goto on_error;
+			}
+			else if( result != 0 )
 			{
 				if( record_values == NULL )
 				{
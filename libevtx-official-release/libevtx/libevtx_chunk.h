@@ -35,6 +35,8 @@
 extern "C" {
 #endif
 
+extern const uint8_t *evtx_chunk_signature;
+
 typedef struct libevtx_chunk libevtx_chunk_t;
 
 struct libevtx_chunk
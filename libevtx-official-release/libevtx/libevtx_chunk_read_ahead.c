@@ -0,0 +1,984 @@
+/*
+ * Chunk read-ahead functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_chunk_read_ahead.h"
+#include "libevtx_definitions.h"
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_read_buffer.h"
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Creates a chunk read-ahead
+ * Make sure the value chunk_read_ahead is referencing, is set to NULL
+ * The file IO handle is cloned so that the chunks can be read independently of the file
+ * A read buffer size of 0 represents that the chunks are read without a read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_ahead_initialize(
+     libevtx_chunk_read_ahead_t **chunk_read_ahead,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     int depth,
+     size_t read_buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_read_ahead_initialize";
+
+	if( chunk_read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_ahead != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid chunk read-ahead value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( depth <= 0 )
+	 || ( depth > LIBEVTX_CHUNK_READ_AHEAD_MAXIMUM_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( chunk_size == 0 )
+	 || ( chunk_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / depth ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_read_ahead = memory_allocate_structure(
+	                     libevtx_chunk_read_ahead_t );
+
+	if( *chunk_read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create chunk read-ahead.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *chunk_read_ahead,
+	     0,
+	     sizeof( libevtx_chunk_read_ahead_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear chunk read-ahead.",
+		 function );
+
+		memory_free(
+		 *chunk_read_ahead );
+
+		*chunk_read_ahead = NULL;
+
+		return( -1 );
+	}
+	( *chunk_read_ahead )->slots_data = (uint8_t *) memory_allocate(
+	                                                 chunk_size * (size_t) depth );
+
+	if( ( *chunk_read_ahead )->slots_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots data.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_read_ahead )->slot_offsets = (off64_t *) memory_allocate(
+	                                                   sizeof( off64_t ) * (size_t) depth );
+
+	if( ( *chunk_read_ahead )->slot_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_read_ahead )->slot_states = (uint8_t *) memory_allocate(
+	                                                  sizeof( uint8_t ) * (size_t) depth );
+
+	if( ( *chunk_read_ahead )->slot_states == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slot states.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *chunk_read_ahead )->slot_states,
+	     LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED,
+	     sizeof( uint8_t ) * (size_t) depth ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slot states.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_clone(
+	     &( ( *chunk_read_ahead )->file_io_handle ),
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     ( *chunk_read_ahead )->file_io_handle,
+	     &( ( *chunk_read_ahead )->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( read_buffer_size > 0 )
+	{
+		if( libevtx_read_buffer_initialize(
+		     &( ( *chunk_read_ahead )->read_buffer ),
+		     read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *chunk_read_ahead )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *chunk_read_ahead )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	( *chunk_read_ahead )->chunk_size         = chunk_size;
+	( *chunk_read_ahead )->depth              = depth;
+	( *chunk_read_ahead )->read_thread_active = 1;
+
+	if( libcthreads_thread_create(
+	     &( ( *chunk_read_ahead )->read_thread ),
+	     NULL,
+	     (int (*)(void *)) &libevtx_chunk_read_ahead_read_thread_function,
+	     (void *) *chunk_read_ahead,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create read thread.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *chunk_read_ahead != NULL )
+	{
+		if( ( *chunk_read_ahead )->condition != NULL )
+		{
+			libcthreads_condition_free(
+			 &( ( *chunk_read_ahead )->condition ),
+			 NULL );
+		}
+		if( ( *chunk_read_ahead )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *chunk_read_ahead )->mutex ),
+			 NULL );
+		}
+		if( ( *chunk_read_ahead )->read_buffer != NULL )
+		{
+			libevtx_read_buffer_free(
+			 &( ( *chunk_read_ahead )->read_buffer ),
+			 NULL );
+		}
+		if( ( *chunk_read_ahead )->file_io_handle != NULL )
+		{
+			libbfio_handle_free(
+			 &( ( *chunk_read_ahead )->file_io_handle ),
+			 NULL );
+		}
+		if( ( *chunk_read_ahead )->slot_states != NULL )
+		{
+			memory_free(
+			 ( *chunk_read_ahead )->slot_states );
+		}
+		if( ( *chunk_read_ahead )->slot_offsets != NULL )
+		{
+			memory_free(
+			 ( *chunk_read_ahead )->slot_offsets );
+		}
+		if( ( *chunk_read_ahead )->slots_data != NULL )
+		{
+			memory_free(
+			 ( *chunk_read_ahead )->slots_data );
+		}
+		memory_free(
+		 *chunk_read_ahead );
+
+		*chunk_read_ahead = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a chunk read-ahead
+ * This stops the read thread before the chunk read-ahead is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_ahead_free(
+     libevtx_chunk_read_ahead_t **chunk_read_ahead,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_read_ahead_free";
+	int result            = 1;
+
+	if( chunk_read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( *chunk_read_ahead != NULL )
+	{
+		if( ( *chunk_read_ahead )->read_thread != NULL )
+		{
+			if( libcthreads_mutex_grab(
+			     ( *chunk_read_ahead )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				return( -1 );
+			}
+			( *chunk_read_ahead )->stop_read_thread = 1;
+
+			if( libcthreads_condition_broadcast(
+			     ( *chunk_read_ahead )->condition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to broadcast condition.",
+				 function );
+
+				result = -1;
+			}
+			if( libcthreads_mutex_release(
+			     ( *chunk_read_ahead )->mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release mutex.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcthreads_thread_join(
+			     &( ( *chunk_read_ahead )->read_thread ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libcthreads_condition_free(
+		     &( ( *chunk_read_ahead )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *chunk_read_ahead )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *chunk_read_ahead )->read_buffer != NULL )
+		{
+			if( libevtx_read_buffer_free(
+			     &( ( *chunk_read_ahead )->read_buffer ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read buffer.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libbfio_handle_free(
+		     &( ( *chunk_read_ahead )->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *chunk_read_ahead )->slot_states );
+
+		memory_free(
+		 ( *chunk_read_ahead )->slot_offsets );
+
+		memory_free(
+		 ( *chunk_read_ahead )->slots_data );
+
+		memory_free(
+		 *chunk_read_ahead );
+
+		*chunk_read_ahead = NULL;
+	}
+	return( result );
+}
+
+/* Reads the pending slots of the chunk read-ahead, in order of their chunk offset
+ * This function runs in the read thread until the read thread is signalled to stop
+ * A slot that cannot be read is marked as failed, so that the chunk is read
+ * by the caller instead
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_ahead_read_thread_function(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libevtx_chunk_read_ahead_read_thread_function";
+	off64_t slot_offset      = 0;
+	ssize_t read_count       = 0;
+	int read_slot_index      = 0;
+	int slot_index           = 0;
+
+	if( chunk_read_ahead == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_read_ahead->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		chunk_read_ahead->read_thread_active = 0;
+
+		goto on_error;
+	}
+	while( chunk_read_ahead->stop_read_thread == 0 )
+	{
+		read_slot_index = -1;
+
+		for( slot_index = 0;
+		     slot_index < chunk_read_ahead->depth;
+		     slot_index++ )
+		{
+			if( chunk_read_ahead->slot_states[ slot_index ] != LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_PENDING )
+			{
+				continue;
+			}
+			if( ( read_slot_index == -1 )
+			 || ( chunk_read_ahead->slot_offsets[ slot_index ] < chunk_read_ahead->slot_offsets[ read_slot_index ] ) )
+			{
+				read_slot_index = slot_index;
+			}
+		}
+		if( read_slot_index == -1 )
+		{
+			if( libcthreads_condition_wait(
+			     chunk_read_ahead->condition,
+			     chunk_read_ahead->mutex,
+			     &error ) != 1 )
+			{
+				libcerror_error_set(
+				 &error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to wait for condition.",
+				 function );
+
+				break;
+			}
+			continue;
+		}
+		chunk_read_ahead->slot_states[ read_slot_index ] = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READING;
+
+		slot_offset = chunk_read_ahead->slot_offsets[ read_slot_index ];
+
+		/* The data of a slot that is being read is only accessed by the read thread
+		 * so the mutex is not held while reading
+		 */
+		if( libcthreads_mutex_release(
+		     chunk_read_ahead->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			chunk_read_ahead->read_thread_active = 0;
+
+			goto on_error;
+		}
+		if( chunk_read_ahead->read_buffer != NULL )
+		{
+			read_count = libevtx_read_buffer_read_at_offset(
+			              chunk_read_ahead->read_buffer,
+			              chunk_read_ahead->file_io_handle,
+			              slot_offset,
+			              &( chunk_read_ahead->slots_data[ read_slot_index * chunk_read_ahead->chunk_size ] ),
+			              chunk_read_ahead->chunk_size,
+			              &error );
+		}
+		else
+		{
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              chunk_read_ahead->file_io_handle,
+			              &( chunk_read_ahead->slots_data[ read_slot_index * chunk_read_ahead->chunk_size ] ),
+			              chunk_read_ahead->chunk_size,
+			              slot_offset,
+			              &error );
+		}
+
+		if( error != NULL )
+		{
+			libcerror_error_free(
+			 &error );
+		}
+		if( libcthreads_mutex_grab(
+		     chunk_read_ahead->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			chunk_read_ahead->read_thread_active = 0;
+
+			goto on_error;
+		}
+		if( read_count == (ssize_t) chunk_read_ahead->chunk_size )
+		{
+			chunk_read_ahead->slot_states[ read_slot_index ] = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READ;
+		}
+		else
+		{
+			chunk_read_ahead->slot_states[ read_slot_index ] = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_FAILED;
+		}
+		if( libcthreads_condition_broadcast(
+		     chunk_read_ahead->condition,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			break;
+		}
+	}
+	chunk_read_ahead->read_thread_active = 0;
+
+	/* Wake up a caller that is waiting for a slot
+	 */
+	libcthreads_condition_broadcast(
+	 chunk_read_ahead->condition,
+	 NULL );
+
+	libcthreads_mutex_release(
+	 chunk_read_ahead->mutex,
+	 NULL );
+
+	if( error != NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Schedules the chunks that follow file offset to be read ahead
+ * Slots that contain chunks outside the read-ahead window are reused
+ * The mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunk_read_ahead_schedule(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead,
+     off64_t file_offset,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_chunk_read_ahead_schedule";
+	off64_t chunk_offset       = 0;
+	off64_t window_end_offset  = 0;
+	int free_slot_index        = 0;
+	int is_scheduled           = 0;
+	int slot_index             = 0;
+
+	if( chunk_read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	window_end_offset = file_offset + (off64_t) ( chunk_read_ahead->chunk_size * (size_t) chunk_read_ahead->depth );
+
+	for( slot_index = 0;
+	     slot_index < chunk_read_ahead->depth;
+	     slot_index++ )
+	{
+		if( ( chunk_read_ahead->slot_states[ slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED )
+		 || ( chunk_read_ahead->slot_states[ slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READING ) )
+		{
+			continue;
+		}
+		if( ( chunk_read_ahead->slot_offsets[ slot_index ] < file_offset )
+		 || ( chunk_read_ahead->slot_offsets[ slot_index ] >= window_end_offset ) )
+		{
+			chunk_read_ahead->slot_states[ slot_index ] = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED;
+		}
+	}
+	free_slot_index = 0;
+
+	for( chunk_offset = file_offset;
+	     chunk_offset < window_end_offset;
+	     chunk_offset += (off64_t) chunk_read_ahead->chunk_size )
+	{
+		if( ( (size64_t) chunk_offset + chunk_read_ahead->chunk_size ) > chunk_read_ahead->file_size )
+		{
+			break;
+		}
+		is_scheduled = 0;
+
+		for( slot_index = 0;
+		     slot_index < chunk_read_ahead->depth;
+		     slot_index++ )
+		{
+			if( ( chunk_read_ahead->slot_states[ slot_index ] != LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED )
+			 && ( chunk_read_ahead->slot_offsets[ slot_index ] == chunk_offset ) )
+			{
+				is_scheduled = 1;
+
+				break;
+			}
+		}
+		if( is_scheduled != 0 )
+		{
+			continue;
+		}
+		while( free_slot_index < chunk_read_ahead->depth )
+		{
+			if( chunk_read_ahead->slot_states[ free_slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED )
+			{
+				break;
+			}
+			free_slot_index++;
+		}
+		if( free_slot_index >= chunk_read_ahead->depth )
+		{
+			break;
+		}
+		chunk_read_ahead->slot_offsets[ free_slot_index ] = chunk_offset;
+		chunk_read_ahead->slot_states[ free_slot_index ]  = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_PENDING;
+	}
+	if( libcthreads_condition_broadcast(
+	     chunk_read_ahead->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the data of the chunk at a specific offset from the read-ahead slots
+ * Waits for the read thread if the chunk is being read ahead and afterwards
+ * schedules the chunks that follow the chunk to be read ahead
+ * Returns 1 if successful, 0 if the chunk data is not available or -1 on error
+ */
+int libevtx_chunk_read_ahead_get_chunk_data(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead,
+     off64_t file_offset,
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunk_read_ahead_get_chunk_data";
+	int result            = 0;
+	int slot_index        = 0;
+
+	if( chunk_read_ahead == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk read-ahead.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size != chunk_read_ahead->chunk_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid chunk data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     chunk_read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		for( slot_index = 0;
+		     slot_index < chunk_read_ahead->depth;
+		     slot_index++ )
+		{
+			if( ( chunk_read_ahead->slot_states[ slot_index ] != LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED )
+			 && ( chunk_read_ahead->slot_offsets[ slot_index ] == file_offset ) )
+			{
+				break;
+			}
+		}
+		if( slot_index >= chunk_read_ahead->depth )
+		{
+			slot_index = -1;
+
+			break;
+		}
+		if( ( chunk_read_ahead->slot_states[ slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READ )
+		 || ( chunk_read_ahead->slot_states[ slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_FAILED )
+		 || ( chunk_read_ahead->read_thread_active == 0 ) )
+		{
+			break;
+		}
+		if( libcthreads_condition_wait(
+		     chunk_read_ahead->condition,
+		     chunk_read_ahead->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( slot_index != -1 );
+
+	if( slot_index != -1 )
+	{
+		if( chunk_read_ahead->slot_states[ slot_index ] == LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READ )
+		{
+			if( memory_copy(
+			     chunk_data,
+			     &( chunk_read_ahead->slots_data[ slot_index * chunk_read_ahead->chunk_size ] ),
+			     chunk_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy chunk data.",
+				 function );
+
+				goto on_error;
+			}
+			result = 1;
+		}
+		if( chunk_read_ahead->slot_states[ slot_index ] != LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_READING )
+		{
+			chunk_read_ahead->slot_states[ slot_index ] = LIBEVTX_CHUNK_READ_AHEAD_SLOT_STATE_UNUSED;
+		}
+	}
+	if( result != 0 )
+	{
+		chunk_read_ahead->number_of_hits += 1;
+	}
+	else
+	{
+		chunk_read_ahead->number_of_misses += 1;
+	}
+	if( chunk_read_ahead->read_thread_active != 0 )
+	{
+		if( libevtx_chunk_read_ahead_schedule(
+		     chunk_read_ahead,
+		     file_offset + (off64_t) chunk_read_ahead->chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to schedule read-ahead of chunks.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     chunk_read_ahead->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+
+on_error:
+	libcthreads_mutex_release(
+	 chunk_read_ahead->mutex,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,142 @@
+/*
+ * Chunk read-ahead functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_CHUNK_READ_AHEAD_H )
+#define _LIBEVTX_CHUNK_READ_AHEAD_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_read_buffer.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum read-ahead depth, which is the number of chunks that can be read ahead
+ */
+#define LIBEVTX_CHUNK_READ_AHEAD_MAXIMUM_DEPTH			64
+
+typedef struct libevtx_chunk_read_ahead libevtx_chunk_read_ahead_t;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+struct libevtx_chunk_read_ahead
+{
+	/* The file IO handle, which is a clone of the file IO handle of the file
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The read buffer of the file IO handle
+	 */
+	libevtx_read_buffer_t *read_buffer;
+
+	/* The file size
+	 */
+	size64_t file_size;
+
+	/* The chunk size
+	 */
+	size_t chunk_size;
+
+	/* The read-ahead depth, which is the number of slots
+	 */
+	int depth;
+
+	/* The data of the slots
+	 */
+	uint8_t *slots_data;
+
+	/* The chunk file offset of each slot
+	 */
+	off64_t *slot_offsets;
+
+	/* The state of each slot
+	 */
+	uint8_t *slot_states;
+
+	/* The number of chunks that were provided from a slot
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of chunks that were not available in a slot
+	 */
+	uint64_t number_of_misses;
+
+	/* Value to indicate the read thread should stop
+	 */
+	uint8_t stop_read_thread;
+
+	/* Value to indicate the read thread is active
+	 */
+	uint8_t read_thread_active;
+
+	/* The mutex that protects the slot offsets and states
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change in the slot states
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The read thread
+	 */
+	libcthreads_thread_t *read_thread;
+};
+
+int libevtx_chunk_read_ahead_initialize(
+     libevtx_chunk_read_ahead_t **chunk_read_ahead,
+     libbfio_handle_t *file_io_handle,
+     size_t chunk_size,
+     int depth,
+     size_t read_buffer_size,
+     libcerror_error_t **error );
+
+int libevtx_chunk_read_ahead_free(
+     libevtx_chunk_read_ahead_t **chunk_read_ahead,
+     libcerror_error_t **error );
+
+int libevtx_chunk_read_ahead_read_thread_function(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead );
+
+int libevtx_chunk_read_ahead_schedule(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead,
+     off64_t file_offset,
+     libcerror_error_t **error );
+
+int libevtx_chunk_read_ahead_get_chunk_data(
+     libevtx_chunk_read_ahead_t *chunk_read_ahead,
+     off64_t file_offset,
+     uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_CHUNK_READ_AHEAD_H ) */
+
@@ -0,0 +1,297 @@
+/*
+ * Chunk signature functions
+ *
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+
+#define LIBEVTX_CHUNK_SIGNATURE_HAVE_SSE2
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON )
+#include <arm_neon.h>
+
+#define LIBEVTX_CHUNK_SIGNATURE_HAVE_NEON
+
+#endif
+
+#include "libevtx_checksum.h"
+#include "libevtx_chunk.h"
+#include "libevtx_chunk_signature.h"
+#include "libevtx_libcerror.h"
+
+#include "evtx_chunk.h"
+
+/* Scans the data for the next chunk signature
+ * Every byte offset from the data offset is scanned, where blocks of 16 offsets
+ * are skipped by a single SIMD comparison of the first, fourth and last byte
+ * of the signature if available
+ * Returns 1 if a signature was found, 0 if not or -1 on error
+ */
+int libevtx_chunk_signature_scan(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     size_t *signature_offset,
+     libcerror_error_t **error )
+{
+	static char *function  = "libevtx_chunk_signature_scan";
+
+#if defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_SSE2 )
+	__m128i first_values   = _mm_setzero_si128();
+	__m128i fourth_values  = _mm_setzero_si128();
+	__m128i last_values    = _mm_setzero_si128();
+	__m128i first_byte     = _mm_set1_epi8( 'E' );
+	__m128i fourth_byte    = _mm_set1_epi8( 'C' );
+	__m128i last_byte      = _mm_setzero_si128();
+
+#elif defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_NEON )
+	uint8x16_t first_values;
+	uint8x16_t fourth_values;
+	uint8x16_t last_values;
+#endif
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < 8 )
+	{
+		return( 0 );
+	}
+	while( data_offset <= ( data_size - 8 ) )
+	{
+#if defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_SSE2 ) || defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_NEON )
+		/* The 16 offsets are skipped if none of them contains the first, fourth
+		 * and last byte of the signature
+		 */
+		if( ( data_size - data_offset ) >= ( 16 + 7 ) )
+		{
+#if defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_SSE2 )
+			first_values  = _mm_loadu_si128(
+			                 (__m128i *) &( data[ data_offset ] ) );
+			fourth_values = _mm_loadu_si128(
+			                 (__m128i *) &( data[ data_offset + 3 ] ) );
+			last_values   = _mm_loadu_si128(
+			                 (__m128i *) &( data[ data_offset + 7 ] ) );
+
+			first_values = _mm_and_si128(
+			                _mm_and_si128(
+			                 _mm_cmpeq_epi8(
+			                  first_values,
+			                  first_byte ),
+			                 _mm_cmpeq_epi8(
+			                  fourth_values,
+			                  fourth_byte ) ),
+			                _mm_cmpeq_epi8(
+			                 last_values,
+			                 last_byte ) );
+
+			if( _mm_movemask_epi8(
+			     first_values ) == 0 )
+			{
+				data_offset += 16;
+
+				continue;
+			}
+#elif defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_NEON )
+			first_values  = vld1q_u8(
+			                 &( data[ data_offset ] ) );
+			fourth_values = vld1q_u8(
+			                 &( data[ data_offset + 3 ] ) );
+			last_values   = vld1q_u8(
+			                 &( data[ data_offset + 7 ] ) );
+
+			first_values = vandq_u8(
+			                vandq_u8(
+			                 vceqq_u8(
+			                  first_values,
+			                  vdupq_n_u8( 'E' ) ),
+			                 vceqq_u8(
+			                  fourth_values,
+			                  vdupq_n_u8( 'C' ) ) ),
+			                vceqq_u8(
+			                 last_values,
+			                 vdupq_n_u8( 0 ) ) );
+
+			if( vmaxvq_u8(
+			     first_values ) == 0 )
+			{
+				data_offset += 16;
+
+				continue;
+			}
+#endif
+		}
+#endif /* defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_SSE2 ) || defined( LIBEVTX_CHUNK_SIGNATURE_HAVE_NEON ) */
+
+		if( ( data[ data_offset ] == evtx_chunk_signature[ 0 ] )
+		 && ( memory_compare(
+		       &( data[ data_offset ] ),
+		       evtx_chunk_signature,
+		       8 ) == 0 ) )
+		{
+			*signature_offset = data_offset;
+
+			return( 1 );
+		}
+		data_offset++;
+	}
+	return( 0 );
+}
+
+/* Checks if the chunk header at the data offset is valid
+ * The header size and the CRC-32 checksum of the chunk header are checked
+ * without setting an error, so that false positive signatures can be skipped
+ * Returns 1 if valid, 0 if not or -1 on error
+ */
+int libevtx_chunk_signature_check_header(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     libcerror_error_t **error )
+{
+	const evtx_chunk_header_t *chunk_header = NULL;
+	static char *function                   = "libevtx_chunk_signature_check_header";
+	uint32_t calculated_checksum            = 0;
+	uint32_t header_size                    = 0;
+	uint32_t stored_checksum                = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_offset >= data_size )
+	 || ( ( data_size - data_offset ) < 512 ) )
+	{
+		return( 0 );
+	}
+	chunk_header = (const evtx_chunk_header_t *) &( data[ data_offset ] );
+
+	if( memory_compare(
+	     chunk_header->signature,
+	     evtx_chunk_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 chunk_header->header_size,
+	 header_size );
+
+	if( header_size != 128 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 chunk_header->checksum,
+	 stored_checksum );
+
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ data_offset ] ),
+	     120,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_checksum_calculate_little_endian_crc32(
+	     &calculated_checksum,
+	     (uint8_t *) &( data[ data_offset + 128 ] ),
+	     384,
+	     calculated_checksum,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to calculate CRC-32 checksum.",
+		 function );
+
+		return( -1 );
+	}
+	if( stored_checksum != calculated_checksum )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -30,8 +30,9 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_decoder.h"
 #include "libevtx_record_values.h"
-#include "libevtx_unused.h"
+#include "libevtx_records_cache.h"
 
 /* Creates a chunks table
  * Make sure the value chunks_table is referencing, is set to NULL
@@ -148,6 +149,19 @@ int libevtx_chunks_table_free(
 	}
 	if( *chunks_table != NULL )
 	{
+		if( libevtx_chunks_table_free_decoded_records(
+		     *chunks_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decoded records.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *chunks_table );
 
@@ -156,68 +170,107 @@ int libevtx_chunks_table_free(
 	return( result );
 }
 
-/* Reads a chunk
- * Callback function for the chunk vector
+/* Retrieves the chunk and the record values, as managed by the chunk, of the record at a specific offset in a chunk
+ * Only the record header is read, the XML document of the record values is not read
  * Returns 1 if successful or -1 on error
  */
-int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+int libevtx_chunks_table_get_chunk_record_values(
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int data_range_file_index LIBEVTX_ATTRIBUTE_UNUSED,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags LIBEVTX_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBEVTX_ATTRIBUTE_UNUSED,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_chunk_t **chunk,
+     libevtx_record_values_t **chunk_record_values,
      libcerror_error_t **error )
 {
-	libevtx_chunk_t *chunk                       = NULL;
-	libevtx_chunks_table_t *chunks_table         = NULL;
-	libevtx_record_values_t *chunk_record_values = NULL;
-	libevtx_record_values_t *record_values       = NULL;
-	static char *function                        = "libevtx_io_handle_read_chunk";
+	libevtx_chunk_t *safe_chunk                  = NULL;
+	libevtx_record_values_t *safe_record_values  = NULL;
+	static char *function                        = "libevtx_chunks_table_get_chunk_record_values";
 	size_t calculated_chunk_data_offset          = 0;
 	size_t chunk_data_offset                     = 0;
+	off64_t record_offset                        = 0;
+	uint64_t number_of_chunks_read               = 0;
 	uint16_t number_of_records                   = 0;
 	uint16_t record_index                        = 0;
+	uint16_t record_index_end                    = 0;
+	uint16_t record_index_start                  = 0;
+	int number_of_cache_values                   = 0;
+	int number_of_cached_chunks                  = 0;
 
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_file_index );
-	LIBEVTX_UNREFERENCED_PARAMETER( data_range_flags );
-	LIBEVTX_UNREFERENCED_PARAMETER( read_flags );
-
-	if( io_handle == NULL )
+	if( chunks_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid IO handle.",
+		 "%s: invalid chunks table.",
 		 function );
 
 		return( -1 );
 	}
-	chunks_table = (libevtx_chunks_table_t *) io_handle;
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
 
-	/* The chunk index is stored in the data range size
-	*/
-	if( data_range_size > (uint64_t) UINT16_MAX )
+		return( -1 );
+	}
+	if( chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid data range size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
 		 function );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( chunk_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk record values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunks are stored consecutively after the file header
+	 */
+	record_offset = chunks_table->io_handle->chunks_data_offset
+	              + ( (off64_t) chunk_index * chunks_table->io_handle->chunk_size )
+	              + record_chunk_data_offset;
+
+	/* The chunk is read by libevtx_io_handle_read_chunk when it is not cached
+	 */
+	number_of_chunks_read = chunks_table->io_handle->number_of_chunks_read;
+
+	if( libfcache_cache_get_number_of_cache_values(
+	     chunks_table->chunks_cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of chunks cache values.",
+		 function );
+
+		return( -1 );
 	}
 	if( libfdata_vector_get_element_value_by_index(
 	     chunks_table->chunks_vector,
 	     (intptr_t *) file_io_handle,
 	     (libfdata_cache_t *) chunks_table->chunks_cache,
-	     (uint16_t) data_range_size,
-	     (intptr_t **) &chunk,
+	     (int) chunk_index,
+	     (intptr_t **) &safe_chunk,
 	     0,
 	     error ) != 1 )
 	{
@@ -225,26 +278,55 @@ int libevtx_chunks_table_read_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve chunk: %" PRIu64 ".",
+		 "%s: unable to retrieve chunk: %" PRIu32 ".",
 		 function,
-		 data_range_size );
+		 chunk_index );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( chunk == NULL )
+	if( safe_chunk == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing chunk: %" PRIu64 ".",
+		 "%s: missing chunk: %" PRIu32 ".",
 		 function,
-		 data_range_size );
+		 chunk_index );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( chunks_table->io_handle->number_of_chunks_read == number_of_chunks_read )
+	{
+		chunks_table->number_of_cache_hits += 1;
+	}
+	else
+	{
+		chunks_table->number_of_cache_misses += 1;
+
+		if( libfcache_cache_get_number_of_cache_values(
+		     chunks_table->chunks_cache,
+		     &number_of_cached_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of chunks cache values.",
+			 function );
+
+			return( -1 );
+		}
+		/* The chunk replaced a cached chunk if the number of cache values did not increase
+		 */
+		if( number_of_cached_chunks <= number_of_cache_values )
+		{
+			chunks_table->number_of_cache_evictions += 1;
+		}
 	}
-	if( ( data_range_offset < chunk->file_offset )
-	 || ( data_range_offset >= (off64_t) ( chunk->file_offset + chunk->data_size ) ) )
+	if( ( record_offset < safe_chunk->file_offset )
+	 || ( record_offset >= (off64_t) ( safe_chunk->file_offset + safe_chunk->data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -253,12 +335,12 @@ int libevtx_chunks_table_read_record(
 		 "%s: invalid chunk file offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	calculated_chunk_data_offset = (size_t) ( data_range_offset - chunk->file_offset );
+	calculated_chunk_data_offset = (size_t) record_chunk_data_offset;
 
 	if( libevtx_chunk_get_number_of_records(
-	     chunk,
+	     safe_chunk,
 	     &number_of_records,
 	     error ) != 1 )
 	{
@@ -269,17 +351,21 @@ int libevtx_chunks_table_read_record(
 		 "%s: unable to retrieve number of records from chunk.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-/* TODO optimize determining the corresponding record */
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	/* The records are stored in order of their chunk data offset
+	 */
+	record_index_start = 0;
+	record_index_end   = number_of_records;
+
+	while( record_index_start < record_index_end )
 	{
+		record_index = record_index_start + ( ( record_index_end - record_index_start ) / 2 );
+
 		if( libevtx_chunk_get_record(
-		     chunk,
+		     safe_chunk,
 		     record_index,
-		     &chunk_record_values,
+		     &safe_record_values,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -290,9 +376,9 @@ int libevtx_chunks_table_read_record(
 			 function,
 			 record_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( chunk_record_values == NULL )
+		if( safe_record_values == NULL )
 		{
 			libcerror_error_set(
 			 error,
@@ -302,20 +388,28 @@ int libevtx_chunks_table_read_record(
 			 function,
 			 record_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		chunk_data_offset = chunk_record_values->chunk_data_offset;
+		chunk_data_offset = safe_record_values->chunk_data_offset;
 
 		if( calculated_chunk_data_offset == chunk_data_offset )
 		{
 			break;
 		}
+		else if( calculated_chunk_data_offset < chunk_data_offset )
+		{
+			record_index_end = record_index;
+		}
+		else
+		{
+			record_index_start = record_index + 1;
+		}
 	}
 /* TODO allow to control look up in normal vs recovered */
 	if( calculated_chunk_data_offset != chunk_data_offset )
 	{
 		if( libevtx_chunk_get_number_of_recovered_records(
-		     chunk,
+		     safe_chunk,
 		     &number_of_records,
 		     error ) != 1 )
 		{
@@ -326,16 +420,16 @@ int libevtx_chunks_table_read_record(
 			 "%s: unable to retrieve number of recovered records from chunk.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
 		for( record_index = 0;
 		     record_index < number_of_records;
 		     record_index++ )
 		{
 			if( libevtx_chunk_get_recovered_record(
-			     chunk,
+			     safe_chunk,
 			     record_index,
-			     &chunk_record_values,
+			     &safe_record_values,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -346,9 +440,9 @@ int libevtx_chunks_table_read_record(
 				 function,
 				 record_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			if( chunk_record_values == NULL )
+			if( safe_record_values == NULL )
 			{
 				libcerror_error_set(
 				 error,
@@ -358,9 +452,9 @@ int libevtx_chunks_table_read_record(
 				 function,
 				 record_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			chunk_data_offset = chunk_record_values->chunk_data_offset;
+			chunk_data_offset = safe_record_values->chunk_data_offset;
 
 			if( calculated_chunk_data_offset == chunk_data_offset )
 			{
@@ -376,71 +470,840 @@ int libevtx_chunks_table_read_record(
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 		 "%s: no record found at offset: %" PRIi64 ".",
 		 function,
-		 data_range_offset );
+		 record_offset );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* The record values are managed by the chunk and freed after usage
-	 * A copy is created to make sure that the records values that are passed
-	 * to the records list can be managed by the list
-	 */
-	if( libevtx_record_values_clone(
-	     &record_values,
-	     chunk_record_values,
-	     error ) != 1 )
+	*chunk               = safe_chunk;
+	*chunk_record_values = safe_record_values;
+
+	return( 1 );
+}
+
+/* Retrieves the record values of the record at a specific offset in a chunk
+ * The record values are read on demand and stored in the records cache
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_get_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     libevtx_records_cache_t *records_cache,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_record_values_t *chunk_record_values = NULL;
+	libevtx_record_values_t *safe_record_values  = NULL;
+	static char *function                        = "libevtx_chunks_table_get_record_values";
+	off64_t record_offset                        = 0;
+	int result                                   = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record values.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libevtx_record_values_read_xml_document(
-	     record_values,
-	     chunks_table->io_handle,
-	     chunk->data,
-	     chunk->data_size,
-	     error ) != 1 )
+	if( record_values == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record values XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunks are stored consecutively after the file header
+	 */
+	record_offset = chunks_table->io_handle->chunks_data_offset
+	              + ( (off64_t) chunk_index * chunks_table->io_handle->chunk_size )
+	              + record_chunk_data_offset;
+
+	result = libevtx_records_cache_get_record_values(
+	          records_cache,
+	          record_offset,
+	          record_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values from records cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_list_element_set_element_value(
-	     list_element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) record_values,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_record_values_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( chunks_table->record_decoder != NULL )
+	{
+		result = libevtx_chunks_table_get_decoded_record_values(
+		          chunks_table,
+		          record_offset,
+		          &safe_record_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve decoded record values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	if( result == 0 )
+	{
+		if( libevtx_chunks_table_get_chunk_record_values(
+		     chunks_table,
+		     file_io_handle,
+		     chunk_index,
+		     record_chunk_data_offset,
+		     &chunk,
+		     &chunk_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values from chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+		if( chunks_table->record_decoder != NULL )
+		{
+			result = libevtx_chunks_table_decode_chunk_records(
+			          chunks_table,
+			          records_cache,
+			          chunk,
+			          chunk_record_values,
+			          &safe_record_values,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to decode records of chunk: %" PRIu32 ".",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+		}
+#endif
+	}
+	if( result == 0 )
+	{
+		/* The record values are managed by the chunk and freed after usage
+		 * A copy is created to make sure that the records values that are passed
+		 * to the records list can be managed by the list
+		 */
+		if( libevtx_record_values_clone(
+		     &safe_record_values,
+		     chunk_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_values_read_xml_document(
+		     safe_record_values,
+		     chunks_table->io_handle,
+		     chunk->data,
+		     chunk->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values XML document.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_records_cache_set_record_values(
+	     records_cache,
+	     record_offset,
+	     safe_record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set record values as element value.",
+		 "%s: unable to set record values in records cache.",
 		 function );
 
 		goto on_error;
 	}
+	*record_values = safe_record_values;
+
 	return( 1 );
 
 on_error:
-	if( record_values != NULL )
+	if( safe_record_values != NULL )
 	{
 		libevtx_record_values_free(
-		 &record_values,
+		 &safe_record_values,
 		 NULL );
 	}
 	return( -1 );
 }
 
+/* Frees the record values that were decoded ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_free_decoded_records(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunks_table_free_decoded_records";
+	int record_index      = 0;
+	int result            = 1;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < chunks_table->number_of_decoded_records;
+	     record_index++ )
+	{
+		if( chunks_table->decoded_records_values[ record_index ] != NULL )
+		{
+			if( libevtx_record_values_free(
+			     &( chunks_table->decoded_records_values[ record_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values: %d.",
+				 function,
+				 record_index );
+
+				result = -1;
+			}
+		}
+	}
+	chunks_table->number_of_decoded_records = 0;
+
+	return( result );
+}
+
+/* Retrieves the record values at a specific offset that were decoded ahead
+ * The record values are removed from the decoded records and are managed by the caller
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_chunks_table_get_decoded_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     off64_t record_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_chunks_table_get_decoded_record_values";
+	int record_index      = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < chunks_table->number_of_decoded_records;
+	     record_index++ )
+	{
+		if( ( chunks_table->decoded_records_values[ record_index ] != NULL )
+		 && ( chunks_table->decoded_record_offsets[ record_index ] == record_offset ) )
+		{
+			*record_values = chunks_table->decoded_records_values[ record_index ];
+
+			chunks_table->decoded_records_values[ record_index ] = NULL;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Decodes the record values of a record and the records that follow it in the same chunk
+ * The records are decoded in parallel by the record decoder, at most
+ * LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS records are decoded and
+ * decoding stops at the first record that is already cached
+ * The record values of the records that follow are kept as decoded records until
+ * they are retrieved, so that they are not stored in the records cache ahead of time
+ * The record values of the record are managed by the caller
+ * Returns 1 if the record values of the record were decoded, 0 if not or -1 on error
+ */
+int libevtx_chunks_table_decode_chunk_records(
+     libevtx_chunks_table_t *chunks_table,
+     libevtx_records_cache_t *records_cache,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *chunk_record_values,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t *records_values[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS ];
+	libevtx_record_values_t *safe_record_values = NULL;
+	static char *function                       = "libevtx_chunks_table_decode_chunk_records";
+	off64_t record_offset                       = 0;
+	uint16_t chunk_record_index                 = 0;
+	uint16_t number_of_chunk_records            = 0;
+	int number_of_records                       = 0;
+	int record_index                            = 0;
+	int result                                  = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunk_get_number_of_records(
+	     chunk,
+	     &number_of_chunk_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records from chunk.",
+		 function );
+
+		return( -1 );
+	}
+	/* Recovered records are not decoded in parallel
+	 */
+	for( chunk_record_index = 0;
+	     chunk_record_index < number_of_chunk_records;
+	     chunk_record_index++ )
+	{
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     chunk_record_index,
+		     &safe_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
+			 function,
+			 chunk_record_index );
+
+			return( -1 );
+		}
+		if( safe_record_values == chunk_record_values )
+		{
+			break;
+		}
+	}
+	if( ( chunk_record_index + 1 ) >= number_of_chunk_records )
+	{
+		return( 0 );
+	}
+	/* The records that were decoded ahead before are replaced
+	 */
+	if( libevtx_chunks_table_free_decoded_records(
+	     chunks_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoded records.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record values of the chunk are copied so that the decoded
+	 * record values can be managed by the records cache
+	 */
+	while( ( number_of_records < LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS )
+	    && ( chunk_record_index < number_of_chunk_records ) )
+	{
+		if( libevtx_chunk_get_record(
+		     chunk,
+		     chunk_record_index,
+		     &safe_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %" PRIu16 " from chunk.",
+			 function,
+			 chunk_record_index );
+
+			goto on_error;
+		}
+		if( number_of_records > 0 )
+		{
+			record_offset = chunk->file_offset + (off64_t) safe_record_values->chunk_data_offset;
+
+			result = libevtx_records_cache_has_record_values(
+			          records_cache,
+			          record_offset,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine if record values are cached.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				break;
+			}
+		}
+		records_values[ number_of_records ] = NULL;
+
+		if( libevtx_record_values_clone(
+		     &( records_values[ number_of_records ] ),
+		     safe_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		number_of_records++;
+		chunk_record_index++;
+	}
+	if( libevtx_record_decoder_decode_records(
+	     chunks_table->record_decoder,
+	     chunks_table->io_handle,
+	     chunk->data,
+	     chunk->data_size,
+	     records_values,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to decode records.",
+		 function );
+
+		goto on_error;
+	}
+	/* A record that could not be decoded is not kept, so that it is read
+	 * on demand and the error is reported
+	 */
+	result = 0;
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		safe_record_values = records_values[ record_index ];
+
+		records_values[ record_index ] = NULL;
+
+		if( safe_record_values->xml_document == NULL )
+		{
+			if( libevtx_record_values_free(
+			     &safe_record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values: %d.",
+				 function,
+				 record_index );
+
+				goto on_error;
+			}
+		}
+		else if( record_index == 0 )
+		{
+			*record_values = safe_record_values;
+
+			result = 1;
+		}
+		else
+		{
+			chunks_table->decoded_records_values[ chunks_table->number_of_decoded_records ] = safe_record_values;
+			chunks_table->decoded_record_offsets[ chunks_table->number_of_decoded_records ] = chunk->file_offset
+			                                                                                + (off64_t) safe_record_values->chunk_data_offset;
+
+			chunks_table->number_of_decoded_records += 1;
+		}
+	}
+	return( result );
+
+on_error:
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( records_values[ record_index ] != NULL )
+		{
+			libevtx_record_values_free(
+			 &( records_values[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the record values of the record at a specific offset in a chunk into existing record values
+ * The records cache is bypassed and the strings arrays of the record values are reused
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_read_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                       = NULL;
+	libevtx_record_values_t *chunk_record_values = NULL;
+	static char *function                        = "libevtx_chunks_table_read_record_values";
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_chunks_table_get_chunk_record_values(
+	     chunks_table,
+	     file_io_handle,
+	     chunk_index,
+	     record_chunk_data_offset,
+	     &chunk,
+	     &chunk_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values from chunk: %" PRIu32 ".",
+		 function,
+		 chunk_index );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_clear(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_copy_header(
+	     record_values,
+	     chunk_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy record values header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_record_values_read_xml_document(
+	     record_values,
+	     chunks_table->io_handle,
+	     chunk->data,
+	     chunk->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the header values of the record at a specific offset in a chunk
+ * The header values are retrieved from the records cache or from the record header
+ * without reading the XML document of the record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_chunks_table_get_record_header_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     libevtx_records_cache_t *records_cache,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     uint32_t *data_size,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_chunks_table_get_record_header_values";
+	off64_t record_offset                  = 0;
+	int result                             = 0;
+
+	if( chunks_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunks table.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunks_table->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid chunks table - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( written_time == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid written time.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	record_offset = chunks_table->io_handle->chunks_data_offset
+	              + ( (off64_t) chunk_index * chunks_table->io_handle->chunk_size )
+	              + record_chunk_data_offset;
+
+	result = libevtx_records_cache_get_record_values(
+	          records_cache,
+	          record_offset,
+	          &record_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values from records cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		if( libevtx_chunks_table_get_chunk_record_values(
+		     chunks_table,
+		     file_io_handle,
+		     chunk_index,
+		     record_chunk_data_offset,
+		     &chunk,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values from chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			return( -1 );
+		}
+	}
+	*identifier   = record_values->identifier;
+	*written_time = record_values->written_time;
+	*data_size    = record_values->data_size;
+
+	return( 1 );
+}
+
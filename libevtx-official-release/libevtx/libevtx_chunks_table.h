@@ -25,16 +25,24 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_chunk.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_record_decoder.h"
+#include "libevtx_record_values.h"
+#include "libevtx_records_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The maximum number of records that are decoded in parallel
+ */
+#define LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS	16
+
 typedef struct libevtx_chunks_table libevtx_chunks_table_t;
 
 struct libevtx_chunks_table
@@ -50,6 +58,34 @@ struct libevtx_chunks_table
 	/* The chunks cache
 	 */
 	libfcache_cache_t *chunks_cache;
+
+	/* The number of chunks cache hits
+	 */
+	uint64_t number_of_cache_hits;
+
+	/* The number of chunks cache misses
+	 */
+	uint64_t number_of_cache_misses;
+
+	/* The number of chunks cache evictions
+	 */
+	uint64_t number_of_cache_evictions;
+
+	/* The record decoder, which is managed by the file
+	 */
+	libevtx_record_decoder_t *record_decoder;
+
+	/* The record values that were decoded ahead of the record that was retrieved
+	 */
+	libevtx_record_values_t *decoded_records_values[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS ];
+
+	/* The offsets of the record values that were decoded ahead
+	 */
+	off64_t decoded_record_offsets[ LIBEVTX_CHUNKS_TABLE_MAXIMUM_NUMBER_OF_DECODED_RECORDS ];
+
+	/* The number of record values that were decoded ahead
+	 */
+	int number_of_decoded_records;
 };
 
 int libevtx_chunks_table_initialize(
@@ -63,16 +99,63 @@ int libevtx_chunks_table_free(
      libevtx_chunks_table_t **chunks_table,
      libcerror_error_t **error );
 
-int libevtx_chunks_table_read_record(
-     intptr_t *io_handle,
+int libevtx_chunks_table_get_chunk_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_chunk_t **chunk,
+     libevtx_record_values_t **chunk_record_values,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_get_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     libevtx_records_cache_t *records_cache,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_free_decoded_records(
+     libevtx_chunks_table_t *chunks_table,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_get_decoded_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     off64_t record_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+int libevtx_chunks_table_decode_chunk_records(
+     libevtx_chunks_table_t *chunks_table,
+     libevtx_records_cache_t *records_cache,
+     libevtx_chunk_t *chunk,
+     libevtx_record_values_t *chunk_record_values,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+int libevtx_chunks_table_read_record_values(
+     libevtx_chunks_table_t *chunks_table,
+     libbfio_handle_t *file_io_handle,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_chunks_table_get_record_header_values(
+     libevtx_chunks_table_t *chunks_table,
      libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *list_element,
-     libfdata_cache_t *cache,
-     int data_range_file_index,
-     off64_t data_range_offset,
-     size64_t data_range_size,
-     uint32_t data_range_flags,
-     uint8_t read_flags,
+     libevtx_records_cache_t *records_cache,
+     uint32_t chunk_index,
+     uint16_t record_chunk_data_offset,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     uint32_t *data_size,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -28,6 +28,7 @@
 #include "libevtx_chunks_table.h"
 #include "libevtx_codepage.h"
 #include "libevtx_chunk.h"
+#include "libevtx_chunk_read_ahead.h"
 #include "libevtx_debug.h"
 #include "libevtx_definitions.h"
 #include "libevtx_i18n.h"
@@ -38,8 +39,11 @@
 #include "libevtx_libcnotify.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_read_buffer.h"
 #include "libevtx_record.h"
+#include "libevtx_record_decoder.h"
 #include "libevtx_record_values.h"
+#include "libevtx_string_table.h"
 
 /* Creates a file
  * Make sure the value file is referencing, is set to NULL
@@ -105,6 +109,9 @@ int libevtx_file_initialize(
 
 		return( -1 );
 	}
+	internal_file->maximum_number_of_cached_chunks  = LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS;
+	internal_file->maximum_number_of_cached_records = LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS;
+
 	if( libevtx_io_handle_initialize(
 	     &( internal_file->io_handle ),
 	     error ) != 1 )
@@ -193,6 +200,24 @@ int libevtx_file_free(
 		}
 		*file = NULL;
 
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+		if( internal_file->record_decoder != NULL )
+		{
+			if( libevtx_record_decoder_free(
+			     &( internal_file->record_decoder ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record decoder.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
 		if( libevtx_io_handle_free(
 		     &( internal_file->io_handle ),
 		     error ) != 1 )
@@ -726,6 +751,56 @@ int libevtx_file_close(
 		}
 	}
 #endif
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_file->chunk_read_ahead != NULL )
+	{
+		if( libevtx_chunk_read_ahead_free(
+		     &( internal_file->chunk_read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk read-ahead.",
+			 function );
+
+			result = -1;
+		}
+	}
+#endif
+	if( internal_file->read_buffer != NULL )
+	{
+		if( libevtx_read_buffer_free(
+		     &( internal_file->read_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read buffer.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_file->string_table != NULL )
+	{
+		if( libevtx_string_table_free(
+		     &( internal_file->string_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free string table.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_file->file_io_handle_opened_in_library != 0 )
 	{
 		if( libbfio_handle_close(
@@ -760,7 +835,11 @@ int libevtx_file_close(
 		}
 		internal_file->file_io_handle_created_in_library = 0;
 	}
-	internal_file->file_io_handle = NULL;
+	internal_file->file_io_handle                      = NULL;
+	internal_file->refresh_chunk_index                 = 0;
+	internal_file->refresh_number_of_chunks            = 0;
+	internal_file->refresh_number_of_records           = 0;
+	internal_file->refresh_number_of_recovered_records = 0;
 
 	if( libevtx_io_handle_clear(
 	     internal_file->io_handle,
@@ -775,33 +854,46 @@ int libevtx_file_close(
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->recovered_records_list ),
+	if( libevtx_records_index_free(
+	     &( internal_file->recovered_records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free recovered records list.",
+		 "%s: unable to free recovered records index.",
 		 function );
 
 		result = -1;
 	}
-	if( libfdata_list_free(
-	     &( internal_file->records_list ),
+	if( libevtx_records_index_free(
+	     &( internal_file->records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free records list.",
+		 "%s: unable to free records index.",
 		 function );
 
 		result = -1;
 	}
-	if( libfcache_cache_free(
+	if( libevtx_chunks_table_free(
+	     &( internal_file->chunks_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free chunks table.",
+		 function );
+
+		result = -1;
+	}
+	if( libevtx_records_cache_free(
 	     &( internal_file->records_cache ),
 	     error ) != 1 )
 	{
@@ -851,27 +943,15 @@ int libevtx_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libevtx_chunk_t *chunk                 = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	libevtx_chunks_table_t *chunks_table   = NULL;
-	static char *function                  = "libevtx_file_open_read";
-	off64_t file_offset                    = 0;
-	size64_t file_size                     = 0;
-	uint16_t chunk_index                   = 0;
-	uint16_t number_of_chunks              = 0;
-	uint16_t number_of_records             = 0;
-	uint16_t record_index                  = 0;
-	int element_index                      = 0;
-	int result                             = 0;
-	int segment_index                      = 0;
+	static char *function     = "libevtx_file_open_read";
+	size64_t file_size        = 0;
+	int segment_index         = 0;
 
-#if defined( HAVE_VERBOSE_OUTPUT )
-	uint64_t previous_record_identifier    = 0;
-#endif
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *trailing_data                 = NULL;
-	size_t trailing_data_size              = 0;
-	ssize_t read_count                     = 0;
+	uint8_t *trailing_data    = NULL;
+	off64_t file_offset       = 0;
+	size_t trailing_data_size = 0;
+	ssize_t read_count        = 0;
 #endif
 
 	if( internal_file == NULL )
@@ -918,24 +998,35 @@ int libevtx_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->records_list != NULL )
+	if( internal_file->chunks_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - chunks table already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->records_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - records list already set.",
+		 "%s: invalid file - records index already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	if( internal_file->recovered_records_index != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - recovered records list already set.",
+		 "%s: invalid file - recovered records index already set.",
 		 function );
 
 		return( -1 );
@@ -990,6 +1081,62 @@ int libevtx_file_open_read(
 	internal_file->io_handle->chunks_data_size = file_size
 	                                           - internal_file->io_handle->chunks_data_offset;
 
+	if( internal_file->read_buffer_size > 0 )
+	{
+		if( libevtx_read_buffer_initialize(
+		     &( internal_file->read_buffer ),
+		     internal_file->read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->read_buffer = internal_file->read_buffer;
+	}
+	if( libevtx_string_table_initialize(
+	     &( internal_file->string_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file->io_handle->string_table = internal_file->string_table;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_file->read_ahead_depth > 0 )
+	{
+		if( libevtx_chunk_read_ahead_initialize(
+		     &( internal_file->chunk_read_ahead ),
+		     file_io_handle,
+		     (size_t) internal_file->io_handle->chunk_size,
+		     internal_file->read_ahead_depth,
+		     internal_file->read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk read-ahead.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->chunk_read_ahead = internal_file->chunk_read_ahead;
+	}
+#endif
 /* TODO clone function ? */
 	if( libfdata_vector_initialize(
 	     &( internal_file->chunks_vector ),
@@ -1031,7 +1178,7 @@ int libevtx_file_open_read(
 	}
 	if( libfcache_cache_initialize(
 	     &( internal_file->chunks_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_CHUNKS,
+	     internal_file->maximum_number_of_cached_chunks,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1051,7 +1198,7 @@ int libevtx_file_open_read(
 	}
 #endif
 	if( libevtx_chunks_table_initialize(
-	     &chunks_table,
+	     &( internal_file->chunks_table ),
 	     internal_file->io_handle,
 	     internal_file->chunks_vector,
 	     internal_file->chunks_cache,
@@ -1066,54 +1213,38 @@ int libevtx_file_open_read(
 
 		goto on_error;
 	}
-/* TODO clone function ? */
-	if( libfdata_list_initialize(
-	     &( internal_file->records_list ),
-	     (intptr_t *) chunks_table,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevtx_chunks_table_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	internal_file->chunks_table->record_decoder = internal_file->record_decoder;
+#endif
+	if( libevtx_records_index_initialize(
+	     &( internal_file->records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records list.",
+		 "%s: unable to create records index.",
 		 function );
 
 		goto on_error;
 	}
-	/* The chunks_table is managed by the list */
-
-	if( libfdata_list_initialize(
-	     &( internal_file->recovered_records_list ),
-	     (intptr_t *) chunks_table,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevtx_chunks_table_read_record,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libevtx_records_index_initialize(
+	     &( internal_file->recovered_records_index ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered records list.",
+		 "%s: unable to create recovered records index.",
 		 function );
 
-		chunks_table = NULL;
-
 		goto on_error;
 	}
-	chunks_table = NULL;
-
-	if( libfcache_cache_initialize(
+	if( libevtx_records_cache_initialize(
 	     &( internal_file->records_cache ),
-	     LIBEVTX_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	     internal_file->maximum_number_of_cached_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1125,101 +1256,352 @@ int libevtx_file_open_read(
 
 		goto on_error;
 	}
-	file_offset = internal_file->io_handle->chunks_data_offset;
-
-	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	if( libevtx_file_read_chunks(
+	     internal_file,
+	     file_io_handle,
+	     file_size,
+	     error ) != 1 )
 	{
-		if( libevtx_chunk_initialize(
-		     &chunk,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
-
-			goto on_error;
-		}
-		result = libevtx_chunk_read(
-		          chunk,
-		          internal_file->io_handle,
-		          file_io_handle,
-		          file_offset,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read chunk: %" PRIu16 ".",
-			 function,
-			 chunk_index );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			if( chunk_index < internal_file->io_handle->number_of_chunks )
-			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	file_offset = internal_file->io_handle->chunks_data_offset
+	            + (off64_t) internal_file->io_handle->chunks_data_size;
 #endif
-				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
-			}
-		}
-		else
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( file_offset < (off64_t) file_size )
 		{
-			if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+			trailing_data_size = (size_t) ( file_size - file_offset );
+
+			if( trailing_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 			{
-#if defined( HAVE_VERBOSE_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: corruption detected in chunk: %" PRIu16 ".\n",
-					 function,
-					 chunk_index );
-				}
-#endif
-				if( chunk_index < internal_file->io_handle->number_of_chunks )
-				{
-					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
-				}
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid trailing data size value exceeds maximum allocation size.",
+				 function );
+
+				goto on_error;
 			}
-			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
-			 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
+			trailing_data = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * trailing_data_size );
+
+			if( trailing_data == NULL )
 			{
-				number_of_chunks++;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create trailing data.",
+				 function );
+
+				goto on_error;
 			}
-			if( libevtx_chunk_get_number_of_records(
-			     chunk,
-			     &number_of_records,
-			     error ) != 1 )
+			read_count = libbfio_handle_read_buffer(
+				      file_io_handle,
+				      trailing_data,
+				      trailing_data_size,
+				      error );
+
+			if( read_count != (ssize_t) trailing_data_size )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of records.",
-				 function,
-				 chunk_index );
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read trailing data.",
+				 function );
+
+				memory_free(
+				 trailing_data );
 
 				goto on_error;
 			}
-			for( record_index = 0;
-			     record_index < number_of_records;
-			     record_index++ )
-			{
+			file_offset += read_count;
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 trailing_data,
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			memory_free(
+			 trailing_data );
+
+			trailing_data = NULL;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( trailing_data != NULL )
+	{
+		memory_free(
+		 trailing_data );
+	}
+#endif
+	if( internal_file->records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &( internal_file->records_cache ),
+		 NULL );
+	}
+	if( internal_file->recovered_records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &( internal_file->recovered_records_index ),
+		 NULL );
+	}
+	if( internal_file->records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &( internal_file->records_index ),
+		 NULL );
+	}
+	if( internal_file->chunks_table != NULL )
+	{
+		libevtx_chunks_table_free(
+		 &( internal_file->chunks_table ),
+		 NULL );
+	}
+	if( internal_file->chunks_cache != NULL )
+	{
+		libfcache_cache_free(
+		 &( internal_file->chunks_cache ),
+		 NULL );
+	}
+	if( internal_file->chunks_vector != NULL )
+	{
+		libfdata_vector_free(
+		 &( internal_file->chunks_vector ),
+		 NULL );
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_file->chunk_read_ahead != NULL )
+	{
+		libevtx_chunk_read_ahead_free(
+		 &( internal_file->chunk_read_ahead ),
+		 NULL );
+	}
+	internal_file->io_handle->chunk_read_ahead = NULL;
+#endif
+	if( internal_file->read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 &( internal_file->read_buffer ),
+		 NULL );
+	}
+	internal_file->io_handle->read_buffer = NULL;
+
+	if( internal_file->string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &( internal_file->string_table ),
+		 NULL );
+	}
+	internal_file->io_handle->string_table = NULL;
+
+	return( -1 );
+}
+
+/* Reads the chunks and adds their records to the records indexes
+ * The chunks are read from the refresh chunk index up to the file size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_read_chunks(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error )
+{
+	libevtx_chunk_t *chunk                 = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_read_chunks";
+	off64_t file_offset                    = 0;
+	uint32_t chunk_index                   = 0;
+	uint16_t number_of_chunks              = 0;
+	uint16_t number_of_records             = 0;
+	uint16_t record_index                  = 0;
+	int result                             = 0;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	uint64_t previous_record_identifier    = 0;
+	uint32_t first_chunk_index             = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	chunk_index      = internal_file->refresh_chunk_index;
+	number_of_chunks = internal_file->refresh_number_of_chunks;
+
+#if defined( HAVE_VERBOSE_OUTPUT )
+	first_chunk_index = chunk_index;
+#endif
+
+	file_offset = internal_file->io_handle->chunks_data_offset
+	            + ( (off64_t) chunk_index * internal_file->io_handle->chunk_size );
+
+	while( ( file_offset + internal_file->io_handle->chunk_size ) <= (off64_t) file_size )
+	{
+		if( libevtx_chunk_initialize(
+		     &chunk,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		result = libevtx_chunk_read(
+		          chunk,
+		          internal_file->io_handle,
+		          file_io_handle,
+		          file_offset,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read chunk: %" PRIu32 ".",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( chunk_index < internal_file->io_handle->number_of_chunks )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: corruption detected in chunk: %" PRIu32 ".\n",
+					 function,
+					 chunk_index );
+				}
+#endif
+				internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+			}
+		}
+		else
+		{
+			/* The last chunk that contains data is read again on refresh
+			 * since records can still be appended to it
+			 */
+			if( libevtx_records_index_get_number_of_entries(
+			     internal_file->records_index,
+			     &( internal_file->refresh_number_of_records ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries of records index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevtx_records_index_get_number_of_entries(
+			     internal_file->recovered_records_index,
+			     &( internal_file->refresh_number_of_recovered_records ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of entries of recovered records index.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->refresh_chunk_index      = chunk_index;
+			internal_file->refresh_number_of_chunks = number_of_chunks;
+
+			if( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) != 0 )
+			{
+#if defined( HAVE_VERBOSE_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: corruption detected in chunk: %" PRIu32 ".\n",
+					 function,
+					 chunk_index );
+				}
+#endif
+				if( chunk_index < internal_file->io_handle->number_of_chunks )
+				{
+					internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
+				}
+			}
+			if( ( chunk_index < internal_file->io_handle->number_of_chunks )
+			 || ( ( chunk->flags & LIBEVTX_CHUNK_FLAG_IS_CORRUPTED ) == 0 ) )
+			{
+				number_of_chunks++;
+			}
+			if( libevtx_chunk_get_number_of_records(
+			     chunk,
+			     &number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve chunk: %" PRIu32 " number of records.",
+				 function,
+				 chunk_index );
+
+				goto on_error;
+			}
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
 				if( libevtx_chunk_get_record(
 				     chunk,
 				     record_index,
@@ -1230,7 +1612,7 @@ int libevtx_file_open_read(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " record: %" PRIu16 ".",
+					 "%s: unable to retrieve chunk: %" PRIu32 " record: %" PRIu16 ".",
 					 function,
 					 chunk_index,
 					 record_index );
@@ -1243,7 +1625,7 @@ int libevtx_file_open_read(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " record: %" PRIu16 ".",
+					 "%s: missing chunk: %" PRIu32 " record: %" PRIu16 ".",
 					 function,
 					 chunk_index,
 					 record_index );
@@ -1259,7 +1641,7 @@ int libevtx_file_open_read(
 					internal_file->io_handle->last_record_identifier = record_values->identifier;
 				}
 #if defined( HAVE_VERBOSE_OUTPUT )
-				if( ( chunk_index == 0 )
+				if( ( chunk_index == first_chunk_index )
 				 && ( record_index == 0 ) )
 				{
 					previous_record_identifier = record_values->identifier;
@@ -1282,25 +1664,20 @@ int libevtx_file_open_read(
 					}
 				}
 #endif
-				/* The chunk index is stored in the element data size
-				 */
 				if( ( chunk_index < internal_file->io_handle->number_of_chunks )
 				 || ( ( internal_file->io_handle->file_flags & LIBEVTX_FILE_FLAG_IS_DIRTY ) != 0 ) )
 				{
-					if( libfdata_list_append_element(
-					     internal_file->records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
+					if( libevtx_records_index_append_entry(
+					     internal_file->records_index,
+					     chunk_index,
+					     (uint16_t) record_values->chunk_data_offset,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to records list.",
+						 "%s: unable to append entry to records index.",
 						 function );
 
 						goto on_error;
@@ -1311,20 +1688,17 @@ int libevtx_file_open_read(
 					/* If the file is not dirty, records found in chunks outside the indicated
 					 * range are considered recovered
 					 */
-					if( libfdata_list_append_element(
-					     internal_file->recovered_records_list,
-					     &element_index,
-					     0,
-					     file_offset + record_values->chunk_data_offset,
-					     (size64_t) chunk_index,
-					     0,
+					if( libevtx_records_index_append_entry(
+					     internal_file->recovered_records_index,
+					     chunk_index,
+					     (uint16_t) record_values->chunk_data_offset,
 					     error ) != 1 )
 					{
 						libcerror_error_set(
 						 error,
 						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 						 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-						 "%s: unable to append element to recovered records list.",
+						 "%s: unable to append entry to recovered records index.",
 						 function );
 
 						goto on_error;
@@ -1341,7 +1715,7 @@ int libevtx_file_open_read(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve chunk: %" PRIu16 " number of recovered records.",
+				 "%s: unable to retrieve chunk: %" PRIu32 " number of recovered records.",
 				 function,
 				 chunk_index );
 
@@ -1361,7 +1735,7 @@ int libevtx_file_open_read(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+					 "%s: unable to retrieve chunk: %" PRIu32 " recovered record: %" PRIu16 ".",
 					 function,
 					 chunk_index,
 					 record_index );
@@ -1374,7 +1748,7 @@ int libevtx_file_open_read(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-					 "%s: missing chunk: %" PRIu16 " recovered record: %" PRIu16 ".",
+					 "%s: missing chunk: %" PRIu32 " recovered record: %" PRIu16 ".",
 					 function,
 					 chunk_index,
 					 record_index );
@@ -1382,22 +1756,17 @@ int libevtx_file_open_read(
 					goto on_error;
 				}
 /* TODO check for and remove duplicate identifiers ? */
-				/* The chunk index is stored in the element data size
-				 */
-				if( libfdata_list_append_element(
-				     internal_file->recovered_records_list,
-				     &element_index,
-				     0,
-				     file_offset + record_values->chunk_data_offset,
-				     (size64_t) chunk_index,
-				     0,
+				if( libevtx_records_index_append_entry(
+				     internal_file->recovered_records_index,
+				     chunk_index,
+				     (uint16_t) record_values->chunk_data_offset,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append element to recovered records list.",
+					 "%s: unable to append entry to recovered records index.",
 					 function );
 
 					goto on_error;
@@ -1414,7 +1783,7 @@ int libevtx_file_open_read(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free chunk: %" PRIu16 ".",
+			 "%s: unable to free chunk: %" PRIu32 ".",
 			 function,
 			 chunk_index );
 
@@ -1431,7 +1800,7 @@ int libevtx_file_open_read(
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu16 " ).\n",
+			 "%s: mismatch in number of chunks ( %" PRIu16 " != %" PRIu32 " ).\n",
 			 function,
 			 internal_file->io_handle->number_of_chunks,
 			 chunk_index );
@@ -1439,139 +1808,1428 @@ int libevtx_file_open_read(
 #endif
 		internal_file->io_handle->flags |= LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( file_offset < (off64_t) file_size )
-		{
-			trailing_data_size = (size_t) ( file_size - file_offset );
+	return( 1 );
 
-			if( trailing_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid trailing data size value exceeds maximum allocation size.",
-				 function );
+on_error:
+	if( chunk != NULL )
+	{
+		libevtx_chunk_free(
+		 &chunk,
+		 NULL );
+	}
+	return( -1 );
+}
 
-				goto on_error;
-			}
-			trailing_data = (uint8_t *) memory_allocate(
-			                             sizeof( uint8_t ) * trailing_data_size );
+/* Refreshes a file that is still being written to
+ * The file header is read again and the chunks are read from the last chunk
+ * that contained data, so that the records appended since the file was opened
+ * or last refreshed are added to the records
+ * Records are assumed to be appended, a file that wrapped around should be
+ * opened again. Records retrieved from the last chunk that contained data
+ * should be freed before the file is refreshed.
+ * A file IO handle provided by the caller is not opened again and should
+ * provide access to the data appended since it was opened
+ * The records are left unchanged if the refresh fails
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_io_handle_t previous_io_handle;
+
+	libevtx_internal_file_t *internal_file                    = NULL;
+	libevtx_records_index_t *previous_records_index           = NULL;
+	libevtx_records_index_t *previous_recovered_records_index = NULL;
+	libevtx_records_index_t *records_index                    = NULL;
+	libevtx_records_index_t *recovered_records_index          = NULL;
+	static char *function                                     = "libevtx_file_refresh";
+	off64_t file_offset                                       = 0;
+	off64_t refresh_offset                                    = 0;
+	uint32_t previous_refresh_chunk_index                     = 0;
+	uint16_t previous_refresh_number_of_chunks                = 0;
+	int previous_refresh_number_of_records                    = 0;
+	int previous_refresh_number_of_recovered_records          = 0;
+	int access_flags                                          = 0;
 
-			if( trailing_data == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create trailing data.",
-				 function );
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* A file IO handle created by the library is opened again since reads
+	 * beyond the size of the file when it was opened are truncated.
+	 * A file IO handle provided by the caller is left as-is.
+	 */
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_get_access_flags(
+		     internal_file->file_io_handle,
+		     &access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve access flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+		if( libbfio_handle_open(
+		     internal_file->file_io_handle,
+		     access_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The size of the file IO handle is retained from when it was first
+	 * opened, hence the size is determined by seeking the end of the file
+	 */
+	file_offset = libbfio_handle_seek_offset(
+	               internal_file->file_io_handle,
+	               0,
+	               SEEK_END,
+	               error );
+
+	if( file_offset == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek end of file.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < ( internal_file->io_handle->chunks_data_offset + (off64_t) internal_file->io_handle->chunks_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds - file was truncated.",
+		 function );
+
+		return( -1 );
+	}
+	/* The chunks are read into copies of the records indexes, that replace
+	 * the current records indexes only if the refresh succeeds
+	 */
+	if( libevtx_records_index_clone(
+	     &records_index,
+	     internal_file->records_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_records_index_truncate(
+	     records_index,
+	     internal_file->refresh_number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to truncate records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_records_index_clone(
+	     &recovered_records_index,
+	     internal_file->recovered_records_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone recovered records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_records_index_truncate(
+	     recovered_records_index,
+	     internal_file->refresh_number_of_recovered_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to truncate recovered records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &previous_io_handle,
+	     internal_file->io_handle,
+	     sizeof( libevtx_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	previous_refresh_chunk_index                 = internal_file->refresh_chunk_index;
+	previous_refresh_number_of_chunks            = internal_file->refresh_number_of_chunks;
+	previous_refresh_number_of_records           = internal_file->refresh_number_of_records;
+	previous_refresh_number_of_recovered_records = internal_file->refresh_number_of_recovered_records;
+
+	previous_records_index                 = internal_file->records_index;
+	previous_recovered_records_index       = internal_file->recovered_records_index;
+	internal_file->records_index           = records_index;
+	internal_file->recovered_records_index = recovered_records_index;
+	records_index                          = NULL;
+	recovered_records_index                = NULL;
+
+	/* The read-ahead and the read buffer can contain data of the last chunk
+	 * from before it was written to, hence the read-ahead is bypassed while
+	 * the chunks are read
+	 */
+	internal_file->io_handle->chunk_read_ahead = NULL;
+
+	if( internal_file->read_buffer != NULL )
+	{
+		if( libevtx_read_buffer_empty(
+		     internal_file->read_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to empty read buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libevtx_io_handle_read_file_header(
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_file_read_chunks(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     (size64_t) file_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdata_vector_set_segment_by_index(
+	     internal_file->chunks_vector,
+	     0,
+	     0,
+	     internal_file->io_handle->chunks_data_offset,
+	     internal_file->io_handle->chunks_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set segment of chunks vector.",
+		 function );
+
+		goto on_error;
+	}
+	/* Cached records and chunks from the refresh chunk onwards are stale
+	 */
+	refresh_offset = previous_io_handle.chunks_data_offset
+	               + ( (off64_t) previous_refresh_chunk_index * previous_io_handle.chunk_size );
+
+	if( libevtx_records_cache_remove_from_offset(
+	     internal_file->records_cache,
+	     refresh_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove refreshed records from records cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevtx_chunks_table_free_decoded_records(
+	     internal_file->chunks_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free decoded records.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfcache_cache_empty(
+	     internal_file->chunks_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty chunks cache.",
+		 function );
+
+		goto on_error;
+	}
+	libevtx_records_index_free(
+	 &previous_records_index,
+	 NULL );
+
+	libevtx_records_index_free(
+	 &previous_recovered_records_index,
+	 NULL );
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_file->chunk_read_ahead != NULL )
+	{
+		if( libevtx_chunk_read_ahead_free(
+		     &( internal_file->chunk_read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( internal_file->read_ahead_depth > 0 )
+	{
+		if( libevtx_chunk_read_ahead_initialize(
+		     &( internal_file->chunk_read_ahead ),
+		     internal_file->file_io_handle,
+		     (size_t) internal_file->io_handle->chunk_size,
+		     internal_file->read_ahead_depth,
+		     internal_file->read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->io_handle->chunk_read_ahead = internal_file->chunk_read_ahead;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	/* Restore the state from before the refresh
+	 */
+	if( previous_records_index != NULL )
+	{
+		previous_io_handle.abort = internal_file->io_handle->abort;
+
+		memory_copy(
+		 internal_file->io_handle,
+		 &previous_io_handle,
+		 sizeof( libevtx_io_handle_t ) );
+
+		internal_file->refresh_chunk_index                 = previous_refresh_chunk_index;
+		internal_file->refresh_number_of_chunks            = previous_refresh_number_of_chunks;
+		internal_file->refresh_number_of_records           = previous_refresh_number_of_records;
+		internal_file->refresh_number_of_recovered_records = previous_refresh_number_of_recovered_records;
+
+		libfdata_vector_set_segment_by_index(
+		 internal_file->chunks_vector,
+		 0,
+		 0,
+		 internal_file->io_handle->chunks_data_offset,
+		 internal_file->io_handle->chunks_data_size,
+		 0,
+		 NULL );
+
+		records_index                          = internal_file->records_index;
+		recovered_records_index                = internal_file->recovered_records_index;
+		internal_file->records_index           = previous_records_index;
+		internal_file->recovered_records_index = previous_recovered_records_index;
+	}
+	if( recovered_records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &recovered_records_index,
+		 NULL );
+	}
+	if( records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &records_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determine if the file corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevtx_file_is_corrupted(
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_is_corrupted";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_ascii_codepage(
+     libevtx_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_ascii_codepage(
+     libevtx_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of cached chunks and records
+ * Each cached chunk uses the chunk size (64 KiB) for its data
+ * If the file is open the chunks cache is emptied and the least recently
+ * cached records are freed when the records cache is shrunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_cache_sizes(
+     libevtx_file_t *file,
+     int maximum_number_of_cached_chunks,
+     int maximum_number_of_cached_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_cache_sizes";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( ( maximum_number_of_cached_chunks <= 0 )
+	 || ( maximum_number_of_cached_chunks > (int) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of cached chunks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_cached_records <= 0 )
+	 || ( maximum_number_of_cached_records > LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of cached records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_file->chunks_cache != NULL )
+	 && ( maximum_number_of_cached_chunks != internal_file->maximum_number_of_cached_chunks ) )
+	{
+		/* The chunks cache is emptied since libfcache_cache_resize does not
+		 * remove the cache values of the entries beyond the new size
+		 * from the entries list
+		 */
+		if( libfcache_cache_empty(
+		     internal_file->chunks_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to empty chunks cache.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfcache_cache_resize(
+		     internal_file->chunks_cache,
+		     maximum_number_of_cached_chunks,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize chunks cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->maximum_number_of_cached_chunks = maximum_number_of_cached_chunks;
+
+	if( internal_file->records_cache != NULL )
+	{
+		if( libevtx_records_cache_resize(
+		     internal_file->records_cache,
+		     maximum_number_of_cached_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize records cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->maximum_number_of_cached_records = maximum_number_of_cached_records;
+
+	return( 1 );
+}
+
+/* Retrieves the statistics of a specific cache
+ * The cache type is LIBEVTX_CACHE_TYPE_CHUNKS or LIBEVTX_CACHE_TYPE_RECORDS
+ * The resident size of the chunks cache is the size of the cached chunk data
+ * and of the records cache the size of the cached record data
+ * The statistics are reset when the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_cache_statistics(
+     libevtx_file_t *file,
+     int cache_type,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_cache_statistics";
+	int number_of_cache_values             = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type != LIBEVTX_CACHE_TYPE_CHUNKS )
+	 && ( cache_type != LIBEVTX_CACHE_TYPE_RECORDS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
 
-				goto on_error;
-			}
-			read_count = libbfio_handle_read_buffer(
-				      file_io_handle,
-				      trailing_data,
-				      trailing_data_size,
-				      error );
+		return( -1 );
+	}
+	if( resident_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resident size.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_hits      = 0;
+	*number_of_misses    = 0;
+	*number_of_evictions = 0;
+	*resident_size       = 0;
+
+	if( cache_type == LIBEVTX_CACHE_TYPE_CHUNKS )
+	{
+		if( ( internal_file->chunks_table == NULL )
+		 || ( internal_file->chunks_cache == NULL ) )
+		{
+			return( 1 );
+		}
+		if( libfcache_cache_get_number_of_cache_values(
+		     internal_file->chunks_cache,
+		     &number_of_cache_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of chunks cache values.",
+			 function );
+
+			return( -1 );
+		}
+		*number_of_hits      = internal_file->chunks_table->number_of_cache_hits;
+		*number_of_misses    = internal_file->chunks_table->number_of_cache_misses;
+		*number_of_evictions = internal_file->chunks_table->number_of_cache_evictions;
+		*resident_size       = (size64_t) number_of_cache_values * internal_file->io_handle->chunk_size;
+	}
+	else if( internal_file->records_cache != NULL )
+	{
+		*number_of_hits      = internal_file->records_cache->number_of_hits;
+		*number_of_misses    = internal_file->records_cache->number_of_misses;
+		*number_of_evictions = internal_file->records_cache->number_of_evictions;
+		*resident_size       = internal_file->records_cache->resident_size;
+	}
+	return( 1 );
+}
+
+/* Sets the read-ahead depth, which is the number of chunks that are read
+ * in the background ahead of the chunk that is being read
+ * A read-ahead depth of 0 disables read-ahead, the maximum is 64
+ * Read-ahead benefits reading the chunks in sequence, such as when
+ * the records are retrieved in order, and requires multi-thread support
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_read_ahead_depth(
+     libevtx_file_t *file,
+     int read_ahead_depth,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_read_ahead_depth";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( read_ahead_depth < 0 )
+	 || ( read_ahead_depth > LIBEVTX_CHUNK_READ_AHEAD_MAXIMUM_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read-ahead depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( read_ahead_depth != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read-ahead depth, multi-thread support is required.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->chunk_read_ahead != NULL )
+	{
+		internal_file->io_handle->chunk_read_ahead = NULL;
+
+		if( libevtx_chunk_read_ahead_free(
+		     &( internal_file->chunk_read_ahead ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free chunk read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( internal_file->file_io_handle != NULL )
+	 && ( read_ahead_depth > 0 ) )
+	{
+		if( libevtx_chunk_read_ahead_initialize(
+		     &( internal_file->chunk_read_ahead ),
+		     internal_file->file_io_handle,
+		     (size_t) internal_file->io_handle->chunk_size,
+		     read_ahead_depth,
+		     internal_file->read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create chunk read-ahead.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->io_handle->chunk_read_ahead = internal_file->chunk_read_ahead;
+	}
+#endif /* !defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+	internal_file->read_ahead_depth = read_ahead_depth;
+
+	return( 1 );
+}
+
+/* Sets the read buffer size
+ * Chunks that are read in sequence are read from the file in blocks of
+ * the read buffer size, which reduces the number of reads for a full scan
+ * The read buffer size is rounded up to a multiple of 4096, the maximum is 64 MiB
+ * A read buffer size of 0 disables the read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_read_buffer_size(
+     libevtx_file_t *file,
+     size_t read_buffer_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_read_buffer_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_buffer_size > (size_t) LIBEVTX_READ_BUFFER_MAXIMUM_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid read buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->read_buffer != NULL )
+	{
+		internal_file->io_handle->read_buffer = NULL;
+
+		if( libevtx_read_buffer_free(
+		     &( internal_file->read_buffer ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_file->read_buffer_size = read_buffer_size;
+
+	if( ( internal_file->file_io_handle != NULL )
+	 && ( read_buffer_size > 0 ) )
+	{
+		if( libevtx_read_buffer_initialize(
+		     &( internal_file->read_buffer ),
+		     read_buffer_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read buffer.",
+			 function );
+
+			return( -1 );
+		}
+		internal_file->io_handle->read_buffer = internal_file->read_buffer;
+	}
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	/* The chunk read-ahead is recreated to use the new read buffer size
+	 */
+	if( internal_file->chunk_read_ahead != NULL )
+	{
+		if( libevtx_file_set_read_ahead_depth(
+		     file,
+		     internal_file->read_ahead_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set read-ahead depth.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the number of decode threads, which is the number of threads that decode
+ * the records of a chunk in parallel with the thread that retrieves the records
+ * A number of decode threads of 0 disables parallel decoding, the maximum is 64
+ * The decoded records are stored in the records cache, so parallel decoding
+ * benefits retrieving the records in order, and requires multi-thread support
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_set_number_of_decode_threads(
+     libevtx_file_t *file,
+     int number_of_decode_threads,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_set_number_of_decode_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( ( number_of_decode_threads < 0 )
+	 || ( number_of_decode_threads > LIBEVTX_RECORD_DECODER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of decode threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( number_of_decode_threads != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of decode threads, multi-thread support is required.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( internal_file->record_decoder != NULL )
+	{
+		if( internal_file->chunks_table != NULL )
+		{
+			internal_file->chunks_table->record_decoder = NULL;
+		}
+		if( libevtx_record_decoder_free(
+		     &( internal_file->record_decoder ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record decoder.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The record decoder does not depend on the file IO handle
+	 * and is kept when the file is closed
+	 */
+	if( number_of_decode_threads > 0 )
+	{
+		if( libevtx_record_decoder_initialize(
+		     &( internal_file->record_decoder ),
+		     number_of_decode_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record decoder.",
+			 function );
+
+			return( -1 );
+		}
+		if( internal_file->chunks_table != NULL )
+		{
+			internal_file->chunks_table->record_decoder = internal_file->record_decoder;
+		}
+	}
+#endif /* !defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
 
-			if( read_count != (ssize_t) trailing_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read trailing data.",
-				 function );
+	return( 1 );
+}
 
-				memory_free(
-				 trailing_data );
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_format_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_format_version";
 
-				goto on_error;
-			}
-			file_offset += read_count;
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
 
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 trailing_data,
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		return( -1 );
+	}
+	internal_file = (libevtx_internal_file_t *) file;
 
-			memory_free(
-			 trailing_data );
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
 
-			trailing_data = NULL;
-		}
+		return( -1 );
 	}
-#endif
+	if( major_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
+	}
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
+	}
+	*major_version = internal_file->io_handle->major_version;
+	*minor_version = internal_file->io_handle->minor_version;
+
 	return( 1 );
+}
 
-on_error:
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( trailing_data != NULL )
+/* Retrieves the file version
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_version(
+     libevtx_file_t *file,
+     uint16_t *major_version,
+     uint16_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_version";
+
+	if( file == NULL )
 	{
-		memory_free(
-		 trailing_data );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	if( chunk != NULL )
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		libevtx_chunk_free(
-		 &chunk,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->records_cache != NULL )
+	if( major_version == NULL )
 	{
-		libfcache_cache_free(
-		 &( internal_file->records_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->recovered_records_list != NULL )
+	if( minor_version == NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->recovered_records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->records_list != NULL )
+	*major_version = internal_file->io_handle->major_version;
+	*minor_version = internal_file->io_handle->minor_version;
+
+	return( 1 );
+}
+
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_flags(
+     libevtx_file_t *file,
+     uint32_t *flags,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_flags";
+
+	if( file == NULL )
 	{
-		libfdata_list_free(
-		 &( internal_file->records_list ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( chunks_table != NULL )
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
 	{
-		libevtx_chunks_table_free(
-		 &chunks_table,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->chunks_cache != NULL )
+	if( flags == NULL )
 	{
-		libfcache_cache_free(
-		 &( internal_file->chunks_cache ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
+		 function );
+
+		return( -1 );
 	}
-	if( internal_file->chunks_vector != NULL )
+	*flags = internal_file->io_handle->file_flags;
+
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_number_of_records(
+     libevtx_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevtx_internal_file_t *internal_file = NULL;
+	static char *function                  = "libevtx_file_get_number_of_records";
+
+	if( file == NULL )
 	{
-		libfdata_vector_free(
-		 &( internal_file->chunks_vector ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+	internal_file = (libevtx_internal_file_t *) file;
+
+	if( libevtx_records_index_get_number_of_entries(
+	     internal_file->records_index,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Determine if the file corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
  */
-int libevtx_file_is_corrupted(
+int libevtx_file_get_record(
      libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_is_corrupted";
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_get_record";
+	uint16_t chunk_data_offset              = 0;
+	uint32_t chunk_index                    = 0;
 
 	if( file == NULL )
 	{
@@ -1586,85 +3244,87 @@ int libevtx_file_is_corrupted(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( internal_file->io_handle->flags & LIBEVTX_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
-	{
-		return( 1 );
-	}
-	return( 0 );
-}
-
-/* Retrieves the file ASCII codepage
- * Returns 1 if successful or -1 on error
- */
-int libevtx_file_get_ascii_codepage(
-     libevtx_file_t *file,
-     int *ascii_codepage,
-     libcerror_error_t **error )
-{
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_ascii_codepage";
-
-	if( file == NULL )
+	if( libevtx_records_index_get_entry_by_index(
+	     internal_file->records_index,
+	     record_index,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records index entry: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( libevtx_chunks_table_get_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     chunk_index,
+	     chunk_data_offset,
+	     &record_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( libevtx_record_initialize(
+	     record,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
 		 function );
 
 		return( -1 );
 	}
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
-
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
+/* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_set_ascii_codepage(
+int libevtx_file_get_record_by_index(
      libevtx_file_t *file,
-     int ascii_codepage,
+     int record_index,
+     libevtx_record_t **record,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_set_ascii_codepage";
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_get_record_by_index";
+	uint16_t chunk_data_offset              = 0;
+	uint32_t chunk_index                    = 0;
 
 	if( file == NULL )
 	{
@@ -1679,58 +3339,94 @@ int libevtx_file_set_ascii_codepage(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBEVTX_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEVTX_CODEPAGE_WINDOWS_1258 ) )
+	if( libevtx_records_index_get_entry_by_index(
+	     internal_file->records_index,
+	     record_index,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records index entry: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
+	if( libevtx_chunks_table_get_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     chunk_index,
+	     chunk_data_offset,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_record_initialize(
+	     record,
+	     internal_file->io_handle,
+	     internal_file->file_io_handle,
+	     record_values,
+	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
-/* Retrieves the format version
+/* Retrieves a specific record into an existing record
+ * If the value record is referencing is NULL a new record is created,
+ * otherwise the record is reused and its record values are cleared and refilled
+ * instead of being freed and allocated. The XML document of the record values
+ * and its values are still created for every record, since libfwevt does not
+ * support reading into an existing XML document. The records cache is bypassed, unless
+ * decode threads are set, then the record references the records cache as
+ * the records are decoded in parallel into the records cache
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_format_version(
+int libevtx_file_get_record_by_index_into(
      libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
+     int record_index,
+     libevtx_record_t **record,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_format_version";
+	libevtx_record_values_t *record_values = NULL;
+	static char *function                  = "libevtx_file_get_record_by_index_into";
+	uint16_t chunk_data_offset             = 0;
+	uint32_t chunk_index                   = 0;
 
 	if( file == NULL )
 	{
@@ -1745,58 +3441,201 @@ int libevtx_file_get_format_version(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( major_version == NULL )
+	if( libevtx_records_index_get_entry_by_index(
+	     internal_file->records_index,
+	     record_index,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records index entry: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	if( minor_version == NULL )
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+	if( internal_file->record_decoder != NULL )
+	{
+		if( libevtx_chunks_table_get_record_values(
+		     internal_file->chunks_table,
+		     internal_file->file_io_handle,
+		     internal_file->records_cache,
+		     chunk_index,
+		     chunk_data_offset,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( *record == NULL )
+		{
+			if( libevtx_record_initialize(
+			     record,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     record_values,
+			     LIBEVTX_RECORD_FLAGS_DEFAULT,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libevtx_record_set_record_values(
+			     *record,
+			     internal_file->io_handle,
+			     internal_file->file_io_handle,
+			     record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set record values in record.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		return( 1 );
+	}
+#endif
+	if( *record == NULL )
+	{
+		if( libevtx_record_values_initialize(
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_record_initialize(
+		     record,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     record_values,
+		     LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevtx_record_reset(
+		     *record,
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset record.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The record values are managed by the record from here on
+	 */
+	if( libevtx_chunks_table_read_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     chunk_index,
+	     chunk_data_offset,
+	     record_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	*major_version = internal_file->io_handle->major_version;
-	*minor_version = internal_file->io_handle->minor_version;
-
 	return( 1 );
+
+on_error:
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file version
+/* Retrieves the header values of a specific entry in a records index
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_version(
-     libevtx_file_t *file,
-     uint16_t *major_version,
-     uint16_t *minor_version,
+int libevtx_file_get_record_header_values_from_records_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_records_index_t *records_index,
+     int record_index,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_version";
+	static char *function       = "libevtx_file_get_record_header_values_from_records_index";
+	uint16_t chunk_data_offset  = 0;
+	uint32_t safe_chunk_index   = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1807,8 +3646,6 @@ int libevtx_file_get_version(
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
 	if( internal_file->io_handle == NULL )
 	{
 		libcerror_error_set(
@@ -1820,95 +3657,90 @@ int libevtx_file_get_version(
 
 		return( -1 );
 	}
-	if( major_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
-		 function );
-
-		return( -1 );
-	}
-	if( minor_version == NULL )
+	if( chunk_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 "%s: invalid chunk index.",
 		 function );
 
 		return( -1 );
 	}
-	*major_version = internal_file->io_handle->major_version;
-	*minor_version = internal_file->io_handle->minor_version;
-
-	return( 1 );
-}
-
-/* Retrieves the flags
- * Returns 1 if successful or -1 on error
- */
-int libevtx_file_get_flags(
-     libevtx_file_t *file,
-     uint32_t *flags,
-     libcerror_error_t **error )
-{
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_flags";
-
-	if( file == NULL )
+	if( offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid offset.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( libevtx_records_index_get_entry_by_index(
+	     records_index,
+	     record_index,
+	     &safe_chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records index entry: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	if( flags == NULL )
+	if( libevtx_chunks_table_get_record_header_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     safe_chunk_index,
+	     chunk_data_offset,
+	     identifier,
+	     written_time,
+	     size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid flags.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header values of record: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
-	*flags = internal_file->io_handle->file_flags;
+	*chunk_index = (int) safe_chunk_index;
+	*offset      = internal_file->io_handle->chunks_data_offset
+	             + ( (off64_t) safe_chunk_index * internal_file->io_handle->chunk_size )
+	             + chunk_data_offset;
 
 	return( 1 );
 }
 
-/* Retrieves the number of records
+/* Retrieves the 64-bit FILETIME value containing the written time of a specific record
+ * Only the record header is read, which makes this function suitable to order records
+ * without reading their XML document
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_number_of_records(
+int libevtx_file_get_record_written_time_by_index(
      libevtx_file_t *file,
-     int *number_of_records,
+     int record_index,
+     uint64_t *filetime,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	static char *function                  = "libevtx_file_get_number_of_records";
+	static char *function = "libevtx_file_get_record_written_time_by_index";
+	off64_t offset        = 0;
+	uint64_t identifier   = 0;
+	uint32_t size         = 0;
+	int chunk_index       = 0;
 
 	if( file == NULL )
 	{
@@ -1921,37 +3753,47 @@ int libevtx_file_get_number_of_records(
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
-	     number_of_records,
+	if( libevtx_file_get_record_header_values_from_records_index(
+	     (libevtx_internal_file_t *) file,
+	     ( (libevtx_internal_file_t *) file )->records_index,
+	     record_index,
+	     &identifier,
+	     filetime,
+	     &chunk_index,
+	     &offset,
+	     &size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
-		 function );
+		 "%s: unable to retrieve written time of record: %d.",
+		 function,
+		 record_index );
 
 		return( -1 );
 	}
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves the header values of a specific record
+ * The values are read from the record header, without reading the XML document
+ * of the record, which makes this function suitable to scan large numbers of records
+ * The offset is the file offset of the record, the size is the size of the record data
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_record(
+int libevtx_file_get_record_header_values_by_index(
      libevtx_file_t *file,
      int record_index,
-     libevtx_record_t **record,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
      libcerror_error_t **error )
 {
-	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_record";
+	static char *function = "libevtx_file_get_record_header_values_by_index";
 
 	if( file == NULL )
 	{
@@ -1964,70 +3806,59 @@ int libevtx_file_get_record(
 
 		return( -1 );
 	}
-	internal_file = (libevtx_internal_file_t *) file;
-
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevtx_file_get_record_header_values_from_records_index(
+	     (libevtx_internal_file_t *) file,
+	     ( (libevtx_internal_file_t *) file )->records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     identifier,
+	     written_time,
+	     chunk_index,
+	     offset,
+	     size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 "%s: unable to retrieve header values of record: %d.",
 		 function,
 		 record_index );
 
 		return( -1 );
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
-		 function );
-
-		return( -1 );
-	}
 	return( 1 );
 }
 
-/* Retrieves a specific record
+/* Retrieves the records with an identifier greater than a specific identifier
+ * The records of a circular log are stored in order of their identifier, except
+ * that the oldest records can follow the newest records. The records are found
+ * with a binary search over the record headers, which reads only the chunks
+ * that contain the records that are searched.
+ * The records start at the first record index and continue at record index 0
+ * after the last record, if the log wrapped around.
  * Returns 1 if successful or -1 on error
  */
-int libevtx_file_get_record_by_index(
+int libevtx_file_get_records_after_identifier(
      libevtx_file_t *file,
-     int record_index,
-     libevtx_record_t **record,
+     uint64_t identifier,
+     int *first_record_index,
+     int *number_of_records,
      libcerror_error_t **error )
 {
 	libevtx_internal_file_t *internal_file = NULL;
-	libevtx_record_values_t *record_values = NULL;
-	static char *function                  = "libevtx_file_get_record_by_index";
+	static char *function                  = "libevtx_file_get_records_after_identifier";
+	off64_t offset                         = 0;
+	uint64_t last_identifier               = 0;
+	uint64_t record_identifier             = 0;
+	uint64_t written_time                  = 0;
+	uint32_t size                          = 0;
+	int chunk_index                        = 0;
+	int lower_index                        = 0;
+	int middle_index                       = 0;
+	int oldest_record_index                = 0;
+	int safe_number_of_records             = 0;
+	int upper_index                        = 0;
 
 	if( file == NULL )
 	{
@@ -2042,53 +3873,155 @@ int libevtx_file_get_record_by_index(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( record == NULL )
+	if( first_record_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 "%s: invalid first record index.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	if( number_of_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_records_index_get_number_of_entries(
+	     internal_file->records_index,
+	     &safe_number_of_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
-		 function,
-		 record_index );
+		 "%s: unable to retrieve number of entries of records index.",
+		 function );
 
 		return( -1 );
 	}
-	if( libevtx_record_initialize(
-	     record,
-	     internal_file->io_handle,
-	     internal_file->file_io_handle,
-	     record_values,
-	     LIBEVTX_RECORD_FLAGS_DEFAULT,
+	*first_record_index = 0;
+	*number_of_records  = 0;
+
+	if( safe_number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Determine the oldest record, which is the first record
+	 * unless the log wrapped around
+	 */
+	if( libevtx_file_get_record_header_values_from_records_index(
+	     internal_file,
+	     internal_file->records_index,
+	     safe_number_of_records - 1,
+	     &last_identifier,
+	     &written_time,
+	     &chunk_index,
+	     &offset,
+	     &size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header values of record: %d.",
+		 function,
+		 safe_number_of_records - 1 );
 
 		return( -1 );
 	}
+	lower_index = 0;
+	upper_index = safe_number_of_records - 1;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libevtx_file_get_record_header_values_from_records_index(
+		     internal_file,
+		     internal_file->records_index,
+		     middle_index,
+		     &record_identifier,
+		     &written_time,
+		     &chunk_index,
+		     &offset,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header values of record: %d.",
+			 function,
+			 middle_index );
+
+			return( -1 );
+		}
+		if( record_identifier > last_identifier )
+		{
+			lower_index = middle_index + 1;
+		}
+		else
+		{
+			upper_index = middle_index;
+		}
+	}
+	oldest_record_index = lower_index;
+
+	/* Determine the number of records, in identifier order, that precede
+	 * the first record with an identifier greater than the identifier
+	 */
+	lower_index = 0;
+	upper_index = safe_number_of_records;
+
+	while( lower_index < upper_index )
+	{
+		middle_index = lower_index + ( ( upper_index - lower_index ) / 2 );
+
+		if( libevtx_file_get_record_header_values_from_records_index(
+		     internal_file,
+		     internal_file->records_index,
+		     ( oldest_record_index + middle_index ) % safe_number_of_records,
+		     &record_identifier,
+		     &written_time,
+		     &chunk_index,
+		     &offset,
+		     &size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve header values of record: %d.",
+			 function,
+			 ( oldest_record_index + middle_index ) % safe_number_of_records );
+
+			return( -1 );
+		}
+		if( record_identifier > identifier )
+		{
+			upper_index = middle_index;
+		}
+		else
+		{
+			lower_index = middle_index + 1;
+		}
+	}
+	*first_record_index = ( oldest_record_index + lower_index ) % safe_number_of_records;
+	*number_of_records  = safe_number_of_records - lower_index;
+
 	return( 1 );
 }
 
@@ -2116,8 +4049,8 @@ int libevtx_file_get_number_of_recovered_records(
 	}
 	internal_file = (libevtx_internal_file_t *) file;
 
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
+	if( libevtx_records_index_get_number_of_entries(
+	     internal_file->recovered_records_index,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -2145,6 +4078,8 @@ int libevtx_file_get_recovered_record(
 	libevtx_internal_file_t *internal_file = NULL;
 	libevtx_record_values_t *record_values = NULL;
 	static char *function                  = "libevtx_file_get_recovered_record";
+	uint16_t chunk_data_offset              = 0;
+	uint32_t chunk_index                    = 0;
 
 	if( file == NULL )
 	{
@@ -2170,13 +4105,30 @@ int libevtx_file_get_recovered_record(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevtx_records_index_get_entry_by_index(
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered records index entry: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_chunks_table_get_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     chunk_index,
+	     chunk_data_offset,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2221,6 +4173,8 @@ int libevtx_file_get_recovered_record_by_index(
 	libevtx_internal_file_t *internal_file = NULL;
 	libevtx_record_values_t *record_values = NULL;
 	static char *function                  = "libevtx_file_get_recovered_record_by_index";
+	uint16_t chunk_data_offset              = 0;
+	uint32_t chunk_index                    = 0;
 
 	if( file == NULL )
 	{
@@ -2246,13 +4200,30 @@ int libevtx_file_get_recovered_record_by_index(
 
 		return( -1 );
 	}
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevtx_records_index_get_entry_by_index(
+	     internal_file->recovered_records_index,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &chunk_index,
+	     &chunk_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve recovered records index entry: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevtx_chunks_table_get_record_values(
+	     internal_file->chunks_table,
+	     internal_file->file_io_handle,
+	     internal_file->records_cache,
+	     chunk_index,
+	     chunk_data_offset,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2285,3 +4256,55 @@ int libevtx_file_get_recovered_record_by_index(
 	return( 1 );
 }
 
+/* Retrieves the header values of a specific recovered record
+ * The values are read from the record header, without reading the XML document
+ * of the record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_file_get_recovered_record_header_values_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_file_get_recovered_record_header_values_by_index";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_record_header_values_from_records_index(
+	     (libevtx_internal_file_t *) file,
+	     ( (libevtx_internal_file_t *) file )->recovered_records_index,
+	     record_index,
+	     identifier,
+	     written_time,
+	     chunk_index,
+	     offset,
+	     size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve header values of recovered record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
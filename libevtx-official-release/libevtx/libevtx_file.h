@@ -25,12 +25,19 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_chunk_read_ahead.h"
+#include "libevtx_chunks_table.h"
 #include "libevtx_extern.h"
 #include "libevtx_io_handle.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfcache.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_read_buffer.h"
+#include "libevtx_record_decoder.h"
+#include "libevtx_records_cache.h"
+#include "libevtx_records_index.h"
+#include "libevtx_string_table.h"
 
 #if defined( _MSC_VER ) || defined( __BORLANDC__ ) || defined( __MINGW32_VERSION ) || defined( __MINGW64_VERSION_MAJOR )
 
@@ -72,17 +79,70 @@ struct libevtx_internal_file
 	 */
 	libfcache_cache_t *chunks_cache;
 
-	/* The records list
+	/* The chunks table
 	 */
-	libfdata_list_t *records_list;
+	libevtx_chunks_table_t *chunks_table;
 
-	/* The recovered records list
+	/* The records index
 	 */
-	libfdata_list_t *recovered_records_list;
+	libevtx_records_index_t *records_index;
+
+	/* The recovered records index
+	 */
+	libevtx_records_index_t *recovered_records_index;
 
 	/* The records cache
 	 */
-	libfcache_cache_t *records_cache;
+	libevtx_records_cache_t *records_cache;
+
+	/* The maximum number of cached chunks
+	 */
+	int maximum_number_of_cached_chunks;
+
+	/* The maximum number of cached records
+	 */
+	int maximum_number_of_cached_records;
+
+	/* The chunk read-ahead
+	 */
+	libevtx_chunk_read_ahead_t *chunk_read_ahead;
+
+	/* The read-ahead depth
+	 */
+	int read_ahead_depth;
+
+	/* The record decoder
+	 */
+	libevtx_record_decoder_t *record_decoder;
+
+	/* The read buffer
+	 */
+	libevtx_read_buffer_t *read_buffer;
+
+	/* The read buffer size
+	 */
+	size_t read_buffer_size;
+
+	/* The string table
+	 */
+	libevtx_string_table_t *string_table;
+
+	/* The index of the last chunk that contained data, from which the chunks
+	 * are read again on refresh
+	 */
+	uint32_t refresh_chunk_index;
+
+	/* The number of chunks that precede the refresh chunk
+	 */
+	uint16_t refresh_number_of_chunks;
+
+	/* The number of records index entries that precede the refresh chunk
+	 */
+	int refresh_number_of_records;
+
+	/* The number of recovered records index entries that precede the refresh chunk
+	 */
+	int refresh_number_of_recovered_records;
 };
 
 LIBEVTX_EXTERN \
@@ -135,6 +195,17 @@ int libevtx_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libevtx_file_read_chunks(
+     libevtx_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_refresh(
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_is_corrupted(
      libevtx_file_t *file,
@@ -152,6 +223,41 @@ int libevtx_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_set_cache_sizes(
+     libevtx_file_t *file,
+     int maximum_number_of_cached_chunks,
+     int maximum_number_of_cached_records,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_cache_statistics(
+     libevtx_file_t *file,
+     int cache_type,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_read_ahead_depth(
+     libevtx_file_t *file,
+     int read_ahead_depth,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_read_buffer_size(
+     libevtx_file_t *file,
+     size_t read_buffer_size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_set_number_of_decode_threads(
+     libevtx_file_t *file,
+     int number_of_decode_threads,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_get_format_version(
      libevtx_file_t *file,
@@ -192,6 +298,50 @@ int libevtx_file_get_record_by_index(
      libevtx_record_t **record,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_by_index_into(
+     libevtx_file_t *file,
+     int record_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+int libevtx_file_get_record_header_values_from_records_index(
+     libevtx_internal_file_t *internal_file,
+     libevtx_records_index_t *records_index,
+     int record_index,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_written_time_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *filetime,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_record_header_values_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_file_get_records_after_identifier(
+     libevtx_file_t *file,
+     uint64_t identifier,
+     int *first_record_index,
+     int *number_of_records,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_file_get_number_of_recovered_records(
      libevtx_file_t *file,
@@ -212,6 +362,17 @@ int libevtx_file_get_recovered_record_by_index(
      libevtx_record_t **record,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_file_get_recovered_record_header_values_by_index(
+     libevtx_file_t *file,
+     int record_index,
+     uint64_t *identifier,
+     uint64_t *written_time,
+     int *chunk_index,
+     off64_t *offset,
+     uint32_t *size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,477 @@
+/*
+ * Interned string functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_interned_string.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+#include "libevtx_utf8_string.h"
+
+/* Creates an interned string
+ * Make sure the value interned_string is referencing, is set to NULL
+ * The data is copied so that the interned string does not reference chunk data
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_interned_string_initialize(
+     libevtx_interned_string_t **interned_string,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_interned_string_initialize";
+
+	if( interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *interned_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid interned string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*interned_string = memory_allocate_structure(
+	                    libevtx_interned_string_t );
+
+	if( *interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create interned string.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *interned_string,
+	     0,
+	     sizeof( libevtx_interned_string_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear interned string.",
+		 function );
+
+		memory_free(
+		 *interned_string );
+
+		*interned_string = NULL;
+
+		return( -1 );
+	}
+	( *interned_string )->data = (uint8_t *) memory_allocate(
+	                                          sizeof( uint8_t ) * data_size );
+
+	if( ( *interned_string )->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( *interned_string )->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	( *interned_string )->data_size = data_size;
+
+	return( 1 );
+
+on_error:
+	if( *interned_string != NULL )
+	{
+		if( ( *interned_string )->data != NULL )
+		{
+			memory_free(
+			 ( *interned_string )->data );
+		}
+		memory_free(
+		 *interned_string );
+
+		*interned_string = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an interned string
+ * The next interned string is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_interned_string_free(
+     libevtx_interned_string_t **interned_string,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_interned_string_free";
+
+	if( interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *interned_string != NULL )
+	{
+		if( ( *interned_string )->utf16_string != NULL )
+		{
+			memory_free(
+			 ( *interned_string )->utf16_string );
+		}
+		if( ( *interned_string )->utf8_string != NULL )
+		{
+			memory_free(
+			 ( *interned_string )->utf8_string );
+		}
+		memory_free(
+		 ( *interned_string )->data );
+
+		memory_free(
+		 *interned_string );
+
+		*interned_string = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 string of the interned string
+ * The UTF-8 string is formatted from the value on first use, where the value
+ * must contain the same data as the interned string
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_interned_string_get_utf8_string(
+     libevtx_interned_string_t *interned_string,
+     libfvalue_value_t *value,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_utf8_string    = NULL;
+	static char *function        = "libevtx_interned_string_get_utf8_string";
+	size_t safe_utf8_string_size = 0;
+	int result                   = 0;
+
+	if( interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( interned_string->utf8_string == NULL )
+	{
+		result = libevtx_utf8_string_size_from_value(
+		          value,
+		          &safe_utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( safe_utf8_string_size == 0 ) )
+		{
+			return( 0 );
+		}
+		if( safe_utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-8 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_utf8_string = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * safe_utf8_string_size );
+
+		if( safe_utf8_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevtx_utf8_string_copy_from_value(
+		     safe_utf8_string,
+		     safe_utf8_string_size,
+		     value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		interned_string->utf8_string      = safe_utf8_string;
+		interned_string->utf8_string_size = safe_utf8_string_size;
+	}
+	*utf8_string      = interned_string->utf8_string;
+	*utf8_string_size = interned_string->utf8_string_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_utf8_string != NULL )
+	{
+		memory_free(
+		 safe_utf8_string );
+	}
+	return( -1 );
+}
+
+/* Retrieves the UTF-16 string of the interned string
+ * The UTF-16 string is formatted from the value on first use, where the value
+ * must contain the same data as the interned string
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_interned_string_get_utf16_string(
+     libevtx_interned_string_t *interned_string,
+     libfvalue_value_t *value,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint16_t *safe_utf16_string   = NULL;
+	static char *function         = "libevtx_interned_string_get_utf16_string";
+	size_t safe_utf16_string_size = 0;
+	int result                    = 0;
+
+	if( interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( interned_string->utf16_string == NULL )
+	{
+		result = libfvalue_value_get_utf16_string_size(
+		          value,
+		          0,
+		          &safe_utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string size of value.",
+			 function );
+
+			goto on_error;
+		}
+		else if( ( result == 0 )
+		      || ( safe_utf16_string_size == 0 ) )
+		{
+			return( 0 );
+		}
+		if( safe_utf16_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid UTF-16 string size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		safe_utf16_string = (uint16_t *) memory_allocate(
+		                                  sizeof( uint16_t ) * safe_utf16_string_size );
+
+		if( safe_utf16_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfvalue_value_copy_to_utf16_string(
+		     value,
+		     0,
+		     safe_utf16_string,
+		     safe_utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-16 string.",
+			 function );
+
+			goto on_error;
+		}
+		interned_string->utf16_string      = safe_utf16_string;
+		interned_string->utf16_string_size = safe_utf16_string_size;
+	}
+	*utf16_string      = interned_string->utf16_string;
+	*utf16_string_size = interned_string->utf16_string_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_utf16_string != NULL )
+	{
+		memory_free(
+		 safe_utf16_string );
+	}
+	return( -1 );
+}
+
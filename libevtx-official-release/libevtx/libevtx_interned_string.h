@@ -0,0 +1,113 @@
+/*
+ * Interned string functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNED_STRING_H )
+#define _LIBEVTX_INTERNED_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevtx_interned_string libevtx_interned_string_t;
+
+struct libevtx_interned_string
+{
+	/* The next interned string with the same hash bucket
+	 */
+	libevtx_interned_string_t *next_interned_string;
+
+	/* The hash of the value
+	 */
+	uint32_t hash;
+
+	/* The value type
+	 */
+	int value_type;
+
+	/* The value format flags
+	 */
+	uint32_t format_flags;
+
+	/* The value data encoding
+	 */
+	int encoding;
+
+	/* The value data
+	 */
+	uint8_t *data;
+
+	/* The value data size
+	 */
+	size_t data_size;
+
+	/* The UTF-8 string, which is formatted on first use
+	 */
+	uint8_t *utf8_string;
+
+	/* The UTF-8 string size
+	 */
+	size_t utf8_string_size;
+
+	/* The UTF-16 string, which is formatted on first use
+	 */
+	uint16_t *utf16_string;
+
+	/* The UTF-16 string size
+	 */
+	size_t utf16_string_size;
+};
+
+int libevtx_interned_string_initialize(
+     libevtx_interned_string_t **interned_string,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libevtx_interned_string_free(
+     libevtx_interned_string_t **interned_string,
+     libcerror_error_t **error );
+
+int libevtx_interned_string_get_utf8_string(
+     libevtx_interned_string_t *interned_string,
+     libfvalue_value_t *value,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_interned_string_get_utf16_string(
+     libevtx_interned_string_t *interned_string,
+     libfvalue_value_t *value,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNED_STRING_H ) */
+
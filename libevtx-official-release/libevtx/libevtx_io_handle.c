@@ -570,6 +570,8 @@ int libevtx_io_handle_read_chunk(
 
 		goto on_error;
 	}
+	io_handle->number_of_chunks_read += 1;
+
 	return( 1 );
 
 on_error:
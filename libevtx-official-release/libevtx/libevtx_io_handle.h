@@ -25,9 +25,12 @@
 #include <common.h>
 #include <types.h>
 
+#include "libevtx_chunk_read_ahead.h"
 #include "libevtx_libbfio.h"
 #include "libevtx_libcerror.h"
 #include "libevtx_libfdata.h"
+#include "libevtx_read_buffer.h"
+#include "libevtx_string_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -83,6 +86,22 @@ struct libevtx_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The number of chunks read on demand into the chunks cache
+	 */
+	uint64_t number_of_chunks_read;
+
+	/* The chunk read-ahead, which is managed by the file
+	 */
+	libevtx_chunk_read_ahead_t *chunk_read_ahead;
+
+	/* The read buffer, which is managed by the file
+	 */
+	libevtx_read_buffer_t *read_buffer;
+
+	/* The string table, which is managed by the file
+	 */
+	libevtx_string_table_t *string_table;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
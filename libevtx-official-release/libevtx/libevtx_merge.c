@@ -0,0 +1,762 @@
+/*
+ * Time-ordered merge functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_file.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_merge.h"
+#include "libevtx_record.h"
+
+/* Creates a merge
+ * Make sure the value merge is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_initialize(
+     libevtx_merge_t **merge,
+     libcerror_error_t **error )
+{
+	libevtx_internal_merge_t *internal_merge = NULL;
+	static char *function                    = "libevtx_merge_initialize";
+
+	if( merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid merge value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge = memory_allocate_structure(
+	                  libevtx_internal_merge_t );
+
+	if( internal_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create merge.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_merge,
+	     0,
+	     sizeof( libevtx_internal_merge_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear merge.",
+		 function );
+
+		goto on_error;
+	}
+	*merge = (libevtx_merge_t *) internal_merge;
+
+	return( 1 );
+
+on_error:
+	if( internal_merge != NULL )
+	{
+		memory_free(
+		 internal_merge );
+	}
+	return( -1 );
+}
+
+/* Frees a merge
+ * The files that were appended are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_free(
+     libevtx_merge_t **merge,
+     libcerror_error_t **error )
+{
+	libevtx_internal_merge_t *internal_merge = NULL;
+	static char *function                    = "libevtx_merge_free";
+
+	if( merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( *merge != NULL )
+	{
+		internal_merge = (libevtx_internal_merge_t *) *merge;
+		*merge         = NULL;
+
+		if( internal_merge->files != NULL )
+		{
+			memory_free(
+			 internal_merge->files );
+		}
+		if( internal_merge->record_indexes != NULL )
+		{
+			memory_free(
+			 internal_merge->record_indexes );
+		}
+		if( internal_merge->written_times != NULL )
+		{
+			memory_free(
+			 internal_merge->written_times );
+		}
+		if( internal_merge->heap != NULL )
+		{
+			memory_free(
+			 internal_merge->heap );
+		}
+		memory_free(
+		 internal_merge );
+	}
+	return( 1 );
+}
+
+/* Resizes the merge to hold at least the number of files
+ * The merge is never shrunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_resize(
+     libevtx_internal_merge_t *internal_merge,
+     int number_of_files,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_merge_resize";
+	void *reallocation    = NULL;
+
+	if( internal_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of files value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_files <= internal_merge->number_of_allocated_files )
+	{
+		return( 1 );
+	}
+	if( ( sizeof( uint64_t ) * (size_t) number_of_files ) > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of files value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                internal_merge->files,
+	                sizeof( libevtx_file_t * ) * (size_t) number_of_files );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize files.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge->files = (libevtx_file_t **) reallocation;
+
+	reallocation = memory_reallocate(
+	                internal_merge->record_indexes,
+	                sizeof( int ) * (size_t) number_of_files );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize record indexes.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge->record_indexes = (int *) reallocation;
+
+	reallocation = memory_reallocate(
+	                internal_merge->written_times,
+	                sizeof( uint64_t ) * (size_t) number_of_files );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize written times.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge->written_times = (uint64_t *) reallocation;
+
+	reallocation = memory_reallocate(
+	                internal_merge->heap,
+	                sizeof( int ) * (size_t) number_of_files );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize heap.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge->heap                      = (int *) reallocation;
+	internal_merge->number_of_allocated_files = number_of_files;
+
+	return( 1 );
+}
+
+/* Moves a heap entry up until its parent is ordered before it
+ * A file is ordered before another file if the written time of its next record is earlier
+ * or, if the written times are equal, if it was appended before the other file
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_heap_sift_up(
+     libevtx_internal_merge_t *internal_merge,
+     int heap_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_merge_heap_sift_up";
+	uint64_t written_time = 0;
+	int file_index        = 0;
+	int parent_file_index = 0;
+	int parent_heap_index = 0;
+
+	if( internal_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( heap_index < 0 )
+	 || ( heap_index >= internal_merge->heap_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid heap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_index   = internal_merge->heap[ heap_index ];
+	written_time = internal_merge->written_times[ file_index ];
+
+	while( heap_index > 0 )
+	{
+		parent_heap_index = ( heap_index - 1 ) / 2;
+		parent_file_index = internal_merge->heap[ parent_heap_index ];
+
+		if( ( internal_merge->written_times[ parent_file_index ] < written_time )
+		 || ( ( internal_merge->written_times[ parent_file_index ] == written_time )
+		  &&  ( parent_file_index < file_index ) ) )
+		{
+			break;
+		}
+		internal_merge->heap[ heap_index ] = parent_file_index;
+
+		heap_index = parent_heap_index;
+	}
+	internal_merge->heap[ heap_index ] = file_index;
+
+	return( 1 );
+}
+
+/* Moves a heap entry down until its children are ordered after it
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_heap_sift_down(
+     libevtx_internal_merge_t *internal_merge,
+     int heap_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_merge_heap_sift_down";
+	uint64_t written_time = 0;
+	int child_file_index  = 0;
+	int child_heap_index  = 0;
+	int file_index        = 0;
+	int right_file_index  = 0;
+
+	if( internal_merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( heap_index < 0 )
+	 || ( heap_index >= internal_merge->heap_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid heap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_index   = internal_merge->heap[ heap_index ];
+	written_time = internal_merge->written_times[ file_index ];
+
+	while( heap_index < ( internal_merge->heap_size / 2 ) )
+	{
+		child_heap_index = ( 2 * heap_index ) + 1;
+		child_file_index = internal_merge->heap[ child_heap_index ];
+
+		if( ( child_heap_index + 1 ) < internal_merge->heap_size )
+		{
+			right_file_index = internal_merge->heap[ child_heap_index + 1 ];
+
+			if( ( internal_merge->written_times[ right_file_index ] < internal_merge->written_times[ child_file_index ] )
+			 || ( ( internal_merge->written_times[ right_file_index ] == internal_merge->written_times[ child_file_index ] )
+			  &&  ( right_file_index < child_file_index ) ) )
+			{
+				child_heap_index += 1;
+				child_file_index  = right_file_index;
+			}
+		}
+		if( ( written_time < internal_merge->written_times[ child_file_index ] )
+		 || ( ( written_time == internal_merge->written_times[ child_file_index ] )
+		  &&  ( file_index < child_file_index ) ) )
+		{
+			break;
+		}
+		internal_merge->heap[ heap_index ] = child_file_index;
+
+		heap_index = child_heap_index;
+	}
+	internal_merge->heap[ heap_index ] = file_index;
+
+	return( 1 );
+}
+
+/* Appends a file to the merge
+ * The file must be opened and remain open while the merge is used
+ * The records of the file are assumed to be stored in written time order
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_append_file(
+     libevtx_merge_t *merge,
+     libevtx_file_t *file,
+     libcerror_error_t **error )
+{
+	libevtx_internal_merge_t *internal_merge = NULL;
+	static char *function                    = "libevtx_merge_append_file";
+	int file_index                           = 0;
+	int number_of_files                      = 0;
+	int number_of_records                    = 0;
+
+	if( merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge = (libevtx_internal_merge_t *) merge;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_merge->number_of_files == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid merge - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevtx_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_merge->number_of_files >= internal_merge->number_of_allocated_files )
+	{
+		if( internal_merge->number_of_allocated_files == 0 )
+		{
+			number_of_files = LIBEVTX_MERGE_INITIAL_NUMBER_OF_FILES;
+		}
+		else if( internal_merge->number_of_allocated_files > ( INT_MAX / 2 ) )
+		{
+			number_of_files = INT_MAX;
+		}
+		else
+		{
+			number_of_files = internal_merge->number_of_allocated_files * 2;
+		}
+		if( libevtx_merge_resize(
+		     internal_merge,
+		     number_of_files,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize merge.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_index = internal_merge->number_of_files;
+
+	internal_merge->files[ file_index ]          = file;
+	internal_merge->record_indexes[ file_index ] = 0;
+	internal_merge->written_times[ file_index ]  = 0;
+
+	if( number_of_records > 0 )
+	{
+		if( libevtx_file_get_record_written_time_by_index(
+		     file,
+		     0,
+		     &( internal_merge->written_times[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve written time of record: 0.",
+			 function );
+
+			return( -1 );
+		}
+		internal_merge->heap[ internal_merge->heap_size ] = file_index;
+
+		internal_merge->heap_size += 1;
+
+		if( libevtx_merge_heap_sift_up(
+		     internal_merge,
+		     internal_merge->heap_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert file in heap.",
+			 function );
+
+			internal_merge->heap_size -= 1;
+
+			return( -1 );
+		}
+	}
+	internal_merge->number_of_files += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_merge_get_number_of_files(
+     libevtx_merge_t *merge,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libevtx_internal_merge_t *internal_merge = NULL;
+	static char *function                    = "libevtx_merge_get_number_of_files";
+
+	if( merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge = (libevtx_internal_merge_t *) merge;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = internal_merge->number_of_files;
+
+	return( 1 );
+}
+
+/* Retrieves the next record in written time order
+ * Only the written time of the next record of each file is kept in memory,
+ * the record itself is only read when it is retrieved
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevtx_merge_get_next_record(
+     libevtx_merge_t *merge,
+     int *file_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error )
+{
+	libevtx_internal_merge_t *internal_merge = NULL;
+	static char *function                    = "libevtx_merge_get_next_record";
+	int number_of_records                    = 0;
+	int record_index                         = 0;
+	int safe_file_index                      = 0;
+
+	if( merge == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid merge.",
+		 function );
+
+		return( -1 );
+	}
+	internal_merge = (libevtx_internal_merge_t *) merge;
+
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_merge->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	safe_file_index = internal_merge->heap[ 0 ];
+	record_index    = internal_merge->record_indexes[ safe_file_index ];
+
+	if( libevtx_file_get_record_by_index(
+	     internal_merge->files[ safe_file_index ],
+	     record_index,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d from file: %d.",
+		 function,
+		 record_index,
+		 safe_file_index );
+
+		goto on_error;
+	}
+	if( libevtx_file_get_number_of_records(
+	     internal_merge->files[ safe_file_index ],
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records of file: %d.",
+		 function,
+		 safe_file_index );
+
+		goto on_error;
+	}
+	record_index += 1;
+
+	if( record_index < number_of_records )
+	{
+		if( libevtx_file_get_record_written_time_by_index(
+		     internal_merge->files[ safe_file_index ],
+		     record_index,
+		     &( internal_merge->written_times[ safe_file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve written time of record: %d from file: %d.",
+			 function,
+			 record_index,
+			 safe_file_index );
+
+			goto on_error;
+		}
+		internal_merge->record_indexes[ safe_file_index ] = record_index;
+	}
+	else
+	{
+		/* The file has no records left and is replaced by the last heap entry
+		 */
+		internal_merge->heap_size -= 1;
+
+		internal_merge->heap[ 0 ] = internal_merge->heap[ internal_merge->heap_size ];
+
+		internal_merge->record_indexes[ safe_file_index ] = number_of_records;
+	}
+	if( internal_merge->heap_size > 0 )
+	{
+		if( libevtx_merge_heap_sift_down(
+		     internal_merge,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reorder heap.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	*file_index = safe_file_index;
+
+	return( 1 );
+
+on_error:
+	if( *record != NULL )
+	{
+		libevtx_record_free(
+		 record,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Time-ordered merge functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_INTERNAL_MERGE_H )
+#define _LIBEVTX_INTERNAL_MERGE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_extern.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of files allocated by the merge
+ */
+#define LIBEVTX_MERGE_INITIAL_NUMBER_OF_FILES			16
+
+typedef struct libevtx_internal_merge libevtx_internal_merge_t;
+
+struct libevtx_internal_merge
+{
+	/* The files, which are not managed by the merge
+	 */
+	libevtx_file_t **files;
+
+	/* The index of the next record of each file
+	 */
+	int *record_indexes;
+
+	/* The written time of the next record of each file
+	 */
+	uint64_t *written_times;
+
+	/* The heap, which contains the indexes of the files that have records left
+	 * ordered by the written time of their next record
+	 */
+	int *heap;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of allocated files
+	 */
+	int number_of_allocated_files;
+
+	/* The number of files in the heap
+	 */
+	int heap_size;
+};
+
+LIBEVTX_EXTERN \
+int libevtx_merge_initialize(
+     libevtx_merge_t **merge,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_merge_free(
+     libevtx_merge_t **merge,
+     libcerror_error_t **error );
+
+int libevtx_merge_resize(
+     libevtx_internal_merge_t *internal_merge,
+     int number_of_files,
+     libcerror_error_t **error );
+
+int libevtx_merge_heap_sift_up(
+     libevtx_internal_merge_t *internal_merge,
+     int heap_index,
+     libcerror_error_t **error );
+
+int libevtx_merge_heap_sift_down(
+     libevtx_internal_merge_t *internal_merge,
+     int heap_index,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_merge_append_file(
+     libevtx_merge_t *merge,
+     libevtx_file_t *file,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_merge_get_number_of_files(
+     libevtx_merge_t *merge,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBEVTX_EXTERN \
+int libevtx_merge_get_next_record(
+     libevtx_merge_t *merge,
+     int *file_index,
+     libevtx_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_INTERNAL_MERGE_H ) */
+
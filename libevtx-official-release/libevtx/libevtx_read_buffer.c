@@ -0,0 +1,376 @@
+/*
+ * Read buffer functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_read_buffer.h"
+
+/* Creates a read buffer
+ * Make sure the value read_buffer is referencing, is set to NULL
+ * The size is rounded up to a multiple of the alignment
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_initialize(
+     libevtx_read_buffer_t **read_buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_initialize";
+	size_t alignment_size = 0;
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_buffer != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid read buffer value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) LIBEVTX_READ_BUFFER_MAXIMUM_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	alignment_size = size % LIBEVTX_READ_BUFFER_ALIGNMENT;
+
+	if( alignment_size != 0 )
+	{
+		size += LIBEVTX_READ_BUFFER_ALIGNMENT - alignment_size;
+	}
+	*read_buffer = memory_allocate_structure(
+	                libevtx_read_buffer_t );
+
+	if( *read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create read buffer.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *read_buffer,
+	     0,
+	     sizeof( libevtx_read_buffer_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear read buffer.",
+		 function );
+
+		memory_free(
+		 *read_buffer );
+
+		*read_buffer = NULL;
+
+		return( -1 );
+	}
+	/* The data is allocated with additional space so that it can be aligned
+	 */
+	( *read_buffer )->allocated_data = (uint8_t *) memory_allocate(
+	                                                size + LIBEVTX_READ_BUFFER_ALIGNMENT );
+
+	if( ( *read_buffer )->allocated_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	alignment_size = (size_t) ( (intptr_t) ( *read_buffer )->allocated_data % LIBEVTX_READ_BUFFER_ALIGNMENT );
+
+	if( alignment_size != 0 )
+	{
+		alignment_size = LIBEVTX_READ_BUFFER_ALIGNMENT - alignment_size;
+	}
+	( *read_buffer )->data        = &( ( ( *read_buffer )->allocated_data )[ alignment_size ] );
+	( *read_buffer )->size        = size;
+	( *read_buffer )->next_offset = -1;
+
+	return( 1 );
+
+on_error:
+	if( *read_buffer != NULL )
+	{
+		memory_free(
+		 *read_buffer );
+
+		*read_buffer = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a read buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_free(
+     libevtx_read_buffer_t **read_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_free";
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *read_buffer != NULL )
+	{
+		memory_free(
+		 ( *read_buffer )->allocated_data );
+
+		memory_free(
+		 *read_buffer );
+
+		*read_buffer = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a read buffer
+ * The buffered data is discarded so that it is read again, which is needed
+ * when the file data has changed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_read_buffer_empty(
+     libevtx_read_buffer_t *read_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_empty";
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	read_buffer->buffered_offset = 0;
+	read_buffer->buffered_size   = 0;
+	read_buffer->next_offset     = -1;
+
+	return( 1 );
+}
+
+/* Reads data at a specific offset using the read buffer
+ * A read that continues where the previous read ended fills the read buffer
+ * with a single large read at an aligned offset, so that the reads that follow
+ * are served from the read buffer. Other reads are passed to the file IO handle
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libevtx_read_buffer_read_at_offset(
+         libevtx_read_buffer_t *read_buffer,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error )
+{
+	static char *function = "libevtx_read_buffer_read_at_offset";
+	size_t buffer_offset  = 0;
+	ssize_t read_count    = 0;
+	off64_t read_offset   = 0;
+
+	if( read_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_offset < read_buffer->buffered_offset )
+	 || ( (size64_t) ( file_offset - read_buffer->buffered_offset ) + data_size > (size64_t) read_buffer->buffered_size ) )
+	{
+		read_offset   = file_offset - ( file_offset % LIBEVTX_READ_BUFFER_ALIGNMENT );
+		buffer_offset = (size_t) ( file_offset - read_offset );
+
+		if( ( ( read_buffer->next_offset != -1 )
+		  &&  ( file_offset != read_buffer->next_offset ) )
+		 || ( ( buffer_offset + data_size ) > read_buffer->size ) )
+		{
+			read_buffer->next_offset      = -1;
+			read_buffer->number_of_reads += 1;
+
+			read_count = libbfio_handle_read_buffer_at_offset(
+			              file_io_handle,
+			              data,
+			              data_size,
+			              file_offset,
+			              error );
+
+			if( read_count < 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+			read_buffer->next_offset = file_offset + read_count;
+
+			return( read_count );
+		}
+		read_buffer->buffered_size    = 0;
+		read_buffer->number_of_reads += 1;
+
+		read_count = libbfio_handle_read_buffer_at_offset(
+		              file_io_handle,
+		              read_buffer->data,
+		              read_buffer->size,
+		              read_offset,
+		              error );
+
+		if( read_count < 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 read_offset,
+			 read_offset );
+
+			read_buffer->next_offset = -1;
+
+			return( -1 );
+		}
+		read_buffer->buffered_offset = read_offset;
+		read_buffer->buffered_size   = (size_t) read_count;
+	}
+	buffer_offset = (size_t) ( file_offset - read_buffer->buffered_offset );
+
+	if( buffer_offset >= read_buffer->buffered_size )
+	{
+		data_size = 0;
+	}
+	else if( data_size > ( read_buffer->buffered_size - buffer_offset ) )
+	{
+		data_size = read_buffer->buffered_size - buffer_offset;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     data,
+		     &( ( read_buffer->data )[ buffer_offset ] ),
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	read_buffer->next_offset = file_offset + data_size;
+
+	return( (ssize_t) data_size );
+}
+
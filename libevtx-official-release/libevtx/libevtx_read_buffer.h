@@ -0,0 +1,102 @@
+/*
+ * Read buffer functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_READ_BUFFER_H )
+#define _LIBEVTX_READ_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libbfio.h"
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The alignment of the read buffer data, the read offsets and the read sizes
+ */
+#define LIBEVTX_READ_BUFFER_ALIGNMENT			4096
+
+/* The maximum size of the read buffer
+ */
+#define LIBEVTX_READ_BUFFER_MAXIMUM_SIZE		( 64 * 1024 * 1024 )
+
+typedef struct libevtx_read_buffer libevtx_read_buffer_t;
+
+struct libevtx_read_buffer
+{
+	/* The allocated data, which contains the aligned data
+	 */
+	uint8_t *allocated_data;
+
+	/* The aligned data
+	 */
+	uint8_t *data;
+
+	/* The size of the data
+	 */
+	size_t size;
+
+	/* The file offset of the buffered data
+	 */
+	off64_t buffered_offset;
+
+	/* The size of the buffered data
+	 */
+	size_t buffered_size;
+
+	/* The file offset that follows the previous read
+	 */
+	off64_t next_offset;
+
+	/* The number of reads from the file IO handle
+	 */
+	uint64_t number_of_reads;
+};
+
+int libevtx_read_buffer_initialize(
+     libevtx_read_buffer_t **read_buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libevtx_read_buffer_free(
+     libevtx_read_buffer_t **read_buffer,
+     libcerror_error_t **error );
+
+int libevtx_read_buffer_empty(
+     libevtx_read_buffer_t *read_buffer,
+     libcerror_error_t **error );
+
+ssize_t libevtx_read_buffer_read_at_offset(
+         libevtx_read_buffer_t *read_buffer,
+         libbfio_handle_t *file_io_handle,
+         off64_t file_offset,
+         uint8_t *data,
+         size_t data_size,
+         libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_READ_BUFFER_H ) */
+
@@ -78,7 +78,7 @@ int libevtx_record_initialize(
 
 		return( -1 );
 	}
-	if( ( flags & ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) ) != 0 )
+	if( ( flags & ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE | LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
@@ -208,8 +208,28 @@ int libevtx_record_free(
 		internal_record = (libevtx_internal_record_t *) *record;
 		*record         = NULL;
 
-		/* The io_handle and record_values references are freed elsewhere
+		/* The io_handle reference is freed elsewhere and the record_values
+		 * reference only if the record values are not managed by the record
 		 */
+		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES ) != 0 )
+		{
+			if( libevtx_record_values_free(
+			     &( internal_record->record_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				memory_free(
+				 internal_record );
+
+				return( -1 );
+			}
+		}
 		if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
 		{
 			if( internal_record->file_io_handle != NULL )
@@ -248,6 +268,206 @@ int libevtx_record_free(
 	return( 1 );
 }
 
+/* Resets a record so that it can be reused for another record
+ * The record values are kept when they are managed by the record otherwise
+ * record values are created that are managed by the record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_reset(
+     libevtx_record_t *record,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_reset";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
+	{
+		if( internal_record->file_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     internal_record->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+			if( libbfio_handle_free(
+			     &( internal_record->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_record->flags &= ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE );
+	}
+	if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES ) == 0 )
+	{
+		/* The record values are managed elsewhere, such as by the records cache
+		 */
+		internal_record->record_values = NULL;
+
+		if( libevtx_record_values_initialize(
+		     &( internal_record->record_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record values.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record->flags |= LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES;
+	}
+	internal_record->io_handle      = io_handle;
+	internal_record->file_io_handle = file_io_handle;
+
+	*record_values = internal_record->record_values;
+
+	return( 1 );
+}
+
+/* Sets the record values of a record that is reused for another record
+ * The record values are managed elsewhere, such as by the records cache,
+ * record values that are managed by the record are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_set_record_values(
+     libevtx_record_t *record,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_set_record_values";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE ) != 0 )
+	{
+		if( internal_record->file_io_handle != NULL )
+		{
+			if( libbfio_handle_close(
+			     internal_record->file_io_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+			if( libbfio_handle_free(
+			     &( internal_record->file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file IO handle.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_record->flags &= ~( LIBEVTX_RECORD_FLAG_MANAGED_FILE_IO_HANDLE );
+	}
+	if( ( internal_record->flags & LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES ) != 0 )
+	{
+		if( internal_record->record_values != NULL )
+		{
+			if( libevtx_record_values_free(
+			     &( internal_record->record_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		internal_record->flags &= ~( LIBEVTX_RECORD_FLAG_MANAGED_RECORD_VALUES );
+	}
+	internal_record->io_handle      = io_handle;
+	internal_record->file_io_handle = file_io_handle;
+	internal_record->record_values  = record_values;
+
+	return( 1 );
+}
+
 /* Retrieves the offset
  * Returns 1 if successful or -1 on error
  */
@@ -694,6 +914,56 @@ int libevtx_record_get_utf8_provider_identifier(
 	return( result );
 }
 
+/* Retrieves the UTF-8 encoded provider identifier and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_provider_identifier_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_provider_identifier_with_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf8_provider_identifier_with_size(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded provider identifier
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -878,6 +1148,56 @@ int libevtx_record_get_utf8_source_name(
 	return( result );
 }
 
+/* Retrieves the UTF-8 encoded source name and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_source_name_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_source_name_with_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf8_source_name_with_size(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded source name
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1062,6 +1382,56 @@ int libevtx_record_get_utf8_computer_name(
 	return( result );
 }
 
+/* Retrieves the UTF-8 encoded computer name and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_computer_name_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_computer_name_with_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf8_computer_name_with_size(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded computer name
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1246,6 +1616,56 @@ int libevtx_record_get_utf8_user_security_identifier(
 	return( result );
 }
 
+/* Retrieves the UTF-8 encoded user security identifier and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_get_utf8_user_security_identifier_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_user_security_identifier_with_size";
+	int result                                 = 0;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	result = libevtx_record_values_get_utf8_user_security_identifier_with_size(
+	          internal_record->record_values,
+	          utf8_string,
+	          utf8_string_size,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the size of the UTF-16 encoded user security identifier
  * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
@@ -1532,6 +1952,57 @@ int libevtx_record_get_utf8_string(
 	return( 1 );
 }
 
+/* Retrieves a specific UTF-8 encoded string and its size
+ * The required size includes the end of string character or is 0 if the string has no value
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_get_utf8_string_with_size(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_internal_record_t *internal_record = NULL;
+	static char *function                      = "libevtx_record_get_utf8_string_with_size";
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record = (libevtx_internal_record_t *) record;
+
+	if( libevtx_record_values_get_utf8_string_with_size(
+	     internal_record->record_values,
+	     internal_record->io_handle,
+	     string_index,
+	     utf8_string,
+	     utf8_string_size,
+	     required_utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to retrieve UTF-8 string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the size of a specific UTF-16 encoded string
  * The returned size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -70,6 +70,20 @@ int libevtx_record_free(
      libevtx_record_t **record,
      libcerror_error_t **error );
 
+int libevtx_record_reset(
+     libevtx_record_t *record,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_set_record_values(
+     libevtx_record_t *record,
+     libevtx_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_offset(
      libevtx_record_t *record,
@@ -131,6 +145,14 @@ int libevtx_record_get_utf8_provider_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_provider_identifier_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_provider_identifier_size(
      libevtx_record_t *record,
@@ -157,6 +179,14 @@ int libevtx_record_get_utf8_source_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_source_name_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_source_name_size(
      libevtx_record_t *record,
@@ -183,6 +213,14 @@ int libevtx_record_get_utf8_computer_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_computer_name_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_computer_name_size(
      libevtx_record_t *record,
@@ -209,6 +247,14 @@ int libevtx_record_get_utf8_user_security_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_user_security_identifier_with_size(
+     libevtx_record_t *record,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_user_security_identifier_size(
      libevtx_record_t *record,
@@ -249,6 +295,15 @@ int libevtx_record_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBEVTX_EXTERN \
+int libevtx_record_get_utf8_string_with_size(
+     libevtx_record_t *record,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 LIBEVTX_EXTERN \
 int libevtx_record_get_utf16_string_size(
      libevtx_record_t *record,
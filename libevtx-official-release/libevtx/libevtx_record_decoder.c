@@ -0,0 +1,728 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcnotify.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_record_decoder.h"
+#include "libevtx_record_values.h"
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Creates a record decoder
+ * Make sure the value record_decoder is referencing, is set to NULL
+ * The worker threads are started and wait for records to decode
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_initialize(
+     libevtx_record_decoder_t **record_decoder,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_initialize";
+	int thread_index      = 0;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_decoder != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record decoder value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > LIBEVTX_RECORD_DECODER_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*record_decoder = memory_allocate_structure(
+	                   libevtx_record_decoder_t );
+
+	if( *record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record decoder.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_decoder,
+	     0,
+	     sizeof( libevtx_record_decoder_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record decoder.",
+		 function );
+
+		memory_free(
+		 *record_decoder );
+
+		*record_decoder = NULL;
+
+		return( -1 );
+	}
+	( *record_decoder )->worker_threads = (libcthreads_thread_t **) memory_allocate(
+	                                                                 sizeof( libcthreads_thread_t * ) * number_of_threads );
+
+	if( ( *record_decoder )->worker_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *record_decoder )->worker_threads,
+	     0,
+	     sizeof( libcthreads_thread_t * ) * number_of_threads ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker threads.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_decoder )->number_of_threads = number_of_threads;
+
+	if( libcthreads_mutex_initialize(
+	     &( ( *record_decoder )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *record_decoder )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create condition.",
+		 function );
+
+		goto on_error;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( ( *record_decoder )->worker_threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &libevtx_record_decoder_worker_thread_function,
+		     (void *) *record_decoder,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 record_decoder,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a record decoder
+ * This stops the worker threads before the record decoder is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_free(
+     libevtx_record_decoder_t **record_decoder,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_free";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_decoder != NULL )
+	{
+		if( ( *record_decoder )->worker_threads != NULL )
+		{
+			if( ( ( *record_decoder )->mutex != NULL )
+			 && ( ( *record_decoder )->condition != NULL ) )
+			{
+				if( libcthreads_mutex_grab(
+				     ( *record_decoder )->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to grab mutex.",
+					 function );
+
+					return( -1 );
+				}
+				( *record_decoder )->stop_worker_threads = 1;
+
+				if( libcthreads_condition_broadcast(
+				     ( *record_decoder )->condition,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to broadcast condition.",
+					 function );
+
+					result = -1;
+				}
+				if( libcthreads_mutex_release(
+				     ( *record_decoder )->mutex,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release mutex.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			for( thread_index = 0;
+			     thread_index < ( *record_decoder )->number_of_threads;
+			     thread_index++ )
+			{
+				if( ( *record_decoder )->worker_threads[ thread_index ] == NULL )
+				{
+					continue;
+				}
+				if( libcthreads_thread_join(
+				     &( ( *record_decoder )->worker_threads[ thread_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to join worker thread: %d.",
+					 function,
+					 thread_index );
+
+					return( -1 );
+				}
+			}
+			memory_free(
+			 ( *record_decoder )->worker_threads );
+		}
+		if( ( *record_decoder )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *record_decoder )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *record_decoder )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *record_decoder )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *record_decoder );
+
+		*record_decoder = NULL;
+	}
+	return( result );
+}
+
+/* Decodes the records that are handed to the record decoder
+ * This function runs in the worker threads until the worker threads are signalled to stop
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_worker_thread_function(
+     libevtx_record_decoder_t *record_decoder )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "libevtx_record_decoder_worker_thread_function";
+	int result               = 0;
+
+	if( record_decoder == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+	while( record_decoder->stop_worker_threads == 0 )
+	{
+		result = libevtx_record_decoder_decode_next_record(
+		          record_decoder,
+		          &error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode next record.",
+			 function );
+
+			break;
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( libcthreads_condition_wait(
+		     record_decoder->condition,
+		     record_decoder->mutex,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			break;
+		}
+	}
+	if( error != NULL )
+	{
+		/* Wake the thread that is waiting for the records to be decoded
+		 * so that it checks the number of decoded records again
+		 */
+		libcthreads_condition_broadcast(
+		 record_decoder->condition,
+		 NULL );
+	}
+	libcthreads_mutex_release(
+	 record_decoder->mutex,
+	 NULL );
+
+	if( error != NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
+/* Decodes the next record that is handed to the record decoder
+ * The mutex must be held by the caller, it is released while the record is decoded
+ * and held again on return, a claimed record is counted as decoded on error
+ * A record that cannot be decoded is left without XML document, so that the record
+ * can be read by the caller instead, which reports the error
+ * Returns 1 if a record was decoded, 0 if no record is available or -1 on error
+ */
+int libevtx_record_decoder_decode_next_record(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error )
+{
+	libcerror_error_t *decode_error = NULL;
+	static char *function           = "libevtx_record_decoder_decode_next_record";
+	int record_index                = 0;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_decoder->next_record_index >= record_decoder->number_of_records )
+	{
+		return( 0 );
+	}
+	record_index = record_decoder->next_record_index;
+
+	record_decoder->next_record_index += 1;
+
+	/* The record values of a claimed record are only accessed by the thread
+	 * that claimed it and the chunk data is not modified, so the mutex is
+	 * not held while decoding
+	 */
+	if( libcthreads_mutex_release(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		/* The claimed record is left without XML document
+		 */
+		record_decoder->number_of_decoded_records += 1;
+
+		return( -1 );
+	}
+	if( libevtx_record_values_read_xml_document(
+	     record_decoder->records_values[ record_index ],
+	     record_decoder->io_handle,
+	     record_decoder->chunk_data,
+	     record_decoder->chunk_data_size,
+	     &decode_error ) != 1 )
+	{
+		libcerror_error_free(
+		 &decode_error );
+	}
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	record_decoder->number_of_decoded_records += 1;
+
+	if( record_decoder->number_of_decoded_records == record_decoder->number_of_records )
+	{
+		if( libcthreads_condition_broadcast(
+		     record_decoder->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decodes the XML documents of the records of a chunk
+ * The records are decoded by the worker threads and the calling thread, where
+ * each thread claims the next record that has not been decoded yet
+ * This function returns when all the records have been decoded
+ * A record that cannot be decoded is left without XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_decoder_decode_records(
+     libevtx_record_decoder_t *record_decoder,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libevtx_record_values_t **records_values,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_decoder_decode_records";
+	int result            = 1;
+
+	if( record_decoder == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record decoder.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	if( libcthreads_mutex_grab(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	record_decoder->io_handle                 = io_handle;
+	record_decoder->chunk_data                = chunk_data;
+	record_decoder->chunk_data_size           = chunk_data_size;
+	record_decoder->records_values            = records_values;
+	record_decoder->number_of_records         = number_of_records;
+	record_decoder->next_record_index         = 0;
+	record_decoder->number_of_decoded_records = 0;
+
+	if( libcthreads_condition_broadcast(
+	     record_decoder->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	/* The calling thread decodes records as well instead of waiting idle
+	 */
+	while( result == 1 )
+	{
+		result = libevtx_record_decoder_decode_next_record(
+		          record_decoder,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to decode next record.",
+			 function );
+
+			break;
+		}
+	}
+	if( result == -1 )
+	{
+		/* Prevent the worker threads from claiming more records
+		 */
+		record_decoder->number_of_records = record_decoder->next_record_index;
+	}
+	else
+	{
+		result = 1;
+	}
+	/* The records that were claimed by the worker threads must be decoded
+	 * before the records are no longer referenced, also on error
+	 */
+	while( record_decoder->number_of_decoded_records < record_decoder->number_of_records )
+	{
+		if( libcthreads_condition_wait(
+		     record_decoder->condition,
+		     record_decoder->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	/* The records are not referenced after they were decoded
+	 */
+	record_decoder->io_handle         = NULL;
+	record_decoder->chunk_data        = NULL;
+	record_decoder->chunk_data_size   = 0;
+	record_decoder->records_values    = NULL;
+	record_decoder->number_of_records = 0;
+
+	if( libcthreads_mutex_release(
+	     record_decoder->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,128 @@
+/*
+ * Record decoder functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_RECORD_DECODER_H )
+#define _LIBEVTX_RECORD_DECODER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_io_handle.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libcthreads.h"
+#include "libevtx_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of decode threads
+ */
+#define LIBEVTX_RECORD_DECODER_MAXIMUM_NUMBER_OF_THREADS	64
+
+typedef struct libevtx_record_decoder libevtx_record_decoder_t;
+
+#if defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+struct libevtx_record_decoder
+{
+	/* The number of worker threads
+	 */
+	int number_of_threads;
+
+	/* The IO handle of the records that are being decoded
+	 */
+	libevtx_io_handle_t *io_handle;
+
+	/* The chunk data of the records that are being decoded
+	 */
+	const uint8_t *chunk_data;
+
+	/* The chunk data size
+	 */
+	size_t chunk_data_size;
+
+	/* The record values of the records that are being decoded
+	 */
+	libevtx_record_values_t **records_values;
+
+	/* The number of records that are being decoded
+	 */
+	int number_of_records;
+
+	/* The index of the next record to decode
+	 */
+	int next_record_index;
+
+	/* The number of records that were decoded
+	 */
+	int number_of_decoded_records;
+
+	/* Value to indicate the worker threads should stop
+	 */
+	uint8_t stop_worker_threads;
+
+	/* The mutex that protects the records that are being decoded
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that signals a change in the records that are being decoded
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The worker threads
+	 */
+	libcthreads_thread_t **worker_threads;
+};
+
+int libevtx_record_decoder_initialize(
+     libevtx_record_decoder_t **record_decoder,
+     int number_of_threads,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_free(
+     libevtx_record_decoder_t **record_decoder,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_worker_thread_function(
+     libevtx_record_decoder_t *record_decoder );
+
+int libevtx_record_decoder_decode_next_record(
+     libevtx_record_decoder_t *record_decoder,
+     libcerror_error_t **error );
+
+int libevtx_record_decoder_decode_records(
+     libevtx_record_decoder_t *record_decoder,
+     libevtx_io_handle_t *io_handle,
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     libevtx_record_values_t **records_values,
+     int number_of_records,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORD_DECODER_H ) */
+
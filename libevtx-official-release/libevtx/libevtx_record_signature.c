@@ -0,0 +1,246 @@
+/*
+ * Event record signature functions
+ *
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+
+#define LIBEVTX_RECORD_SIGNATURE_HAVE_SSE2
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON ) && !defined( __AARCH64EB__ )
+#include <arm_neon.h>
+
+#define LIBEVTX_RECORD_SIGNATURE_HAVE_NEON
+
+#endif
+
+#include "libevtx_libcerror.h"
+#include "libevtx_record_signature.h"
+#include "libevtx_record_values.h"
+
+#include "evtx_event_record.h"
+
+/* Scans the chunk data for the next event record signature
+ * Only the offsets that are a multiple of 4 bytes from the chunk data offset are
+ * scanned, where blocks of 8 offsets are handled by a single SIMD comparison
+ * if available
+ * Returns 1 if a signature was found, 0 if not or -1 on error
+ */
+int libevtx_record_signature_scan(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t chunk_data_offset,
+     size_t *signature_offset,
+     libcerror_error_t **error )
+{
+	static char *function     = "libevtx_record_signature_scan";
+
+#if defined( LIBEVTX_RECORD_SIGNATURE_HAVE_SSE2 )
+	__m128i chunk_values1     = _mm_setzero_si128();
+	__m128i chunk_values2     = _mm_setzero_si128();
+	__m128i signature_values  = _mm_set1_epi32( 0x00002a2a );
+
+#elif defined( LIBEVTX_RECORD_SIGNATURE_HAVE_NEON )
+	uint32x4_t chunk_values1;
+	uint32x4_t chunk_values2;
+	uint32x4_t signature_values;
+#endif
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size <= 4 )
+	{
+		return( 0 );
+	}
+#if defined( LIBEVTX_RECORD_SIGNATURE_HAVE_SSE2 ) || defined( LIBEVTX_RECORD_SIGNATURE_HAVE_NEON )
+#if defined( LIBEVTX_RECORD_SIGNATURE_HAVE_NEON )
+	signature_values = vdupq_n_u32( 0x00002a2aUL );
+#endif
+	/* Skip blocks of 32 bytes that contain no signature at any of the 8 offsets
+	 * The signature is compared as a 32-bit little-endian value
+	 */
+	while( ( chunk_data_offset < chunk_data_size )
+	    && ( ( chunk_data_size - chunk_data_offset ) > 32 ) )
+	{
+#if defined( LIBEVTX_RECORD_SIGNATURE_HAVE_SSE2 )
+		chunk_values1 = _mm_loadu_si128(
+		                 (__m128i *) &( chunk_data[ chunk_data_offset ] ) );
+		chunk_values2 = _mm_loadu_si128(
+		                 (__m128i *) &( chunk_data[ chunk_data_offset + 16 ] ) );
+
+		chunk_values1 = _mm_or_si128(
+		                 _mm_cmpeq_epi32(
+		                  chunk_values1,
+		                  signature_values ),
+		                 _mm_cmpeq_epi32(
+		                  chunk_values2,
+		                  signature_values ) );
+
+		if( _mm_movemask_epi8(
+		     chunk_values1 ) != 0 )
+		{
+			break;
+		}
+#elif defined( LIBEVTX_RECORD_SIGNATURE_HAVE_NEON )
+		chunk_values1 = vreinterpretq_u32_u8(
+		                 vld1q_u8(
+		                  &( chunk_data[ chunk_data_offset ] ) ) );
+		chunk_values2 = vreinterpretq_u32_u8(
+		                 vld1q_u8(
+		                  &( chunk_data[ chunk_data_offset + 16 ] ) ) );
+
+		chunk_values1 = vorrq_u32(
+		                 vceqq_u32(
+		                  chunk_values1,
+		                  signature_values ),
+		                 vceqq_u32(
+		                  chunk_values2,
+		                  signature_values ) );
+
+		if( vmaxvq_u32(
+		     chunk_values1 ) != 0 )
+		{
+			break;
+		}
+#endif
+		chunk_data_offset += 32;
+	}
+#endif /* defined( LIBEVTX_RECORD_SIGNATURE_HAVE_SSE2 ) || defined( LIBEVTX_RECORD_SIGNATURE_HAVE_NEON ) */
+
+	while( chunk_data_offset < ( chunk_data_size - 4 ) )
+	{
+		if( ( chunk_data[ chunk_data_offset ] == evtx_event_record_signature[ 0 ] )
+		 && ( chunk_data[ chunk_data_offset + 1 ] == evtx_event_record_signature[ 1 ] )
+		 && ( chunk_data[ chunk_data_offset + 2 ] == evtx_event_record_signature[ 2 ] )
+		 && ( chunk_data[ chunk_data_offset + 3 ] == evtx_event_record_signature[ 3 ] ) )
+		{
+			*signature_offset = chunk_data_offset;
+
+			return( 1 );
+		}
+		chunk_data_offset += 4;
+	}
+	return( 0 );
+}
+
+/* Checks if the event record header at the chunk data offset is plausible
+ * This applies the same size and size copy checks as libevtx_record_values_read_header
+ * without setting an error, so that false positive signatures can be skipped cheaply
+ * Returns 1 if plausible, 0 if not or -1 on error
+ */
+int libevtx_record_signature_check_header(
+     const uint8_t *chunk_data,
+     size_t chunk_data_size,
+     size_t chunk_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function         = "libevtx_record_signature_check_header";
+	size_t event_record_data_size = 0;
+	uint32_t data_size            = 0;
+	uint32_t size_copy            = 0;
+
+	if( chunk_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid chunk data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset >= chunk_data_size )
+	{
+		return( 0 );
+	}
+	event_record_data_size = chunk_data_size - chunk_data_offset;
+
+	if( event_record_data_size < ( sizeof( evtx_event_record_header_t ) + 4 ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evtx_event_record_header_t *) &( chunk_data[ chunk_data_offset ] ) )->size,
+	 data_size );
+
+	if( ( data_size < sizeof( evtx_event_record_header_t ) )
+	 || ( data_size > ( event_record_data_size - 4 ) ) )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( chunk_data[ chunk_data_offset + data_size - 4 ] ),
+	 size_copy );
+
+	if( data_size != size_copy )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
@@ -33,7 +33,9 @@
 #include "libevtx_libfvalue.h"
 #include "libevtx_libfwevt.h"
 #include "libevtx_record_values.h"
+#include "libevtx_string_table.h"
 #include "libevtx_template_definition.h"
+#include "libevtx_utf8_string.h"
 
 #include "evtx_event_record.h"
 
@@ -285,6 +287,146 @@ on_error:
 	return( -1 );
 }
 
+/* Clears the record values
+ * The XML document is freed and the strings arrays are emptied but kept,
+ * so that the record values can be reused for another record
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_clear(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *string_identifiers_array = NULL;
+	libcdata_array_t *strings_array            = NULL;
+	static char *function                      = "libevtx_record_values_clear";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document != NULL )
+	{
+		if( libfwevt_xml_document_free(
+		     &( record_values->xml_document ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free XML document.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->string_identifiers_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     record_values->string_identifiers_array,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty string identifiers array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( record_values->strings_array != NULL )
+	{
+		if( libcdata_array_empty(
+		     record_values->strings_array,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty strings array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	string_identifiers_array = record_values->string_identifiers_array;
+	strings_array            = record_values->strings_array;
+
+	/* The references into the XML document are cleared as well
+	 */
+	if( memory_set(
+	     record_values,
+	     0,
+	     sizeof( libevtx_record_values_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record values.",
+		 function );
+
+		return( -1 );
+	}
+	record_values->string_identifiers_array = string_identifiers_array;
+	record_values->strings_array            = strings_array;
+
+	return( 1 );
+}
+
+/* Copies the header values of the source record values to the destination record values
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_copy_header(
+     libevtx_record_values_t *destination_record_values,
+     libevtx_record_values_t *source_record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_record_values_copy_header";
+
+	if( destination_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source record values.",
+		 function );
+
+		return( -1 );
+	}
+	destination_record_values->offset            = source_record_values->offset;
+	destination_record_values->data_size         = source_record_values->data_size;
+	destination_record_values->chunk_data_offset = source_record_values->chunk_data_offset;
+	destination_record_values->identifier        = source_record_values->identifier;
+	destination_record_values->written_time      = source_record_values->written_time;
+
+	return( 1 );
+}
+
 /* Reads the record values header
  * Returns 1 if successful, 0 if not or -1 on error
  */
@@ -762,6 +904,8 @@ int libevtx_record_values_read_xml_document(
 		}
 	}
 #endif
+	record_values->string_table = io_handle->string_table;
+
 	return( 1 );
 
 on_error:
@@ -1608,9 +1752,9 @@ int libevtx_record_values_get_utf8_provider_identifier_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf8_string_size(
+	if( libevtx_string_table_get_utf8_string_size_from_value(
+	     record_values->string_table,
 	     record_values->provider_identifier_value,
-	     0,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
@@ -1764,9 +1908,9 @@ int libevtx_record_values_get_utf8_provider_identifier(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf8_string(
+	if( libevtx_string_table_copy_value_to_utf8_string(
+	     record_values->string_table,
 	     record_values->provider_identifier_value,
-	     0,
 	     utf8_string,
 	     utf8_string_size,
 	     error ) != 1 )
@@ -1783,19 +1927,22 @@ int libevtx_record_values_get_utf8_provider_identifier(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded provider identifier
- * The returned size includes the end of string character
+/* Retrieves the UTF-8 encoded provider identifier and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_provider_identifier_size(
+int libevtx_record_values_get_utf8_provider_identifier_with_size(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag                = NULL;
 	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier_size";
+	static char *function                           = "libevtx_record_values_get_utf8_provider_identifier_with_size";
 	int result                                      = 0;
 
 	if( record_values == NULL )
@@ -1881,7 +2028,7 @@ int libevtx_record_values_get_utf16_provider_identifier_size(
 			return( 0 );
 		}
 	}
-	if( record_values->provider_name_value == NULL )
+	if( record_values->provider_identifier_value == NULL )
 	{
 		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
 		          record_values->provider_xml_tag,
@@ -1920,17 +2067,19 @@ int libevtx_record_values_get_utf16_provider_identifier_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf16_string_size(
+	if( libevtx_string_table_copy_value_to_utf8_string_with_size(
+	     record_values->string_table,
 	     record_values->provider_identifier_value,
-	     0,
-	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_size,
+	     required_utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -1938,20 +2087,19 @@ int libevtx_record_values_get_utf16_provider_identifier_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded provider identifier
- * The size should include the end of string character
+/* Retrieves the size of the UTF-16 encoded provider identifier
+ * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_provider_identifier(
+int libevtx_record_values_get_utf16_provider_identifier_size(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     size_t *utf16_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag                = NULL;
 	libfwevt_xml_tag_t *system_xml_tag              = NULL;
-	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier";
+	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier_size";
 	int result                                      = 0;
 
 	if( record_values == NULL )
@@ -2076,18 +2224,17 @@ int libevtx_record_values_get_utf16_provider_identifier(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
+	if( libevtx_string_table_get_utf16_string_size_from_value(
+	     record_values->string_table,
 	     record_values->provider_identifier_value,
-	     0,
-	     utf16_string,
 	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider identifier to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of provider identifier.",
 		 function );
 
 		return( -1 );
@@ -2095,20 +2242,21 @@ int libevtx_record_values_get_utf16_provider_identifier(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded source name
- * The returned size includes the end of string character
+/* Retrieves the UTF-16 encoded provider identifier
+ * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_source_name_size(
+int libevtx_record_values_get_utf16_provider_identifier(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
-	libfwevt_xml_tag_t *root_xml_tag          = NULL;
-	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf8_source_name_size";
-	int result                                = 0;
+	libfwevt_xml_tag_t *provider_identifier_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag                = NULL;
+	libfwevt_xml_tag_t *system_xml_tag              = NULL;
+	static char *function                           = "libevtx_record_values_get_utf16_provider_identifier";
+	int result                                      = 0;
 
 	if( record_values == NULL )
 	{
@@ -2197,9 +2345,9 @@ int libevtx_record_values_get_utf8_source_name_size(
 	{
 		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
 		          record_values->provider_xml_tag,
-		          (uint8_t *) "EventSourceName",
-		          15,
-		          &provider_name_xml_tag,
+		          (uint8_t *) "Guid",
+		          4,
+		          &provider_identifier_xml_tag,
 		          error );
 
 		if( result == -1 )
@@ -2208,62 +2356,42 @@ int libevtx_record_values_get_utf8_source_name_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve EventSourceName XML attribute.",
+			 "%s: unable to retrieve Guid XML attribute.",
 			 function );
 
 			return( -1 );
 		}
-		else if( result == 0 )
-		{
-			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
-				  record_values->provider_xml_tag,
-				  (uint8_t *) "Name",
-				  4,
-				  &provider_name_xml_tag,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve Name XML attribute.",
-				 function );
-
-				return( -1 );
-			}
-		}
 		if( result == 0 )
 		{
 			return( 0 );
 		}
 		if( libfwevt_xml_tag_get_value(
-		     provider_name_xml_tag,
-		     &( record_values->provider_name_value ),
+		     provider_identifier_xml_tag,
+		     &( record_values->provider_identifier_value ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider name XML element value.",
+			 "%s: unable to retrieve provider GUID XML element value.",
 			 function );
 
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf8_string_size(
-	     record_values->provider_name_value,
-	     0,
-	     utf8_string_size,
+	if( libevtx_string_table_copy_value_to_utf16_string(
+	     record_values->string_table,
+	     record_values->provider_identifier_value,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of provider name.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider identifier to UTF-16 string.",
 		 function );
 
 		return( -1 );
@@ -2271,20 +2399,19 @@ int libevtx_record_values_get_utf8_source_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded source name
- * The size should include the end of string character
+/* Retrieves the size of the UTF-8 encoded source name
+ * The returned size includes the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_source_name(
+int libevtx_record_values_get_utf8_source_name_size(
      libevtx_record_values_t *record_values,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag          = NULL;
 	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf8_source_name";
+	static char *function                     = "libevtx_record_values_get_utf8_source_name_size";
 	int result                                = 0;
 
 	if( record_values == NULL )
@@ -2430,18 +2557,17 @@ int libevtx_record_values_get_utf8_source_name(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf8_string(
+	if( libevtx_string_table_get_utf8_string_size_from_value(
+	     record_values->string_table,
 	     record_values->provider_name_value,
-	     0,
-	     utf8_string,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy provider name to UTF-8 string.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of provider name.",
 		 function );
 
 		return( -1 );
@@ -2449,19 +2575,20 @@ int libevtx_record_values_get_utf8_source_name(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-16 encoded source name
- * The returned size includes the end of string character
+/* Retrieves the UTF-8 encoded source name
+ * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_source_name_size(
+int libevtx_record_values_get_utf8_source_name(
      libevtx_record_values_t *record_values,
-     size_t *utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag          = NULL;
 	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf16_source_name_size";
+	static char *function                     = "libevtx_record_values_get_utf8_source_name";
 	int result                                = 0;
 
 	if( record_values == NULL )
@@ -2607,17 +2734,18 @@ int libevtx_record_values_get_utf16_source_name_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf16_string_size(
+	if( libevtx_string_table_copy_value_to_utf8_string(
+	     record_values->string_table,
 	     record_values->provider_name_value,
-	     0,
-	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-16 string size of provider name.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider name to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -2625,20 +2753,22 @@ int libevtx_record_values_get_utf16_source_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-16 encoded source name
- * The size should include the end of string character
+/* Retrieves the UTF-8 encoded source name and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf16_source_name(
+int libevtx_record_values_get_utf8_source_name_with_size(
      libevtx_record_values_t *record_values,
-     uint16_t *utf16_string,
-     size_t utf16_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag          = NULL;
 	libfwevt_xml_tag_t *system_xml_tag        = NULL;
-	static char *function                     = "libevtx_record_values_get_utf16_source_name";
+	static char *function                     = "libevtx_record_values_get_utf8_source_name_with_size";
 	int result                                = 0;
 
 	if( record_values == NULL )
@@ -2784,11 +2914,366 @@ int libevtx_record_values_get_utf16_source_name(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
+	if( libevtx_string_table_copy_value_to_utf8_string_with_size(
+	     record_values->string_table,
 	     record_values->provider_name_value,
-	     0,
-	     utf16_string,
-	     utf16_string_size,
+	     utf8_string,
+	     utf8_string_size,
+	     required_utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy provider name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded source name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_source_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag          = NULL;
+	libfwevt_xml_tag_t *system_xml_tag        = NULL;
+	static char *function                     = "libevtx_record_values_get_utf16_source_name_size";
+	int result                                = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_xml_tag == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          root_xml_tag,
+		          (uint8_t *) "System",
+		          6,
+		          &system_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve System XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          system_xml_tag,
+		          (uint8_t *) "Provider",
+		          8,
+		          &( record_values->provider_xml_tag ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Provider XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( record_values->provider_name_value == NULL )
+	{
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          record_values->provider_xml_tag,
+		          (uint8_t *) "EventSourceName",
+		          15,
+		          &provider_name_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventSourceName XML attribute.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+				  record_values->provider_xml_tag,
+				  (uint8_t *) "Name",
+				  4,
+				  &provider_name_xml_tag,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve Name XML attribute.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     provider_name_xml_tag,
+		     &( record_values->provider_name_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider name XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_string_table_get_utf16_string_size_from_value(
+	     record_values->string_table,
+	     record_values->provider_name_value,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of provider name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded source name
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf16_source_name(
+     libevtx_record_values_t *record_values,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *provider_name_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag          = NULL;
+	libfwevt_xml_tag_t *system_xml_tag        = NULL;
+	static char *function                     = "libevtx_record_values_get_utf16_source_name";
+	int result                                = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->provider_xml_tag == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          root_xml_tag,
+		          (uint8_t *) "System",
+		          6,
+		          &system_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve System XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          system_xml_tag,
+		          (uint8_t *) "Provider",
+		          8,
+		          &( record_values->provider_xml_tag ),
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Provider XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( record_values->provider_name_value == NULL )
+	{
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          record_values->provider_xml_tag,
+		          (uint8_t *) "EventSourceName",
+		          15,
+		          &provider_name_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve EventSourceName XML attribute.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+				  record_values->provider_xml_tag,
+				  (uint8_t *) "Name",
+				  4,
+				  &provider_name_xml_tag,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve Name XML attribute.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     provider_name_xml_tag,
+		     &( record_values->provider_name_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider name XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_string_table_copy_value_to_utf16_string(
+	     record_values->string_table,
+	     record_values->provider_name_value,
+	     utf16_string,
+	     utf16_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2803,19 +3288,150 @@ int libevtx_record_values_get_utf16_source_name(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded computer name
- * The returned size includes the end of string character
+/* Retrieves the size of the UTF-8 encoded computer name
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_computer_name_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *computer_xml_tag = NULL;
+	libfwevt_xml_tag_t *root_xml_tag     = NULL;
+	libfwevt_xml_tag_t *system_xml_tag   = NULL;
+	static char *function                = "libevtx_record_values_get_utf8_computer_name_size";
+	int result                           = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->computer_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          root_xml_tag,
+		          (uint8_t *) "System",
+		          6,
+		          &system_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve System XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          system_xml_tag,
+		          (uint8_t *) "Computer",
+		          8,
+		          &computer_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Computer XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     computer_xml_tag,
+		     &( record_values->computer_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve computer XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_string_table_get_utf8_string_size_from_value(
+	     record_values->string_table,
+	     record_values->computer_value,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded computer name
+ * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_computer_name_size(
+int libevtx_record_values_get_utf8_computer_name(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *computer_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag     = NULL;
 	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_computer_name_size";
+	static char *function                = "libevtx_record_values_get_utf8_computer_name";
 	int result                           = 0;
 
 	if( record_values == NULL )
@@ -2915,17 +3531,18 @@ int libevtx_record_values_get_utf8_computer_name_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf8_string_size(
+	if( libevtx_string_table_copy_value_to_utf8_string(
+	     record_values->string_table,
 	     record_values->computer_value,
-	     0,
+	     utf8_string,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of computer name.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -2933,20 +3550,22 @@ int libevtx_record_values_get_utf8_computer_name_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded computer name
- * The size should include the end of string character
+/* Retrieves the UTF-8 encoded computer name and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_computer_name(
+int libevtx_record_values_get_utf8_computer_name_with_size(
      libevtx_record_values_t *record_values,
      uint8_t *utf8_string,
      size_t utf8_string_size,
+     size_t *required_utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *computer_xml_tag = NULL;
 	libfwevt_xml_tag_t *root_xml_tag     = NULL;
 	libfwevt_xml_tag_t *system_xml_tag   = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_computer_name";
+	static char *function                = "libevtx_record_values_get_utf8_computer_name_with_size";
 	int result                           = 0;
 
 	if( record_values == NULL )
@@ -3046,11 +3665,12 @@ int libevtx_record_values_get_utf8_computer_name(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf8_string(
+	if( libevtx_string_table_copy_value_to_utf8_string_with_size(
+	     record_values->string_table,
 	     record_values->computer_value,
-	     0,
 	     utf8_string,
 	     utf8_string_size,
+	     required_utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3177,9 +3797,9 @@ int libevtx_record_values_get_utf16_computer_name_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf16_string_size(
+	if( libevtx_string_table_get_utf16_string_size_from_value(
+	     record_values->string_table,
 	     record_values->computer_value,
-	     0,
 	     utf16_string_size,
 	     error ) != 1 )
 	{
@@ -3308,9 +3928,9 @@ int libevtx_record_values_get_utf16_computer_name(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
+	if( libevtx_string_table_copy_value_to_utf16_string(
+	     record_values->string_table,
 	     record_values->computer_value,
-	     0,
 	     utf16_string,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -3318,8 +3938,161 @@ int libevtx_record_values_get_utf16_computer_name(
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy computer name to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy computer name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded user security identifier
+ * The returned size includes the end of string character
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libevtx_record_values_get_utf8_user_security_identifier_size(
+     libevtx_record_values_t *record_values,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *root_xml_tag     = NULL;
+	libfwevt_xml_tag_t *security_xml_tag = NULL;
+	libfwevt_xml_tag_t *system_xml_tag   = NULL;
+	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
+	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier_size";
+	int result                           = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->user_security_identifier_value == NULL )
+	{
+		if( libfwevt_xml_document_get_root_xml_tag(
+		     record_values->xml_document,
+		     &root_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve root XML element.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          root_xml_tag,
+		          (uint8_t *) "System",
+		          6,
+		          &system_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve System XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_element_by_utf8_name(
+		          system_xml_tag,
+		          (uint8_t *) "Security",
+		          8,
+		          &security_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve Security XML element.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+		          security_xml_tag,
+		          (uint8_t *) "UserID",
+		          6,
+		          &user_id_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UserID XML attribute.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     user_id_xml_tag,
+		     &( record_values->user_security_identifier_value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve user identifier XML element value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libevtx_string_table_get_utf8_string_size_from_value(
+	     record_values->string_table,
+	     record_values->user_security_identifier_value,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
 		 function );
 
 		return( -1 );
@@ -3327,20 +4100,21 @@ int libevtx_record_values_get_utf16_computer_name(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded user security identifier
- * The returned size includes the end of string character
+/* Retrieves the UTF-8 encoded user security identifier
+ * The size should include the end of string character
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_user_security_identifier_size(
+int libevtx_record_values_get_utf8_user_security_identifier(
      libevtx_record_values_t *record_values,
-     size_t *utf8_string_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *root_xml_tag     = NULL;
 	libfwevt_xml_tag_t *security_xml_tag = NULL;
 	libfwevt_xml_tag_t *system_xml_tag   = NULL;
 	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier_size";
+	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier";
 	int result                           = 0;
 
 	if( record_values == NULL )
@@ -3462,17 +4236,18 @@ int libevtx_record_values_get_utf8_user_security_identifier_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf8_string_size(
+	if( libevtx_string_table_copy_value_to_utf8_string(
+	     record_values->string_table,
 	     record_values->user_security_identifier_value,
-	     0,
+	     utf8_string,
 	     utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of user security identifier.",
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy user security identifier to UTF-8 string.",
 		 function );
 
 		return( -1 );
@@ -3480,21 +4255,23 @@ int libevtx_record_values_get_utf8_user_security_identifier_size(
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 encoded user security identifier
- * The size should include the end of string character
+/* Retrieves the UTF-8 encoded user security identifier and its size
+ * The required size includes the end of string character
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
  * Returns 1 if successful, 0 if not available or -1 on error
  */
-int libevtx_record_values_get_utf8_user_security_identifier(
+int libevtx_record_values_get_utf8_user_security_identifier_with_size(
      libevtx_record_values_t *record_values,
      uint8_t *utf8_string,
      size_t utf8_string_size,
+     size_t *required_utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_xml_tag_t *root_xml_tag     = NULL;
 	libfwevt_xml_tag_t *security_xml_tag = NULL;
 	libfwevt_xml_tag_t *system_xml_tag   = NULL;
 	libfwevt_xml_tag_t *user_id_xml_tag  = NULL;
-	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier";
+	static char *function                = "libevtx_record_values_get_utf8_user_security_identifier_with_size";
 	int result                           = 0;
 
 	if( record_values == NULL )
@@ -3616,11 +4393,12 @@ int libevtx_record_values_get_utf8_user_security_identifier(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf8_string(
+	if( libevtx_string_table_copy_value_to_utf8_string_with_size(
+	     record_values->string_table,
 	     record_values->user_security_identifier_value,
-	     0,
 	     utf8_string,
 	     utf8_string_size,
+	     required_utf8_string_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3770,9 +4548,9 @@ int libevtx_record_values_get_utf16_user_security_identifier_size(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_get_utf16_string_size(
+	if( libevtx_string_table_get_utf16_string_size_from_value(
+	     record_values->string_table,
 	     record_values->user_security_identifier_value,
-	     0,
 	     utf16_string_size,
 	     error ) != 1 )
 	{
@@ -3924,9 +4702,9 @@ int libevtx_record_values_get_utf16_user_security_identifier(
 			return( -1 );
 		}
 	}
-	if( libfvalue_value_copy_to_utf16_string(
+	if( libevtx_string_table_copy_value_to_utf16_string(
+	     record_values->string_table,
 	     record_values->user_security_identifier_value,
-	     0,
 	     utf16_string,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -3952,6 +4730,9 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
      libfwevt_xml_tag_t *template_xml_tag,
      libcerror_error_t **error )
 {
+	uint8_t data_name_buffer[ 64 ];
+	uint8_t template_name_buffer[ 64 ];
+
 	libfwevt_xml_tag_t *sub_data_xml_tag     = NULL;
 	libfwevt_xml_tag_t *sub_template_xml_tag = NULL;
 	uint8_t *data_name                       = NULL;
@@ -4096,33 +4877,44 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 
 			goto on_error;
 		}
-		data_name = (uint8_t *) memory_allocate(
-		                         sizeof( uint8_t ) * data_name_size );
-
-		if( data_name == NULL )
+		/* Most element and attribute names are short, hence only
+		 * allocate the names if they do not fit in the buffers
+		 */
+		if( data_name_size <= 64 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data name.",
-			 function );
-
-			goto on_error;
+			data_name     = data_name_buffer;
+			template_name = template_name_buffer;
 		}
-		template_name = (uint8_t *) memory_allocate(
-		                             sizeof( uint8_t ) * template_name_size );
-
-		if( template_name == NULL )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create template name.",
-			 function );
+			data_name = (uint8_t *) memory_allocate(
+			                         sizeof( uint8_t ) * data_name_size );
 
-			goto on_error;
+			if( data_name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create data name.",
+				 function );
+
+				goto on_error;
+			}
+			template_name = (uint8_t *) memory_allocate(
+			                             sizeof( uint8_t ) * template_name_size );
+
+			if( template_name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create template name.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		if( libfwevt_xml_tag_get_utf8_name(
 		     data_xml_tag,
@@ -4159,14 +4951,18 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 			  template_name,
 			  sizeof( uint8_t ) * template_name_size );
 
-		memory_free(
-		 template_name );
-
+		if( template_name != template_name_buffer )
+		{
+			memory_free(
+			 template_name );
+		}
 		template_name = NULL;
 
-		memory_free(
-		 data_name );
-
+		if( data_name != data_name_buffer )
+		{
+			memory_free(
+			 data_name );
+		}
 		data_name = NULL;
 
 		if( result != 0 )
@@ -4363,12 +5159,14 @@ int libevtx_record_values_parse_data_xml_tag_by_template(
 	return( 1 );
 
 on_error:
-	if( template_name != NULL )
+	if( ( template_name != NULL )
+	 && ( template_name != template_name_buffer ) )
 	{
 		memory_free(
 		 template_name );
 	}
-	if( data_name != NULL )
+	if( ( data_name != NULL )
+	 && ( data_name != data_name_buffer ) )
 	{
 		memory_free(
 		 data_name );
@@ -4416,55 +5214,42 @@ int libevtx_record_values_parse_data(
 
 		return( -1 );
 	}
-	if( record_values->string_identifiers_array != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record values - string identifiers array value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( record_values->strings_array != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record values - strings array value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( libcdata_array_initialize(
-	     &( record_values->string_identifiers_array ),
-	     0,
-	     error ) != 1 )
+	/* The strings arrays are kept by libevtx_record_values_clear
+	 * when the record values are reused
+	 */
+	if( record_values->string_identifiers_array == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create string identifiers array.",
-		 function );
+		if( libcdata_array_initialize(
+		     &( record_values->string_identifiers_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create string identifiers array.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	if( libcdata_array_initialize(
-	     &( record_values->strings_array ),
-	     0,
-	     error ) != 1 )
+	if( record_values->strings_array == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create strings array.",
-		 function );
+		if( libcdata_array_initialize(
+		     &( record_values->strings_array ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create strings array.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( internal_template_definition != NULL )
 	{
@@ -4753,8 +5538,10 @@ int libevtx_record_values_get_utf8_string_size(
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
+	libfvalue_value_t *string_value    = NULL;
 	libfwevt_xml_tag_t *string_xml_tag = NULL;
 	static char *function              = "libevtx_record_values_get_utf8_string_size";
+	int result                         = 0;
 
 	if( record_values == NULL )
 	{
@@ -4812,10 +5599,27 @@ int libevtx_record_values_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_utf8_value_size(
+	if( libfwevt_xml_tag_get_value(
 	     string_xml_tag,
-	     utf8_string_size,
+	     &string_value,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	result = libevtx_utf8_string_size_from_value(
+	          string_value,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4827,6 +5631,10 @@ int libevtx_record_values_get_utf8_string_size(
 
 		return( -1 );
 	}
+	else if( result == 0 )
+	{
+		*utf8_string_size = 0;
+	}
 	return( 1 );
 }
 
@@ -4842,6 +5650,7 @@ int libevtx_record_values_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
+	libfvalue_value_t *string_value    = NULL;
 	libfwevt_xml_tag_t *string_xml_tag = NULL;
 	static char *function              = "libevtx_record_values_get_utf8_string";
 
@@ -4901,10 +5710,118 @@ int libevtx_record_values_get_utf8_string(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_utf8_value(
+	if( libfwevt_xml_tag_get_value(
 	     string_xml_tag,
+	     &string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libevtx_utf8_string_copy_from_value(
 	     utf8_string,
 	     utf8_string_size,
+	     string_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d value.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific UTF-8 encoded string and its size
+ * The required size includes the end of string character or is 0 if the string has no value
+ * The UTF-8 string only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_record_values_get_utf8_string_with_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *string_value    = NULL;
+	libfwevt_xml_tag_t *string_xml_tag = NULL;
+	static char *function              = "libevtx_record_values_get_utf8_string_with_size";
+	int result                         = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record values - missing XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->data_parsed == 0 )
+	{
+		if( libevtx_record_values_parse_data(
+		     record_values,
+		     io_handle,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to parse data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     record_values->strings_array,
+	     string_index,
+	     (intptr_t **) &string_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_value(
+	     string_xml_tag,
+	     &string_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4917,6 +5834,29 @@ int libevtx_record_values_get_utf8_string(
 
 		return( -1 );
 	}
+	result = libevtx_utf8_string_copy_from_value_with_size(
+	          utf8_string,
+	          utf8_string_size,
+	          string_value,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string: %d value to UTF-8 string.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		*required_utf8_string_size = 0;
+	}
 	return( 1 );
 }
 
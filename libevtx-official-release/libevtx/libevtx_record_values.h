@@ -30,6 +30,7 @@
 #include "libevtx_libcerror.h"
 #include "libevtx_libfvalue.h"
 #include "libevtx_libfwevt.h"
+#include "libevtx_string_table.h"
 #include "libevtx_template_definition.h"
 #include "libevtx_types.h"
 
@@ -131,6 +132,11 @@ struct libevtx_record_values
 	 */
 	libfvalue_value_t *binary_data_value;
 
+	/* Reference to the string table of the file, which is used to reuse
+	 * the formatted strings of the provider, computer and user values
+	 */
+	libevtx_string_table_t *string_table;
+
 	/* Value to indicate the data was parsed
 	 */
 	uint8_t data_parsed;
@@ -149,6 +155,15 @@ int libevtx_record_values_clone(
      libevtx_record_values_t *source_record_values,
      libcerror_error_t **error );
 
+int libevtx_record_values_clear(
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_record_values_copy_header(
+     libevtx_record_values_t *destination_record_values,
+     libevtx_record_values_t *source_record_values,
+     libcerror_error_t **error );
+
 int libevtx_record_values_read_header(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
@@ -205,6 +220,13 @@ int libevtx_record_values_get_utf8_provider_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_provider_identifier_with_size(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_provider_identifier_size(
      libevtx_record_values_t *record_values,
      size_t *utf16_string_size,
@@ -227,6 +249,13 @@ int libevtx_record_values_get_utf8_source_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_source_name_with_size(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_source_name_size(
      libevtx_record_values_t *record_values,
      size_t *utf16_string_size,
@@ -249,6 +278,13 @@ int libevtx_record_values_get_utf8_computer_name(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_computer_name_with_size(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_computer_name_size(
      libevtx_record_values_t *record_values,
      size_t *utf16_string_size,
@@ -271,6 +307,13 @@ int libevtx_record_values_get_utf8_user_security_identifier(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_user_security_identifier_with_size(
+     libevtx_record_values_t *record_values,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_user_security_identifier_size(
      libevtx_record_values_t *record_values,
      size_t *utf16_string_size,
@@ -309,6 +352,15 @@ int libevtx_record_values_get_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+int libevtx_record_values_get_utf8_string_with_size(
+     libevtx_record_values_t *record_values,
+     libevtx_io_handle_t *io_handle,
+     int string_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
 int libevtx_record_values_get_utf16_string_size(
      libevtx_record_values_t *record_values,
      libevtx_io_handle_t *io_handle,
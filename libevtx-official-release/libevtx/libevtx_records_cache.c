@@ -0,0 +1,906 @@
+/*
+ * Records cache functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+#include "libevtx_records_cache.h"
+
+/* Creates a records cache
+ * Make sure the value records_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_initialize(
+     libevtx_records_cache_t **records_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_records_cache_initialize";
+	size_t entries_size        = 0;
+	uint32_t number_of_buckets = 1;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The hash table has at least twice as many buckets as there are cache entries
+	 * so that it always contains empty buckets
+	 */
+	while( number_of_buckets < (uint32_t) ( 2 * number_of_entries ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	*records_cache = memory_allocate_structure(
+	                  libevtx_records_cache_t );
+
+	if( *records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *records_cache,
+	     0,
+	     sizeof( libevtx_records_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records cache.",
+		 function );
+
+		memory_free(
+		 *records_cache );
+
+		*records_cache = NULL;
+
+		return( -1 );
+	}
+	entries_size = sizeof( libevtx_record_values_t * ) * (size_t) number_of_entries;
+
+	( *records_cache )->entries = (libevtx_record_values_t **) memory_allocate(
+	                                                            entries_size );
+
+	if( ( *records_cache )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *records_cache )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *records_cache )->entry_offsets = (off64_t *) memory_allocate(
+	                                                 sizeof( off64_t ) * (size_t) number_of_entries );
+
+	if( ( *records_cache )->entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	( *records_cache )->hash_table = (int *) memory_allocate(
+	                                          sizeof( int ) * (size_t) number_of_buckets );
+
+	if( ( *records_cache )->hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty bucket contains -1, which has all bits set
+	 */
+	if( memory_set(
+	     ( *records_cache )->hash_table,
+	     0xff,
+	     sizeof( int ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	( *records_cache )->number_of_entries = number_of_entries;
+	( *records_cache )->hash_table_mask   = number_of_buckets - 1;
+
+	return( 1 );
+
+on_error:
+	if( *records_cache != NULL )
+	{
+		if( ( *records_cache )->hash_table != NULL )
+		{
+			memory_free(
+			 ( *records_cache )->hash_table );
+		}
+		if( ( *records_cache )->entry_offsets != NULL )
+		{
+			memory_free(
+			 ( *records_cache )->entry_offsets );
+		}
+		if( ( *records_cache )->entries != NULL )
+		{
+			memory_free(
+			 ( *records_cache )->entries );
+		}
+		memory_free(
+		 *records_cache );
+
+		*records_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a records cache and the record values it contains
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_free(
+     libevtx_records_cache_t **records_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_cache_free";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_cache != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < ( *records_cache )->number_of_entries;
+		     entry_index++ )
+		{
+			if( ( *records_cache )->entries[ entry_index ] != NULL )
+			{
+				if( libevtx_record_values_free(
+				     &( ( *records_cache )->entries[ entry_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values: %d.",
+					 function,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+		}
+		memory_free(
+		 ( *records_cache )->hash_table );
+
+		memory_free(
+		 ( *records_cache )->entry_offsets );
+
+		memory_free(
+		 ( *records_cache )->entries );
+
+		memory_free(
+		 *records_cache );
+
+		*records_cache = NULL;
+	}
+	return( result );
+}
+
+/* Resizes a records cache
+ * The most recently set record values are kept, other record values are freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_resize(
+     libevtx_records_cache_t *records_cache,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libevtx_record_values_t **entries = NULL;
+	off64_t *entry_offsets            = NULL;
+	int *hash_table                   = NULL;
+	static char *function             = "libevtx_records_cache_resize";
+	size_t entries_size               = 0;
+	uint32_t bucket_index             = 0;
+	uint32_t hash_table_mask          = 0;
+	uint32_t number_of_buckets        = 1;
+	int entry_index                   = 0;
+	int entry_iterator                = 0;
+	int number_of_cached_entries      = 0;
+	int number_of_evicted_entries     = 0;
+	int resized_entry_index           = 0;
+	int result                        = 1;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( number_of_entries > LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == records_cache->number_of_entries )
+	{
+		return( 1 );
+	}
+	while( number_of_buckets < (uint32_t) ( 2 * number_of_entries ) )
+	{
+		number_of_buckets <<= 1;
+	}
+	hash_table_mask = number_of_buckets - 1;
+
+	entries_size = sizeof( libevtx_record_values_t * ) * (size_t) number_of_entries;
+
+	entries = (libevtx_record_values_t **) memory_allocate(
+	                                        entries_size );
+
+	if( entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	entry_offsets = (off64_t *) memory_allocate(
+	                             sizeof( off64_t ) * (size_t) number_of_entries );
+
+	if( entry_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry offsets.",
+		 function );
+
+		goto on_error;
+	}
+	hash_table = (int *) memory_allocate(
+	                      sizeof( int ) * (size_t) number_of_buckets );
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	/* An empty bucket contains -1, which has all bits set
+	 */
+	if( memory_set(
+	     hash_table,
+	     0xff,
+	     sizeof( int ) * (size_t) number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		goto on_error;
+	}
+	for( entry_index = 0;
+	     entry_index < records_cache->number_of_entries;
+	     entry_index++ )
+	{
+		if( records_cache->entries[ entry_index ] != NULL )
+		{
+			number_of_cached_entries++;
+		}
+	}
+	if( number_of_cached_entries > number_of_entries )
+	{
+		number_of_evicted_entries = number_of_cached_entries - number_of_entries;
+	}
+	/* Move the cached record values from the least to the most recently set
+	 */
+	for( entry_iterator = 0;
+	     entry_iterator < records_cache->number_of_entries;
+	     entry_iterator++ )
+	{
+		entry_index = ( records_cache->next_entry_index + entry_iterator ) % records_cache->number_of_entries;
+
+		if( records_cache->entries[ entry_index ] == NULL )
+		{
+			continue;
+		}
+		if( number_of_evicted_entries > 0 )
+		{
+			records_cache->resident_size       -= records_cache->entries[ entry_index ]->data_size;
+			records_cache->number_of_evictions += 1;
+
+			if( libevtx_record_values_free(
+			     &( records_cache->entries[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+			number_of_evicted_entries--;
+
+			continue;
+		}
+		entries[ resized_entry_index ]       = records_cache->entries[ entry_index ];
+		entry_offsets[ resized_entry_index ] = records_cache->entry_offsets[ entry_index ];
+
+		bucket_index = libevtx_records_cache_get_hash_value(
+		                entry_offsets[ resized_entry_index ] ) & hash_table_mask;
+
+		while( hash_table[ bucket_index ] != -1 )
+		{
+			bucket_index = ( bucket_index + 1 ) & hash_table_mask;
+		}
+		hash_table[ bucket_index ] = resized_entry_index;
+
+		resized_entry_index++;
+	}
+	memory_free(
+	 records_cache->hash_table );
+
+	memory_free(
+	 records_cache->entry_offsets );
+
+	memory_free(
+	 records_cache->entries );
+
+	records_cache->entries           = entries;
+	records_cache->entry_offsets     = entry_offsets;
+	records_cache->number_of_entries = number_of_entries;
+	records_cache->next_entry_index  = resized_entry_index % number_of_entries;
+	records_cache->hash_table        = hash_table;
+	records_cache->hash_table_mask   = hash_table_mask;
+
+	return( result );
+
+on_error:
+	if( hash_table != NULL )
+	{
+		memory_free(
+		 hash_table );
+	}
+	if( entry_offsets != NULL )
+	{
+		memory_free(
+		 entry_offsets );
+	}
+	if( entries != NULL )
+	{
+		memory_free(
+		 entries );
+	}
+	return( -1 );
+}
+
+/* Calculates the hash value of a record offset
+ * Returns the hash value
+ */
+uint32_t libevtx_records_cache_get_hash_value(
+          off64_t record_offset )
+{
+	uint32_t hash_value = 0;
+
+	/* Records are stored 8-byte aligned
+	 */
+	hash_value = (uint32_t) ( (uint64_t) record_offset >> 3 );
+	hash_value = hash_value * (uint32_t) 0x9e3779b1UL;
+
+	return( hash_value ^ ( hash_value >> 16 ) );
+}
+
+/* Retrieves the record values of a specific record offset
+ * The record values are managed by the records cache
+ * Returns 1 if successful, 0 if the record values are not cached or -1 on error
+ */
+int libevtx_records_cache_get_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_cache_get_record_values";
+	uint32_t bucket_index = 0;
+	int entry_index       = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libevtx_records_cache_get_hash_value(
+	                record_offset ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ bucket_index ] != -1 )
+	{
+		entry_index = records_cache->hash_table[ bucket_index ];
+
+		if( records_cache->entry_offsets[ entry_index ] == record_offset )
+		{
+			*record_values = records_cache->entries[ entry_index ];
+
+			records_cache->number_of_hits += 1;
+
+			return( 1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	records_cache->number_of_misses += 1;
+
+	return( 0 );
+}
+
+/* Determines if the record values of a specific record offset are cached
+ * Unlike libevtx_records_cache_get_record_values the cache statistics are not updated
+ * Returns 1 if the record values are cached, 0 if not or -1 on error
+ */
+int libevtx_records_cache_has_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_cache_has_record_values";
+	uint32_t bucket_index = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libevtx_records_cache_get_hash_value(
+	                record_offset ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ bucket_index ] != -1 )
+	{
+		if( records_cache->entry_offsets[ records_cache->hash_table[ bucket_index ] ] == record_offset )
+		{
+			return( 1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	return( 0 );
+}
+
+/* Sets the record values of a specific record offset
+ * The records cache takes over management of the record values and
+ * replaces the cache entry that was set least recently when the cache is full
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_set_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_cache_set_record_values";
+	uint32_t bucket_index = 0;
+	int entry_index       = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libevtx_records_cache_get_hash_value(
+	                record_offset ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ bucket_index ] != -1 )
+	{
+		if( records_cache->entry_offsets[ records_cache->hash_table[ bucket_index ] ] == record_offset )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid records cache - record values at offset: %" PRIi64 " already set.",
+			 function,
+			 record_offset );
+
+			return( -1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	entry_index = records_cache->next_entry_index;
+
+	if( records_cache->entries[ entry_index ] != NULL )
+	{
+		if( libevtx_records_cache_remove_entry(
+		     records_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		records_cache->number_of_evictions += 1;
+	}
+	bucket_index = libevtx_records_cache_get_hash_value(
+	                record_offset ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ bucket_index ] != -1 )
+	{
+		bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	records_cache->hash_table[ bucket_index ] = entry_index;
+
+	records_cache->entries[ entry_index ]       = record_values;
+	records_cache->entry_offsets[ entry_index ] = record_offset;
+	records_cache->resident_size               += record_values->data_size;
+
+	records_cache->next_entry_index = ( entry_index + 1 ) % records_cache->number_of_entries;
+
+	return( 1 );
+}
+
+/* Removes a specific cache entry and frees its record values
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_remove_entry(
+     libevtx_records_cache_t *records_cache,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevtx_records_cache_remove_entry";
+	uint32_t bucket_index      = 0;
+	uint32_t home_bucket_index = 0;
+	uint32_t next_bucket_index = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= records_cache->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_cache->entries[ entry_index ] == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid records cache - missing cache entry: %d.",
+		 function,
+		 entry_index );
+
+		return( -1 );
+	}
+	/* Remove the cache entry from the hash table
+	 */
+	bucket_index = libevtx_records_cache_get_hash_value(
+	                records_cache->entry_offsets[ entry_index ] ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ bucket_index ] != entry_index )
+	{
+		if( records_cache->hash_table[ bucket_index ] == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid records cache - missing cache entry: %d in hash table.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	records_cache->hash_table[ bucket_index ] = -1;
+
+	/* Move the cache entries that follow the removed cache entry
+	 * into the empty bucket when it lies between their home bucket
+	 * and their current bucket, so that look ups do not stop early
+	 */
+	next_bucket_index = ( bucket_index + 1 ) & records_cache->hash_table_mask;
+
+	while( records_cache->hash_table[ next_bucket_index ] != -1 )
+	{
+		home_bucket_index = libevtx_records_cache_get_hash_value(
+		                     records_cache->entry_offsets[ records_cache->hash_table[ next_bucket_index ] ] ) & records_cache->hash_table_mask;
+
+		if( ( ( next_bucket_index - home_bucket_index ) & records_cache->hash_table_mask )
+		 >= ( ( next_bucket_index - bucket_index ) & records_cache->hash_table_mask ) )
+		{
+			records_cache->hash_table[ bucket_index ]      = records_cache->hash_table[ next_bucket_index ];
+			records_cache->hash_table[ next_bucket_index ] = -1;
+
+			bucket_index = next_bucket_index;
+		}
+		next_bucket_index = ( next_bucket_index + 1 ) & records_cache->hash_table_mask;
+	}
+	records_cache->resident_size -= records_cache->entries[ entry_index ]->data_size;
+
+	if( libevtx_record_values_free(
+	     &( records_cache->entries[ entry_index ] ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record values: %d.",
+		 function,
+		 entry_index );
+
+		records_cache->entries[ entry_index ] = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Removes the record values of the records at or after a specific record offset
+ * This is used when the data at these offsets has changed
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_cache_remove_from_offset(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_cache_remove_from_offset";
+	int entry_index       = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < records_cache->number_of_entries;
+	     entry_index++ )
+	{
+		if( ( records_cache->entries[ entry_index ] == NULL )
+		 || ( records_cache->entry_offsets[ entry_index ] < record_offset ) )
+		{
+			continue;
+		}
+		if( libevtx_records_cache_remove_entry(
+		     records_cache,
+		     entry_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove cache entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,134 @@
+/*
+ * Records cache functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_RECORDS_CACHE_H )
+#define _LIBEVTX_RECORDS_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of entries of the records cache
+ */
+#define LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES		65536
+
+typedef struct libevtx_records_cache libevtx_records_cache_t;
+
+struct libevtx_records_cache
+{
+	/* The record values of each cache entry
+	 */
+	libevtx_record_values_t **entries;
+
+	/* The record offset of each cache entry
+	 */
+	off64_t *entry_offsets;
+
+	/* The number of cache entries
+	 */
+	int number_of_entries;
+
+	/* The index of the cache entry that is replaced next
+	 */
+	int next_entry_index;
+
+	/* The hash table, which contains the cache entry index of each bucket
+	 * or -1 if the bucket is empty
+	 */
+	int *hash_table;
+
+	/* The hash table mask, the number of hash table buckets - 1
+	 */
+	uint32_t hash_table_mask;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of cache evictions
+	 */
+	uint64_t number_of_evictions;
+
+	/* The size of the record data of the cached record values
+	 */
+	size64_t resident_size;
+};
+
+int libevtx_records_cache_initialize(
+     libevtx_records_cache_t **records_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_free(
+     libevtx_records_cache_t **records_cache,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_resize(
+     libevtx_records_cache_t *records_cache,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+uint32_t libevtx_records_cache_get_hash_value(
+          off64_t record_offset );
+
+int libevtx_records_cache_get_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libevtx_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_has_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_set_record_values(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libevtx_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_remove_entry(
+     libevtx_records_cache_t *records_cache,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libevtx_records_cache_remove_from_offset(
+     libevtx_records_cache_t *records_cache,
+     off64_t record_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORDS_CACHE_H ) */
+
@@ -0,0 +1,554 @@
+/*
+ * Records index functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_records_index.h"
+
+/* Creates a records index
+ * Make sure the value records_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_initialize(
+     libevtx_records_index_t **records_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_initialize";
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*records_index = memory_allocate_structure(
+	                  libevtx_records_index_t );
+
+	if( *records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *records_index,
+	     0,
+	     sizeof( libevtx_records_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *records_index != NULL )
+	{
+		memory_free(
+		 *records_index );
+
+		*records_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a records index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_free(
+     libevtx_records_index_t **records_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_free";
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_index != NULL )
+	{
+		if( ( *records_index )->chunk_data_offsets != NULL )
+		{
+			memory_free(
+			 ( *records_index )->chunk_data_offsets );
+		}
+		if( ( *records_index )->chunk_indexes != NULL )
+		{
+			memory_free(
+			 ( *records_index )->chunk_indexes );
+		}
+		memory_free(
+		 *records_index );
+
+		*records_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Clones the records index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_clone(
+     libevtx_records_index_t **destination_records_index,
+     libevtx_records_index_t *source_records_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_clone";
+
+	if( destination_records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_records_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination records index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_records_index == NULL )
+	{
+		*destination_records_index = NULL;
+
+		return( 1 );
+	}
+	if( libevtx_records_index_initialize(
+	     destination_records_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination records index.",
+		 function );
+
+		goto on_error;
+	}
+	if( source_records_index->number_of_entries > 0 )
+	{
+		if( libevtx_records_index_resize(
+		     *destination_records_index,
+		     source_records_index->number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize destination records index.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_records_index )->chunk_indexes,
+		     source_records_index->chunk_indexes,
+		     sizeof( uint32_t ) * (size_t) source_records_index->number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk indexes.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     ( *destination_records_index )->chunk_data_offsets,
+		     source_records_index->chunk_data_offsets,
+		     sizeof( uint16_t ) * (size_t) source_records_index->number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy chunk data offsets.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *destination_records_index )->number_of_entries = source_records_index->number_of_entries;
+
+	return( 1 );
+
+on_error:
+	if( *destination_records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 destination_records_index,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Resizes the records index to hold at least the number of entries
+ * The records index is never shrunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_resize(
+     libevtx_records_index_t *records_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_resize";
+	void *reallocation    = NULL;
+	size_t entries_size   = 0;
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries <= records_index->number_of_allocated_entries )
+	{
+		return( 1 );
+	}
+	entries_size = sizeof( uint32_t ) * (size_t) number_of_entries;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid entries size value exceeds maximum allocation size.",
+		 function );
+
+		return( -1 );
+	}
+	reallocation = memory_reallocate(
+	                records_index->chunk_indexes,
+	                entries_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize chunk indexes.",
+		 function );
+
+		return( -1 );
+	}
+	records_index->chunk_indexes = (uint32_t *) reallocation;
+
+	reallocation = memory_reallocate(
+	                records_index->chunk_data_offsets,
+	                sizeof( uint16_t ) * (size_t) number_of_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize chunk data offsets.",
+		 function );
+
+		return( -1 );
+	}
+	records_index->chunk_data_offsets          = (uint16_t *) reallocation;
+	records_index->number_of_allocated_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Appends an entry to the records index
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_append_entry(
+     libevtx_records_index_t *records_index,
+     uint32_t chunk_index,
+     uint16_t chunk_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_append_entry";
+	int number_of_entries = 0;
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_index->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid records index - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( records_index->number_of_entries >= records_index->number_of_allocated_entries )
+	{
+		/* Grow the arrays geometrically to keep appending amortized constant time
+		 */
+		if( records_index->number_of_allocated_entries == 0 )
+		{
+			number_of_entries = LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES;
+		}
+		else if( records_index->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			number_of_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_entries = records_index->number_of_allocated_entries * 2;
+		}
+		if( libevtx_records_index_resize(
+		     records_index,
+		     number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize records index.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	records_index->chunk_indexes[ records_index->number_of_entries ]      = chunk_index;
+	records_index->chunk_data_offsets[ records_index->number_of_entries ] = chunk_data_offset;
+
+	records_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Truncates the records index to a specific number of entries
+ * The allocated entries are kept so that they can be reused by appended entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_truncate(
+     libevtx_records_index_t *records_index,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_truncate";
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 0 )
+	 || ( number_of_entries > records_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	records_index->number_of_entries = number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_get_number_of_entries(
+     libevtx_records_index_t *records_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_get_number_of_entries";
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = records_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_records_index_get_entry_by_index(
+     libevtx_records_index_t *records_index,
+     int entry_index,
+     uint32_t *chunk_index,
+     uint16_t *chunk_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_records_index_get_entry_by_index";
+
+	if( records_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= records_index->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk index.",
+		 function );
+
+		return( -1 );
+	}
+	if( chunk_data_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid chunk data offset.",
+		 function );
+
+		return( -1 );
+	}
+	*chunk_index       = records_index->chunk_indexes[ entry_index ];
+	*chunk_data_offset = records_index->chunk_data_offsets[ entry_index ];
+
+	return( 1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Records index functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _LIBEVTX_RECORDS_INDEX_H )
+#define _LIBEVTX_RECORDS_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The initial number of entries allocated by the records index
+ */
+#define LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES		1024
+
+typedef struct libevtx_records_index libevtx_records_index_t;
+
+struct libevtx_records_index
+{
+	/* The chunk index of each record
+	 */
+	uint32_t *chunk_indexes;
+
+	/* The offset of each record relative to the start of its chunk
+	 */
+	uint16_t *chunk_data_offsets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libevtx_records_index_initialize(
+     libevtx_records_index_t **records_index,
+     libcerror_error_t **error );
+
+int libevtx_records_index_free(
+     libevtx_records_index_t **records_index,
+     libcerror_error_t **error );
+
+int libevtx_records_index_clone(
+     libevtx_records_index_t **destination_records_index,
+     libevtx_records_index_t *source_records_index,
+     libcerror_error_t **error );
+
+int libevtx_records_index_resize(
+     libevtx_records_index_t *records_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_records_index_append_entry(
+     libevtx_records_index_t *records_index,
+     uint32_t chunk_index,
+     uint16_t chunk_data_offset,
+     libcerror_error_t **error );
+
+int libevtx_records_index_truncate(
+     libevtx_records_index_t *records_index,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_records_index_get_number_of_entries(
+     libevtx_records_index_t *records_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevtx_records_index_get_entry_by_index(
+     libevtx_records_index_t *records_index,
+     int entry_index,
+     uint32_t *chunk_index,
+     uint16_t *chunk_data_offset,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_RECORDS_INDEX_H ) */
+
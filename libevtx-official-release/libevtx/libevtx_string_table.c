@@ -0,0 +1,892 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevtx_interned_string.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+#include "libevtx_string_table.h"
+#include "libevtx_utf8_string.h"
+
+/* Creates a string table
+ * Make sure the value string_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_initialize(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevtx_string_table_initialize";
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*string_table = memory_allocate_structure(
+	                 libevtx_string_table_t );
+
+	if( *string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *string_table,
+	     0,
+	     sizeof( libevtx_string_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear string table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string_table != NULL )
+	{
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a string table
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_string_table_free(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error )
+{
+	libevtx_interned_string_t *interned_string      = NULL;
+	libevtx_interned_string_t *next_interned_string = NULL;
+	static char *function                           = "libevtx_string_table_free";
+	int bucket_index                                = 0;
+	int result                                      = 1;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_table != NULL )
+	{
+		for( bucket_index = 0;
+		     bucket_index < LIBEVTX_STRING_TABLE_NUMBER_OF_BUCKETS;
+		     bucket_index++ )
+		{
+			interned_string = ( *string_table )->buckets[ bucket_index ];
+
+			while( interned_string != NULL )
+			{
+				next_interned_string = interned_string->next_interned_string;
+
+				if( libevtx_interned_string_free(
+				     &interned_string,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free interned string.",
+					 function );
+
+					result = -1;
+				}
+				interned_string = next_interned_string;
+			}
+		}
+		memory_free(
+		 *string_table );
+
+		*string_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the interned string of a value
+ * The value is identified by its type, format flags, encoding and the data of
+ * its first entry. An interned string is added if the value is not yet present
+ * Returns 1 if successful, 0 if the value cannot be interned or -1 on error
+ */
+int libevtx_string_table_get_interned_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     libevtx_interned_string_t **interned_string,
+     libcerror_error_t **error )
+{
+	libevtx_interned_string_t *safe_interned_string = NULL;
+	uint8_t *entry_data                             = NULL;
+	static char *function                           = "libevtx_string_table_get_interned_string_by_value";
+	size_t data_offset                              = 0;
+	size_t entry_data_size                          = 0;
+	uint32_t bucket_index                           = 0;
+	uint32_t format_flags                           = 0;
+	uint32_t hash                                   = 0;
+	int encoding                                    = 0;
+	int result                                      = 0;
+	int value_type                                  = 0;
+
+	if( string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( interned_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_type(
+	     value,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_format_flags(
+	     value,
+	     &format_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value format flags.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfvalue_value_get_entry_data(
+	          value,
+	          0,
+	          &entry_data,
+	          &entry_data_size,
+	          &encoding,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result == 0 )
+	      || ( entry_data_size > LIBEVTX_STRING_TABLE_MAXIMUM_DATA_SIZE ) )
+	{
+		return( 0 );
+	}
+	/* Calculate a 32-bit FNV-1a hash of the data, the type is used as the initial value
+	 */
+	hash = 0x811c9dc5UL ^ (uint32_t) value_type;
+
+	for( data_offset = 0;
+	     data_offset < entry_data_size;
+	     data_offset++ )
+	{
+		hash ^= entry_data[ data_offset ];
+		hash *= 0x01000193UL;
+	}
+	bucket_index = hash % LIBEVTX_STRING_TABLE_NUMBER_OF_BUCKETS;
+
+	safe_interned_string = string_table->buckets[ bucket_index ];
+
+	while( safe_interned_string != NULL )
+	{
+		if( ( safe_interned_string->hash == hash )
+		 && ( safe_interned_string->value_type == value_type )
+		 && ( safe_interned_string->format_flags == format_flags )
+		 && ( safe_interned_string->encoding == encoding )
+		 && ( safe_interned_string->data_size == entry_data_size )
+		 && ( memory_compare(
+		       safe_interned_string->data,
+		       entry_data,
+		       entry_data_size ) == 0 ) )
+		{
+			*interned_string = safe_interned_string;
+
+			return( 1 );
+		}
+		safe_interned_string = safe_interned_string->next_interned_string;
+	}
+	if( string_table->number_of_interned_strings >= LIBEVTX_STRING_TABLE_MAXIMUM_NUMBER_OF_INTERNED_STRINGS )
+	{
+		return( 0 );
+	}
+	if( libevtx_interned_string_initialize(
+	     &safe_interned_string,
+	     entry_data,
+	     entry_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create interned string.",
+		 function );
+
+		return( -1 );
+	}
+	safe_interned_string->hash                 = hash;
+	safe_interned_string->value_type           = value_type;
+	safe_interned_string->format_flags         = format_flags;
+	safe_interned_string->encoding             = encoding;
+	safe_interned_string->next_interned_string = string_table->buckets[ bucket_index ];
+
+	string_table->buckets[ bucket_index ] = safe_interned_string;
+
+	string_table->number_of_interned_strings += 1;
+
+	*interned_string = safe_interned_string;
+
+	return( 1 );
+}
+
+/* Retrieves the interned UTF-8 string of a value
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if the value has no interned UTF-8 string or -1 on error
+ */
+int libevtx_string_table_get_utf8_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_interned_string_t *interned_string = NULL;
+	static char *function                      = "libevtx_string_table_get_utf8_string_by_value";
+	int result                                 = 0;
+
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value,
+	          &interned_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve interned string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libevtx_interned_string_get_utf8_string(
+		          interned_string,
+		          value,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string of interned string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the interned UTF-16 string of a value
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if the value has no interned UTF-16 string or -1 on error
+ */
+int libevtx_string_table_get_utf16_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libevtx_interned_string_t *interned_string = NULL;
+	static char *function                      = "libevtx_string_table_get_utf16_string_by_value";
+	int result                                 = 0;
+
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value,
+	          &interned_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve interned string.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = libevtx_interned_string_get_utf16_string(
+		          interned_string,
+		          value,
+		          utf16_string,
+		          utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-16 string of interned string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-8 formatted first entry of a value
+ * The string table is optional, values that are not interned are formatted
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_string_table_get_utf8_string_size_from_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *interned_utf8_string = NULL;
+	static char *function               = "libevtx_string_table_get_utf8_string_size_from_value";
+	size_t interned_utf8_string_size    = 0;
+	int result                          = 0;
+
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table != NULL )
+	{
+		result = libevtx_string_table_get_utf8_string_by_value(
+		          string_table,
+		          value,
+		          &interned_utf8_string,
+		          &interned_utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*utf8_string_size = interned_utf8_string_size;
+
+			return( 1 );
+		}
+	}
+	result = libevtx_utf8_string_size_from_value(
+	          value,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the first entry of a value to an UTF-8 string
+ * The string table is optional, values that are not interned are formatted
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_string_table_copy_value_to_utf8_string(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *interned_utf8_string = NULL;
+	static char *function               = "libevtx_string_table_copy_value_to_utf8_string";
+	size_t interned_utf8_string_size    = 0;
+	int result                          = 0;
+
+	if( string_table != NULL )
+	{
+		result = libevtx_string_table_get_utf8_string_by_value(
+		          string_table,
+		          value,
+		          &interned_utf8_string,
+		          &interned_utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( utf8_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			if( utf8_string_size < interned_utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid UTF-8 string size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     utf8_string,
+			     interned_utf8_string,
+			     interned_utf8_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy interned UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	result = libevtx_utf8_string_copy_from_value(
+	          utf8_string,
+	          utf8_string_size,
+	          value,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the first entry of a value to an UTF-8 string and determines its size
+ * The string table is optional, values that are not interned are formatted
+ * The UTF-8 string can be NULL if its size is 0
+ * The required size includes the end of string character. The UTF-8 string
+ * only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_string_table_copy_value_to_utf8_string_with_size(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *interned_utf8_string = NULL;
+	static char *function               = "libevtx_string_table_copy_value_to_utf8_string_with_size";
+	size_t interned_utf8_string_size    = 0;
+	int result                          = 0;
+
+	if( required_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table != NULL )
+	{
+		result = libevtx_string_table_get_utf8_string_by_value(
+		          string_table,
+		          value,
+		          &interned_utf8_string,
+		          &interned_utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( ( utf8_string == NULL )
+			 && ( utf8_string_size != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			if( interned_utf8_string_size <= utf8_string_size )
+			{
+				if( memory_copy(
+				     utf8_string,
+				     interned_utf8_string,
+				     interned_utf8_string_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy interned UTF-8 string.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			*required_utf8_string_size = interned_utf8_string_size;
+
+			return( 1 );
+		}
+	}
+	result = libevtx_utf8_string_copy_from_value_with_size(
+	          utf8_string,
+	          utf8_string_size,
+	          value,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves the size of the UTF-16 formatted first entry of a value
+ * The string table is optional, values that are not interned are formatted
+ * The size includes the end of string character
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_string_table_get_utf16_string_size_from_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	const uint16_t *interned_utf16_string = NULL;
+	static char *function                 = "libevtx_string_table_get_utf16_string_size_from_value";
+	size_t interned_utf16_string_size     = 0;
+	int result                            = 0;
+
+	if( utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_table != NULL )
+	{
+		result = libevtx_string_table_get_utf16_string_by_value(
+		          string_table,
+		          value,
+		          &interned_utf16_string,
+		          &interned_utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			*utf16_string_size = interned_utf16_string_size;
+
+			return( 1 );
+		}
+	}
+	result = libfvalue_value_get_utf16_string_size(
+	          value,
+	          0,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the first entry of a value to an UTF-16 string
+ * The string table is optional, values that are not interned are formatted
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_string_table_copy_value_to_utf16_string(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	const uint16_t *interned_utf16_string = NULL;
+	static char *function                 = "libevtx_string_table_copy_value_to_utf16_string";
+	size_t interned_utf16_string_size     = 0;
+	int result                            = 0;
+
+	if( string_table != NULL )
+	{
+		result = libevtx_string_table_get_utf16_string_by_value(
+		          string_table,
+		          value,
+		          &interned_utf16_string,
+		          &interned_utf16_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( utf16_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+				 "%s: invalid UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			if( utf16_string_size < interned_utf16_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: invalid UTF-16 string size value too small.",
+				 function );
+
+				return( -1 );
+			}
+			if( memory_copy(
+			     utf16_string,
+			     interned_utf16_string,
+			     sizeof( uint16_t ) * interned_utf16_string_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy interned UTF-16 string.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	result = libfvalue_value_copy_to_utf16_string(
+	          value,
+	          0,
+	          utf16_string,
+	          utf16_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,129 @@
+/*
+ * String table functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_STRING_TABLE_H )
+#define _LIBEVTX_STRING_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_interned_string.h"
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of hash buckets of the string table
+ */
+#define LIBEVTX_STRING_TABLE_NUMBER_OF_BUCKETS				1024
+
+/* The maximum number of interned strings, values that are encountered
+ * after the string table is full are formatted on every use
+ */
+#define LIBEVTX_STRING_TABLE_MAXIMUM_NUMBER_OF_INTERNED_STRINGS	16384
+
+/* The maximum size of the value data of an interned string
+ */
+#define LIBEVTX_STRING_TABLE_MAXIMUM_DATA_SIZE				512
+
+typedef struct libevtx_string_table libevtx_string_table_t;
+
+struct libevtx_string_table
+{
+	/* The hash buckets, each bucket contains a list of interned strings
+	 */
+	libevtx_interned_string_t *buckets[ LIBEVTX_STRING_TABLE_NUMBER_OF_BUCKETS ];
+
+	/* The number of interned strings
+	 */
+	int number_of_interned_strings;
+};
+
+int libevtx_string_table_initialize(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libevtx_string_table_free(
+     libevtx_string_table_t **string_table,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_interned_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     libevtx_interned_string_t **interned_string,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf8_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf16_string_by_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     const uint16_t **utf16_string,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf8_string_size_from_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_copy_value_to_utf8_string(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_copy_value_to_utf8_string_with_size(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_get_utf16_string_size_from_value(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+int libevtx_string_table_copy_value_to_utf16_string(
+     libevtx_string_table_t *string_table,
+     libfvalue_value_t *value,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_STRING_TABLE_H ) */
+
@@ -34,12 +34,16 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libevtx_carver {}		libevtx_carver_t;
 typedef struct libevtx_file {}			libevtx_file_t;
+typedef struct libevtx_merge {}			libevtx_merge_t;
 typedef struct libevtx_record {}		libevtx_record_t;
 typedef struct libevtx_template_definition {}	libevtx_template_definition_t;
 
 #else
+typedef intptr_t libevtx_carver_t;
 typedef intptr_t libevtx_file_t;
+typedef intptr_t libevtx_merge_t;
 typedef intptr_t libevtx_record_t;
 typedef intptr_t libevtx_template_definition_t;
 
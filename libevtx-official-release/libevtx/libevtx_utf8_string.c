@@ -0,0 +1,1158 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __SSE2__ ) || defined( _M_X64 ) || defined( _M_AMD64 ) || ( defined( _M_IX86_FP ) && ( _M_IX86_FP >= 2 ) )
+#include <emmintrin.h>
+
+#define LIBEVTX_UTF8_STRING_HAVE_SSE2
+
+#elif defined( __aarch64__ ) && defined( __ARM_NEON ) && !defined( __AARCH64EB__ )
+#include <arm_neon.h>
+
+#define LIBEVTX_UTF8_STRING_HAVE_NEON
+
+#endif
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+#include "libevtx_libuna.h"
+#include "libevtx_utf8_string.h"
+
+/* Determines the size of an UTF-8 string from a little-endian UTF-16 stream
+ * This function has the same behavior as libuna_utf8_string_size_from_utf16_stream
+ * but ASCII and other Basic Multilingual Plane (BMP) characters are converted
+ * inline, where blocks of 8 ASCII characters are handled by a single SIMD comparison
+ * if available. Surrogate pairs are passed to libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libevtx_utf8_string_size_from_utf16_stream";
+	size_t safe_utf8_string_size                 = 0;
+	size_t utf16_stream_index                    = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint16_t utf16_value                         = 0;
+
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+	__m128i ascii_values                         = _mm_setzero_si128();
+	__m128i utf16_values                         = _mm_setzero_si128();
+	__m128i zero_values                          = _mm_setzero_si128();
+	__m128i non_ascii_mask                       = _mm_set1_epi16( (short) 0xff80 );
+
+#elif defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+	uint16x8_t utf16_values;
+#endif
+
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size % 2 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream value.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	*utf8_string_size = 0;
+
+	if( utf16_stream_size == 0 )
+	{
+		return( 1 );
+	}
+	/* Skip the byte order mark, the stream is always read as little-endian
+	 */
+	if( ( ( utf16_stream[ 0 ] == 0xfe )
+	  &&  ( utf16_stream[ 1 ] == 0xff ) )
+	 || ( ( utf16_stream[ 0 ] == 0xff )
+	  &&  ( utf16_stream[ 1 ] == 0xfe ) ) )
+	{
+		utf16_stream_index = 2;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+		if( ( utf16_stream_index + 16 ) <= utf16_stream_size )
+		{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+			utf16_values = _mm_loadu_si128(
+			                (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			ascii_values = _mm_andnot_si128(
+			                _mm_cmpeq_epi16(
+			                 utf16_values,
+			                 zero_values ),
+			                _mm_cmpeq_epi16(
+			                 _mm_and_si128(
+			                  utf16_values,
+			                  non_ascii_mask ),
+			                 zero_values ) );
+
+			if( _mm_movemask_epi8(
+			     ascii_values ) == 0xffff )
+#else
+			utf16_values = vreinterpretq_u16_u8(
+			                vld1q_u8(
+			                 &( utf16_stream[ utf16_stream_index ] ) ) );
+
+			if( ( vmaxvq_u16(
+			       utf16_values ) < 0x0080 )
+			 && ( vminvq_u16(
+			       utf16_values ) != 0 ) )
+#endif
+			{
+				/* The block contains 8 ASCII characters and no end-of-string character
+				 */
+				safe_utf8_string_size += 8;
+				utf16_stream_index    += 16;
+
+				unicode_character = utf16_stream[ utf16_stream_index - 2 ];
+
+				continue;
+			}
+		}
+#endif /* defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON ) */
+
+		utf16_value = ( (uint16_t) utf16_stream[ utf16_stream_index + 1 ] << 8 )
+		            | utf16_stream[ utf16_stream_index ];
+
+		if( ( utf16_value >= 0xd800 )
+		 && ( utf16_value <= 0xdfff ) )
+		{
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &unicode_character,
+			     utf16_stream,
+			     utf16_stream_size,
+			     &utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16 stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( libuna_unicode_character_size_to_utf8(
+			     unicode_character,
+			     &safe_utf8_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		unicode_character   = utf16_value;
+		utf16_stream_index += 2;
+
+		if( utf16_value < 0x0080 )
+		{
+			safe_utf8_string_size += 1;
+
+			if( utf16_value == 0 )
+			{
+				break;
+			}
+		}
+		else if( utf16_value < 0x0800 )
+		{
+			safe_utf8_string_size += 2;
+		}
+		else
+		{
+			safe_utf8_string_size += 3;
+		}
+	}
+	/* Check if the string is terminated with an end-of-string character
+	 */
+	if( unicode_character != 0 )
+	{
+		safe_utf8_string_size += 1;
+	}
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a little-endian UTF-16 stream
+ * This function has the same behavior as libuna_utf8_string_copy_from_utf16_stream
+ * but ASCII and other Basic Multilingual Plane (BMP) characters are converted
+ * inline, where blocks of 8 ASCII characters are converted by a single SIMD pack
+ * if available. Surrogate pairs are passed to libuna
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libevtx_utf8_string_copy_from_utf16_stream";
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint16_t utf16_value                         = 0;
+
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+	__m128i ascii_values                         = _mm_setzero_si128();
+	__m128i utf16_values                         = _mm_setzero_si128();
+	__m128i zero_values                          = _mm_setzero_si128();
+	__m128i non_ascii_mask                       = _mm_set1_epi16( (short) 0xff80 );
+
+#elif defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+	uint16x8_t utf16_values;
+#endif
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream value.",
+		 function );
+
+		return( -1 );
+	}
+	/* Skip the byte order mark, the stream is always read as little-endian
+	 */
+	if( ( ( utf16_stream[ 0 ] == 0xfe )
+	  &&  ( utf16_stream[ 1 ] == 0xff ) )
+	 || ( ( utf16_stream[ 0 ] == 0xff )
+	  &&  ( utf16_stream[ 1 ] == 0xfe ) ) )
+	{
+		utf16_stream_index = 2;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+		if( ( ( utf16_stream_index + 16 ) <= utf16_stream_size )
+		 && ( ( utf8_string_index + 8 ) <= utf8_string_size ) )
+		{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+			utf16_values = _mm_loadu_si128(
+			                (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			ascii_values = _mm_andnot_si128(
+			                _mm_cmpeq_epi16(
+			                 utf16_values,
+			                 zero_values ),
+			                _mm_cmpeq_epi16(
+			                 _mm_and_si128(
+			                  utf16_values,
+			                  non_ascii_mask ),
+			                 zero_values ) );
+
+			if( _mm_movemask_epi8(
+			     ascii_values ) == 0xffff )
+#else
+			utf16_values = vreinterpretq_u16_u8(
+			                vld1q_u8(
+			                 &( utf16_stream[ utf16_stream_index ] ) ) );
+
+			if( ( vmaxvq_u16(
+			       utf16_values ) < 0x0080 )
+			 && ( vminvq_u16(
+			       utf16_values ) != 0 ) )
+#endif
+			{
+				/* The block contains 8 ASCII characters and no end-of-string character
+				 */
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+				_mm_storel_epi64(
+				 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+				 _mm_packus_epi16(
+				  utf16_values,
+				  utf16_values ) );
+#else
+				vst1_u8(
+				 &( utf8_string[ utf8_string_index ] ),
+				 vmovn_u16(
+				  utf16_values ) );
+#endif
+				utf8_string_index  += 8;
+				utf16_stream_index += 16;
+
+				unicode_character = utf16_stream[ utf16_stream_index - 2 ];
+
+				continue;
+			}
+		}
+#endif /* defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON ) */
+
+		utf16_value = ( (uint16_t) utf16_stream[ utf16_stream_index + 1 ] << 8 )
+		            | utf16_stream[ utf16_stream_index ];
+
+		if( ( utf16_value >= 0xd800 )
+		 && ( utf16_value <= 0xdfff ) )
+		{
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &unicode_character,
+			     utf16_stream,
+			     utf16_stream_size,
+			     &utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16 stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( libuna_unicode_character_copy_to_utf8(
+			     unicode_character,
+			     utf8_string,
+			     utf8_string_size,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( ( utf16_value >= 0x0800 )
+		 && ( utf8_string_size >= 2 )
+		 && ( utf8_string_index < ( utf8_string_size - 2 ) ) )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xe0 | ( utf16_value >> 12 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( ( utf16_value >> 6 ) & 0x3f ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_value & 0x3f ) );
+		}
+		else if( ( utf16_value >= 0x0080 )
+		      && ( utf16_value < 0x0800 )
+		      && ( utf8_string_size >= 1 )
+		      && ( utf8_string_index < ( utf8_string_size - 1 ) ) )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0xc0 | ( utf16_value >> 6 ) );
+			utf8_string[ utf8_string_index++ ] = (uint8_t) ( 0x80 | ( utf16_value & 0x3f ) );
+		}
+		else if( ( utf16_value < 0x0080 )
+		      && ( utf8_string_index < utf8_string_size ) )
+		{
+			utf8_string[ utf8_string_index++ ] = (uint8_t) utf16_value;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		unicode_character   = utf16_value;
+		utf16_stream_index += 2;
+
+		if( utf16_value == 0 )
+		{
+			break;
+		}
+	}
+	/* Check if the string is terminated with an end-of-string character
+	 */
+	if( unicode_character != 0 )
+	{
+		if( utf8_string_index >= utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ utf8_string_index ] = 0;
+	}
+	return( 1 );
+}
+
+/* Copies an UTF-8 string from a little-endian UTF-16 stream and determines its size
+ * in a single pass. The UTF-16 stream is converted in the same way as
+ * libevtx_utf8_string_copy_from_utf16_stream but conversion continues when the
+ * UTF-8 string is too small, so that the required size can be determined.
+ * The UTF-8 string can be NULL if its size is 0
+ * The required size includes the end of string character. The UTF-8 string
+ * only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful or -1 on error
+ */
+int libevtx_utf8_string_copy_from_utf16_stream_with_size(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libevtx_utf8_string_copy_from_utf16_stream_with_size";
+	size_t character_size                        = 0;
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	libuna_unicode_character_t unicode_character = 0;
+	uint16_t utf16_value                         = 0;
+
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+	__m128i ascii_values                         = _mm_setzero_si128();
+	__m128i utf16_values                         = _mm_setzero_si128();
+	__m128i zero_values                          = _mm_setzero_si128();
+	__m128i non_ascii_mask                       = _mm_set1_epi16( (short) 0xff80 );
+
+#elif defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+	uint16x8_t utf16_values;
+#endif
+
+	if( ( utf8_string == NULL )
+	 && ( utf8_string_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf16_stream_size == 0 )
+	 || ( ( utf16_stream_size % 2 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: missing UTF-16 stream value.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Skip the byte order mark, the stream is always read as little-endian
+	 */
+	if( ( ( utf16_stream[ 0 ] == 0xfe )
+	  &&  ( utf16_stream[ 1 ] == 0xff ) )
+	 || ( ( utf16_stream[ 0 ] == 0xff )
+	  &&  ( utf16_stream[ 1 ] == 0xfe ) ) )
+	{
+		utf16_stream_index = 2;
+	}
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON )
+		if( ( utf16_stream_index + 16 ) <= utf16_stream_size )
+		{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+			utf16_values = _mm_loadu_si128(
+			                (const __m128i *) &( utf16_stream[ utf16_stream_index ] ) );
+
+			ascii_values = _mm_andnot_si128(
+			                _mm_cmpeq_epi16(
+			                 utf16_values,
+			                 zero_values ),
+			                _mm_cmpeq_epi16(
+			                 _mm_and_si128(
+			                  utf16_values,
+			                  non_ascii_mask ),
+			                 zero_values ) );
+
+			if( _mm_movemask_epi8(
+			     ascii_values ) == 0xffff )
+#else
+			utf16_values = vreinterpretq_u16_u8(
+			                vld1q_u8(
+			                 &( utf16_stream[ utf16_stream_index ] ) ) );
+
+			if( ( vmaxvq_u16(
+			       utf16_values ) < 0x0080 )
+			 && ( vminvq_u16(
+			       utf16_values ) != 0 ) )
+#endif
+			{
+				/* The block contains 8 ASCII characters and no end-of-string character
+				 */
+				if( ( utf8_string_index + 8 ) <= utf8_string_size )
+				{
+#if defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 )
+					_mm_storel_epi64(
+					 (__m128i *) &( utf8_string[ utf8_string_index ] ),
+					 _mm_packus_epi16(
+					  utf16_values,
+					  utf16_values ) );
+#else
+					vst1_u8(
+					 &( utf8_string[ utf8_string_index ] ),
+					 vmovn_u16(
+					  utf16_values ) );
+#endif
+				}
+				utf8_string_index  += 8;
+				utf16_stream_index += 16;
+
+				unicode_character = utf16_stream[ utf16_stream_index - 2 ];
+
+				continue;
+			}
+		}
+#endif /* defined( LIBEVTX_UTF8_STRING_HAVE_SSE2 ) || defined( LIBEVTX_UTF8_STRING_HAVE_NEON ) */
+
+		utf16_value = ( (uint16_t) utf16_stream[ utf16_stream_index + 1 ] << 8 )
+		            | utf16_stream[ utf16_stream_index ];
+
+		if( ( utf16_value >= 0xd800 )
+		 && ( utf16_value <= 0xdfff ) )
+		{
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &unicode_character,
+			     utf16_stream,
+			     utf16_stream_size,
+			     &utf16_stream_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy Unicode character from UTF-16 stream.",
+				 function );
+
+				return( -1 );
+			}
+			character_size = 0;
+
+			if( libuna_unicode_character_size_to_utf8(
+			     unicode_character,
+			     &character_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to unable to determine size of Unicode character in UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( utf8_string_index + character_size ) > utf8_string_size )
+			{
+				utf8_string_index += character_size;
+			}
+			else if( libuna_unicode_character_copy_to_utf8(
+			          unicode_character,
+			          utf8_string,
+			          utf8_string_size,
+			          &utf8_string_index,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			continue;
+		}
+		if( utf16_value < 0x0080 )
+		{
+			if( utf8_string_index < utf8_string_size )
+			{
+				utf8_string[ utf8_string_index ] = (uint8_t) utf16_value;
+			}
+			utf8_string_index += 1;
+		}
+		else if( utf16_value < 0x0800 )
+		{
+			if( ( utf8_string_index + 2 ) <= utf8_string_size )
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xc0 | ( utf16_value >> 6 ) );
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( utf16_value & 0x3f ) );
+			}
+			utf8_string_index += 2;
+		}
+		else
+		{
+			if( ( utf8_string_index + 3 ) <= utf8_string_size )
+			{
+				utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xe0 | ( utf16_value >> 12 ) );
+				utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( utf16_value >> 6 ) & 0x3f ) );
+				utf8_string[ utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( utf16_value & 0x3f ) );
+			}
+			utf8_string_index += 3;
+		}
+		unicode_character   = utf16_value;
+		utf16_stream_index += 2;
+
+		if( utf16_value == 0 )
+		{
+			break;
+		}
+	}
+	/* Check if the string is terminated with an end-of-string character
+	 */
+	if( unicode_character != 0 )
+	{
+		if( utf8_string_index < utf8_string_size )
+		{
+			utf8_string[ utf8_string_index ] = 0;
+		}
+		utf8_string_index += 1;
+	}
+	*required_utf8_string_size = utf8_string_index;
+
+	return( 1 );
+}
+
+/* Determines the size of an UTF-8 string of the first entry of a value
+ * This function has the same behavior as libfvalue_value_get_utf8_string_size
+ * but little-endian UTF-16 string values are converted without creating
+ * a value instance
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_utf8_string_size_from_value(
+     libfvalue_value_t *value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data    = NULL;
+	static char *function  = "libevtx_utf8_string_size_from_value";
+	size_t entry_data_size = 0;
+	uint32_t format_flags  = 0;
+	int encoding           = 0;
+	int result             = 0;
+	int value_type         = 0;
+
+	if( libfvalue_value_get_type(
+	     value,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	{
+		if( libfvalue_value_get_format_flags(
+		     value,
+		     &format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value format flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( format_flags == 0 )
+		{
+			result = libfvalue_value_get_entry_data(
+			          value,
+			          0,
+			          &entry_data,
+			          &entry_data_size,
+			          &encoding,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result != 0 )
+	 && ( encoding == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN ) )
+	{
+		if( libevtx_utf8_string_size_from_utf16_stream(
+		     entry_data,
+		     entry_data_size,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libfvalue_value_get_utf8_string_size(
+	          value,
+	          0,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the first entry of a value to an UTF-8 string
+ * This function has the same behavior as libfvalue_value_copy_to_utf8_string
+ * but little-endian UTF-16 string values are converted without creating
+ * a value instance
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_utf8_string_copy_from_value(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libfvalue_value_t *value,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data    = NULL;
+	static char *function  = "libevtx_utf8_string_copy_from_value";
+	size_t entry_data_size = 0;
+	uint32_t format_flags  = 0;
+	int encoding           = 0;
+	int result             = 0;
+	int value_type         = 0;
+
+	if( libfvalue_value_get_type(
+	     value,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	{
+		if( libfvalue_value_get_format_flags(
+		     value,
+		     &format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value format flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( format_flags == 0 )
+		{
+			result = libfvalue_value_get_entry_data(
+			          value,
+			          0,
+			          &entry_data,
+			          &entry_data_size,
+			          &encoding,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result != 0 )
+	 && ( encoding == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN ) )
+	{
+		if( libevtx_utf8_string_copy_from_utf16_stream(
+		     utf8_string,
+		     utf8_string_size,
+		     entry_data,
+		     entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libfvalue_value_copy_to_utf8_string(
+	          value,
+	          0,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Copies the first entry of a value to an UTF-8 string and determines its size
+ * Little-endian UTF-16 string values are converted in a single pass, other values
+ * are only copied by libfvalue if the UTF-8 string is sufficiently large
+ * The UTF-8 string can be NULL if its size is 0
+ * The required size includes the end of string character. The UTF-8 string
+ * only contains the complete string if the required size does not exceed its size
+ * Returns 1 if successful, 0 if value not available or -1 on error
+ */
+int libevtx_utf8_string_copy_from_value_with_size(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libfvalue_value_t *value,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t *entry_data    = NULL;
+	static char *function  = "libevtx_utf8_string_copy_from_value_with_size";
+	size_t entry_data_size = 0;
+	uint32_t format_flags  = 0;
+	int encoding           = 0;
+	int result             = 0;
+	int value_type         = 0;
+
+	if( required_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_type(
+	     value,
+	     &value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == LIBFVALUE_VALUE_TYPE_STRING_UTF16 )
+	{
+		if( libfvalue_value_get_format_flags(
+		     value,
+		     &format_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value format flags.",
+			 function );
+
+			return( -1 );
+		}
+		if( format_flags == 0 )
+		{
+			result = libfvalue_value_get_entry_data(
+			          value,
+			          0,
+			          &entry_data,
+			          &entry_data_size,
+			          &encoding,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value entry data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( ( result != 0 )
+	 && ( encoding == LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN )
+	 && ( entry_data_size > 0 ) )
+	{
+		if( libevtx_utf8_string_copy_from_utf16_stream_with_size(
+		     utf8_string,
+		     utf8_string_size,
+		     entry_data,
+		     entry_data_size,
+		     required_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	result = libfvalue_value_get_utf8_string_size(
+	          value,
+	          0,
+	          required_utf8_string_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( ( result != 0 )
+	      && ( *required_utf8_string_size > 0 )
+	      && ( *required_utf8_string_size <= utf8_string_size ) )
+	{
+		result = libfvalue_value_copy_to_utf8_string(
+		          value,
+		          0,
+		          utf8_string,
+		          utf8_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
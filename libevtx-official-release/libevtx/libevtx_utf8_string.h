@@ -0,0 +1,79 @@
+/*
+ * UTF-8 string functions
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVTX_UTF8_STRING_H )
+#define _LIBEVTX_UTF8_STRING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevtx_libcerror.h"
+#include "libevtx_libfvalue.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+int libevtx_utf8_string_size_from_utf16_stream(
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_utf8_string_copy_from_utf16_stream(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libevtx_utf8_string_copy_from_utf16_stream_with_size(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_utf8_string_size_from_value(
+     libfvalue_value_t *value,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int libevtx_utf8_string_copy_from_value(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libfvalue_value_t *value,
+     libcerror_error_t **error );
+
+int libevtx_utf8_string_copy_from_value_with_size(
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libfvalue_value_t *value,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVTX_UTF8_STRING_H ) */
+
@@ -0,0 +1,740 @@
+/*
+ * Library chunk_read_ahead type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_chunk_read_ahead.h"
+
+uint8_t evtx_test_chunk_read_ahead_data[ 4096 ];
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Tests the libevtx_chunk_read_ahead_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_read_ahead_initialize(
+     void )
+{
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_read_ahead_t *chunk_read_ahead = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 4;
+	int number_of_memset_fail_tests              = 2;
+	int test_number                              = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_read_ahead_data,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          512,
+	          2,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_read_ahead",
+	 chunk_read_ahead );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_read_ahead_free(
+	          &chunk_read_ahead,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_read_ahead",
+	 chunk_read_ahead );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_read_ahead_initialize(
+	          NULL,
+	          file_io_handle,
+	          512,
+	          2,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	chunk_read_ahead = (libevtx_chunk_read_ahead_t *) 0x12345678UL;
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          512,
+	          2,
+	          0,
+	          &error );
+
+	chunk_read_ahead = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          NULL,
+	          512,
+	          2,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          0,
+	          2,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          512,
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          512,
+	          LIBEVTX_CHUNK_READ_AHEAD_MAXIMUM_DEPTH + 1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_read_ahead_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_read_ahead_initialize(
+		          &chunk_read_ahead,
+		          file_io_handle,
+		          512,
+		          2,
+		          0,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( chunk_read_ahead != NULL )
+			{
+				libevtx_chunk_read_ahead_free(
+				 &chunk_read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_read_ahead",
+			 chunk_read_ahead );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_chunk_read_ahead_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_chunk_read_ahead_initialize(
+		          &chunk_read_ahead,
+		          file_io_handle,
+		          512,
+		          2,
+		          0,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( chunk_read_ahead != NULL )
+			{
+				libevtx_chunk_read_ahead_free(
+				 &chunk_read_ahead,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "chunk_read_ahead",
+			 chunk_read_ahead );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_read_ahead != NULL )
+	{
+		libevtx_chunk_read_ahead_free(
+		 &chunk_read_ahead,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_read_ahead_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_read_ahead_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_read_ahead_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_read_ahead_get_chunk_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_read_ahead_get_chunk_data(
+     void )
+{
+	uint8_t chunk_data[ 512 ];
+
+	libbfio_handle_t *file_io_handle             = NULL;
+	libcerror_error_t *error                     = NULL;
+	libevtx_chunk_read_ahead_t *chunk_read_ahead = NULL;
+	off64_t file_offset                          = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_chunk_read_ahead_data,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_read_ahead_initialize(
+	          &chunk_read_ahead,
+	          file_io_handle,
+	          512,
+	          2,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "chunk_read_ahead",
+	 chunk_read_ahead );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          chunk_read_ahead,
+	          0,
+	          chunk_data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The chunks that follow the first chunk are read ahead
+	 */
+	for( file_offset = 512;
+	     file_offset < 4096;
+	     file_offset += 512 )
+	{
+		result = libevtx_chunk_read_ahead_get_chunk_data(
+		          chunk_read_ahead,
+		          file_offset,
+		          chunk_data,
+		          512,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "chunk_data[ 0 ]",
+		 chunk_data[ 0 ],
+		 (uint8_t) ( file_offset / 512 ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "chunk_data[ 511 ]",
+		 chunk_data[ 511 ],
+		 (uint8_t) ( file_offset / 512 ) );
+	}
+	/* A chunk that is not read in sequence is not available
+	 */
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          chunk_read_ahead,
+	          1024,
+	          chunk_data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_read_ahead->number_of_hits",
+	 chunk_read_ahead->number_of_hits,
+	 (uint64_t) 7 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "chunk_read_ahead->number_of_misses",
+	 chunk_read_ahead->number_of_misses,
+	 (uint64_t) 2 );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          NULL,
+	          0,
+	          chunk_data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          chunk_read_ahead,
+	          -1,
+	          chunk_data,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          chunk_read_ahead,
+	          0,
+	          NULL,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_read_ahead_get_chunk_data(
+	          chunk_read_ahead,
+	          0,
+	          chunk_data,
+	          256,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_chunk_read_ahead_free(
+	          &chunk_read_ahead,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunk_read_ahead",
+	 chunk_read_ahead );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( chunk_read_ahead != NULL )
+	{
+		libevtx_chunk_read_ahead_free(
+		 &chunk_read_ahead,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	int data_offset = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	/* Each chunk of the test data is filled with its chunk number
+	 */
+	for( data_offset = 0;
+	     data_offset < 4096;
+	     data_offset++ )
+	{
+		evtx_test_chunk_read_ahead_data[ data_offset ] = (uint8_t) ( data_offset / 512 );
+	}
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_read_ahead_initialize",
+	 evtx_test_chunk_read_ahead_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_read_ahead_free",
+	 evtx_test_chunk_read_ahead_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_read_ahead_get_chunk_data",
+	 evtx_test_chunk_read_ahead_get_chunk_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+}
+
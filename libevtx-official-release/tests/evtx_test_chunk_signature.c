@@ -0,0 +1,501 @@
+/*
+ * Library chunk signature functions test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_checksum.h"
+#include "../libevtx/libevtx_chunk_signature.h"
+
+uint8_t evtx_test_chunk_signature_data[ 4096 ];
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Sets up the test data
+ * A chunk signature is stored at offset 1000 and 3071, where only the chunk
+ * header at offset 1000 is valid, and a signature without its end-of-string
+ * character is stored at offset 500
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_signature_set_up_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t checksum        = 0;
+	int result               = 0;
+
+	if( memory_set(
+	     evtx_test_chunk_signature_data,
+	     0,
+	     4096 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( evtx_test_chunk_signature_data[ 500 ] ),
+	     "ElfChnkX",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( evtx_test_chunk_signature_data[ 1000 ] ),
+	     "ElfChnk",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( evtx_test_chunk_signature_data[ 1000 + 40 ] ),
+	 128 );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &checksum,
+	          &( evtx_test_chunk_signature_data[ 1000 ] ),
+	          120,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_checksum_calculate_little_endian_crc32(
+	          &checksum,
+	          &( evtx_test_chunk_signature_data[ 1000 + 128 ] ),
+	          384,
+	          checksum,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( evtx_test_chunk_signature_data[ 1000 + 124 ] ),
+	 checksum );
+
+	if( memory_copy(
+	     &( evtx_test_chunk_signature_data[ 3071 ] ),
+	     "ElfChnk",
+	     8 ) == NULL )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_signature_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_signature_scan(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t signature_offset  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_chunk_signature_set_up_data();
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 1000 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          1001,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 3071 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          3072,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signature that ends at the end of the data
+	 */
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          3079,
+	          1001,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 3071 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          3078,
+	          1001,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_signature_scan(
+	          NULL,
+	          4096,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_signature_scan(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_chunk_signature_check_header function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunk_signature_check_header(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_chunk_signature_set_up_data();
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunk_signature_check_header(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          1000,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signature without a valid chunk header
+	 */
+	result = libevtx_chunk_signature_check_header(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          500,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk header that exceeds the data
+	 */
+	result = libevtx_chunk_signature_check_header(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          3071,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a chunk header with an invalid checksum
+	 */
+	evtx_test_chunk_signature_data[ 1000 + 200 ] = 0xff;
+
+	result = libevtx_chunk_signature_check_header(
+	          evtx_test_chunk_signature_data,
+	          4096,
+	          1000,
+	          &error );
+
+	evtx_test_chunk_signature_data[ 1000 + 200 ] = 0;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunk_signature_check_header(
+	          NULL,
+	          4096,
+	          1000,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunk_signature_check_header(
+	          evtx_test_chunk_signature_data,
+	          (size_t) SSIZE_MAX + 1,
+	          1000,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_signature_scan",
+	 evtx_test_chunk_signature_scan );
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunk_signature_check_header",
+	 evtx_test_chunk_signature_check_header );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
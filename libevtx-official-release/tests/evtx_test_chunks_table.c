@@ -34,6 +34,8 @@
 #include "evtx_test_unused.h"
 
 #include "../libevtx/libevtx_chunks_table.h"
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_record_values.h"
 
 #if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
 
@@ -75,6 +77,289 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_chunks_table_get_decoded_record_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_chunks_table_get_decoded_record_values(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libevtx_chunks_table_t *chunks_table    = NULL;
+	libevtx_io_handle_t *io_handle          = NULL;
+	libevtx_record_values_t *record_values  = NULL;
+	libevtx_record_values_t *decoded_values = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunks_table_initialize(
+	          &chunks_table,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_initialize(
+	          &decoded_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          chunks_table,
+	          0x1200,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	chunks_table->decoded_records_values[ 0 ] = decoded_values;
+	chunks_table->decoded_record_offsets[ 0 ] = 0x1200;
+	chunks_table->number_of_decoded_records   = 1;
+
+	decoded_values = NULL;
+
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          chunks_table,
+	          0x1280,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          chunks_table,
+	          0x1200,
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record values are removed from the decoded records
+	 */
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "chunks_table->decoded_records_values[ 0 ]",
+	 chunks_table->decoded_records_values[ 0 ] );
+
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          chunks_table,
+	          0x1200,
+	          &decoded_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunks_table_free_decoded_records(
+	          chunks_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "chunks_table->number_of_decoded_records",
+	 chunks_table->number_of_decoded_records,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          NULL,
+	          0x1200,
+	          &decoded_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunks_table_get_decoded_record_values(
+	          chunks_table,
+	          0x1200,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_chunks_table_free_decoded_records(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_chunks_table_free(
+	          &chunks_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decoded_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &decoded_values,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( chunks_table != NULL )
+	{
+		libevtx_chunks_table_free(
+		 &chunks_table,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
 /* The main program
@@ -100,7 +385,11 @@ int main(
 	 "libevtx_chunks_table_free",
 	 evtx_test_chunks_table_free );
 
-	/* TODO: add tests for libevtx_chunks_table_read_record */
+	/* TODO: add tests for libevtx_chunks_table_get_record_values */
+
+	EVTX_TEST_RUN(
+	 "libevtx_chunks_table_get_decoded_record_values",
+	 evtx_test_chunks_table_get_decoded_record_values );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
 
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -1181,19 +1182,2194 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevtx_file_refresh function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_refresh(
+     const system_character_t *source )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libbfio_handle_t *memory_io_handle = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_file_t *file               = NULL;
+	libevtx_record_t *record           = NULL;
+	uint8_t *data                      = NULL;
+	size64_t data_size                 = 0;
+	size_t initial_data_size           = 0;
+	size_t string_length               = 0;
+	ssize_t read_count                 = 0;
+	int expected_number_of_records     = 0;
+	int number_of_records              = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libbfio_file_initialize(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	string_length = system_string_length(
+	                 source );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libbfio_file_set_name_wide(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#else
+	result = libbfio_file_set_name(
+	          file_io_handle,
+	          source,
+	          string_length,
+	          &error );
+#endif
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_get_size(
+	          file_io_handle,
+	          &data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The test requires at least the file header and 2 chunks
+	 */
+	if( ( data_size < ( 4096 + ( 2 * 65536 ) ) )
+	 || ( data_size > (size64_t) SSIZE_MAX ) )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+
+		return( 1 );
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * (size_t) data_size );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              (size_t) data_size,
+	              0,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) data_size );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Determine the number of records in the complete file
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &memory_io_handle,
+	          data,
+	          (size_t) data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_initialize(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          memory_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &expected_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &memory_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Open the file with only the first chunk written
+	 */
+	initial_data_size = 4096 + 65536;
+
+	result = evtx_test_open_file_io_handle(
+	          &memory_io_handle,
+	          data,
+	          initial_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_open_file_io_handle(
+	          file,
+	          memory_io_handle,
+	          LIBEVTX_OPEN_READ,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_LESS_THAN_INT(
+	 "number_of_records",
+	 number_of_records,
+	 expected_number_of_records );
+
+	/* Test refresh after the rest of the file was written
+	 */
+	result = libbfio_memory_range_set(
+	          memory_io_handle,
+	          data,
+	          (size_t) data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 expected_number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_refresh(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test refresh after the file was truncated
+	 */
+	result = libbfio_memory_range_set(
+	          memory_io_handle,
+	          data,
+	          initial_data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test refresh after the file header was corrupted
+	 */
+	result = libbfio_memory_range_set(
+	          memory_io_handle,
+	          data,
+	          (size_t) data_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 0 ] ^= 0xff;
+
+	result = libevtx_file_refresh(
+	          file,
+	          &error );
+
+	data[ 0 ] ^= 0xff;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Make sure a failed refresh leaves the records unchanged
+	 */
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 expected_number_of_records );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records > 0 )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          number_of_records - 1,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_file_close(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_free(
+	          &file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &memory_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	if( memory_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &memory_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
 /* Tests the libevtx_file_signal_abort function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_signal_abort(
+int evtx_test_file_signal_abort(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_signal_abort(
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_signal_abort(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_ascii_codepage(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int ascii_codepage       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_ascii_codepage(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_ascii_codepage(
+     libevtx_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBEVTX_CODEPAGE_ASCII,
+		LIBEVTX_CODEPAGE_WINDOWS_874,
+		LIBEVTX_CODEPAGE_WINDOWS_932,
+		LIBEVTX_CODEPAGE_WINDOWS_936,
+		LIBEVTX_CODEPAGE_WINDOWS_949,
+		LIBEVTX_CODEPAGE_WINDOWS_950,
+		LIBEVTX_CODEPAGE_WINDOWS_1250,
+		LIBEVTX_CODEPAGE_WINDOWS_1251,
+		LIBEVTX_CODEPAGE_WINDOWS_1252,
+		LIBEVTX_CODEPAGE_WINDOWS_1253,
+		LIBEVTX_CODEPAGE_WINDOWS_1254,
+		LIBEVTX_CODEPAGE_WINDOWS_1255,
+		LIBEVTX_CODEPAGE_WINDOWS_1256,
+		LIBEVTX_CODEPAGE_WINDOWS_1257,
+		LIBEVTX_CODEPAGE_WINDOWS_1258 };
+
+	int unsupported_codepages[ 17 ] = {
+		LIBEVTX_CODEPAGE_ISO_8859_1,
+		LIBEVTX_CODEPAGE_ISO_8859_2,
+		LIBEVTX_CODEPAGE_ISO_8859_3,
+		LIBEVTX_CODEPAGE_ISO_8859_4,
+		LIBEVTX_CODEPAGE_ISO_8859_5,
+		LIBEVTX_CODEPAGE_ISO_8859_6,
+		LIBEVTX_CODEPAGE_ISO_8859_7,
+		LIBEVTX_CODEPAGE_ISO_8859_8,
+		LIBEVTX_CODEPAGE_ISO_8859_9,
+		LIBEVTX_CODEPAGE_ISO_8859_10,
+		LIBEVTX_CODEPAGE_ISO_8859_11,
+		LIBEVTX_CODEPAGE_ISO_8859_13,
+		LIBEVTX_CODEPAGE_ISO_8859_14,
+		LIBEVTX_CODEPAGE_ISO_8859_15,
+		LIBEVTX_CODEPAGE_ISO_8859_16,
+		LIBEVTX_CODEPAGE_KOI8_R,
+		LIBEVTX_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libevtx_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_file_set_ascii_codepage(
+	          NULL,
+	          LIBEVTX_CODEPAGE_ASCII,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libevtx_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevtx_file_set_ascii_codepage(
+	          file,
+	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_cache_sizes function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_cache_sizes(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          32,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          4,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_cache_sizes(
+	          NULL,
+	          16,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          0,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          16,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          16,
+	          LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_file_set_cache_sizes(
+	          file,
+	          16,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_cache_statistics(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	size64_t resident_size       = 0;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_hits      = 0;
+	uint64_t number_of_misses    = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_CHUNKS,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_cache_statistics(
+	          NULL,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          0,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_evictions,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &resident_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_cache_statistics(
+	          file,
+	          LIBEVTX_CACHE_TYPE_RECORDS,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_read_ahead_depth function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_read_ahead_depth(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = NULL;
+	int result               = 0;
+
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	int number_of_records    = 0;
+	int record_index         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	result = libevtx_file_set_read_ahead_depth(
+	          file,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libevtx_file_set_read_ahead_depth(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_read_ahead_depth(
+	          NULL,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_read_ahead_depth(
+	          file,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_read_ahead_depth(
+	          file,
+	          65,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_read_buffer_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_read_buffer_size(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = NULL;
+	int number_of_records    = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_set_read_buffer_size(
+	          file,
+	          64 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_file_set_read_buffer_size(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_read_buffer_size(
+	          NULL,
+	          64 * 1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_read_buffer_size(
+	          file,
+	          (size_t) ( 64 * 1024 * 1024 ) + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_set_number_of_decode_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_set_number_of_decode_threads(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error          = NULL;
+	libevtx_record_t *record          = NULL;
+	libevtx_record_t *reused_record   = NULL;
+	int result                        = 0;
+
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	uint64_t identifier               = 0;
+	uint64_t reused_record_identifier = 0;
+	int number_of_records             = 0;
+	int record_index                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+#if defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT )
+	result = libevtx_file_set_number_of_decode_threads(
+	          file,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The records that are decoded in parallel match the records that are read on demand
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index_into(
+		          file,
+		          record_index,
+		          &reused_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "reused_record",
+		 reused_record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          reused_record,
+		          &reused_record_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "reused_record_identifier",
+		 reused_record_identifier,
+		 identifier );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	if( reused_record != NULL )
+	{
+		result = libevtx_record_free(
+		          &reused_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* defined( LIBEVTX_HAVE_MULTI_THREAD_SUPPORT ) */
+
+	result = libevtx_file_set_number_of_decode_threads(
+	          file,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_set_number_of_decode_threads(
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_number_of_decode_threads(
+	          file,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_set_number_of_decode_threads(
+	          file,
+	          65,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( reused_record != NULL )
+	{
+		libevtx_record_free(
+		 &reused_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_flags(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t flags           = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_flags(
+	          file,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_flags(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_number_of_records(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_record_by_index(
      libevtx_file_t *file )
 {
 	libcerror_error_t *error = NULL;
+	libevtx_record_t *record = 0;
+	int number_of_records    = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	/* TODO: remove after troubleshooting failing tests */
+	EVTX_TEST_FPRINT_ERROR( error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevtx_record_free(
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_file_get_record_by_index(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          -1,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_file_get_record_by_index_into function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_file_get_record_by_index_into(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error        = NULL;
+	libevtx_record_t *record        = NULL;
+	libevtx_record_t *reused_record = NULL;
+	uint64_t expected_identifier    = 0;
+	uint64_t identifier             = 0;
+	int number_of_records           = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
 	/* Test regular cases
 	 */
-	result = libevtx_file_signal_abort(
+	for( record_index = 0;
+	     ( record_index < number_of_records ) && ( record_index < 4 );
+	     record_index++ )
+	{
+		result = libevtx_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_get_identifier(
+		          record,
+		          &expected_identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_record_free(
+		          &record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The first call creates the record and the following calls reuse it
+		 */
+		record = reused_record;
+
+		result = libevtx_file_get_record_by_index_into(
+		          file,
+		          record_index,
+		          &reused_record,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "reused_record",
+		 reused_record );
+
+		if( record != NULL )
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "reused_record == record",
+			 (int) ( reused_record == record ),
+			 1 );
+		}
+		record = NULL;
+
+		result = libevtx_record_get_identifier(
+		          reused_record,
+		          &identifier,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT64(
+		 "identifier",
+		 identifier,
+		 expected_identifier );
+	}
+	result = libevtx_record_free(
+	          &reused_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test reusing a record of which the record values are managed by the file
+	 */
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          0,
+	          &reused_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_file_get_record_by_index_into(
 	          file,
+	          number_of_records - 1,
+	          &reused_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_free(
+	          &reused_record,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1207,7 +3383,53 @@ int evtx_test_file_signal_abort(
 
 	/* Test error cases
 	 */
-	result = libevtx_file_signal_abort(
+	result = libevtx_file_get_record_by_index_into(
+	          NULL,
+	          0,
+	          &reused_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "reused_record",
+	 reused_record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index_into(
+	          file,
+	          -1,
+	          &reused_record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "reused_record",
+	 reused_record );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_by_index_into(
+	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1231,24 +3453,103 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( reused_record != NULL )
+	{
+		libevtx_record_free(
+		 &reused_record,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevtx_file_get_ascii_codepage function
+/* Tests the libevtx_file_get_record_written_time_by_index function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_get_ascii_codepage(
+int evtx_test_file_get_record_written_time_by_index(
      libevtx_file_t *file )
 {
 	libcerror_error_t *error = NULL;
-	int ascii_codepage       = 0;
+	libevtx_record_t *record = 0;
+	uint64_t filetime        = 0;
+	uint64_t record_filetime = 0;
+	int number_of_records    = 0;
 	int result               = 0;
 
+	/* Initialize test
+	 */
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
 	/* Test regular cases
 	 */
-	result = libevtx_file_get_ascii_codepage(
+	result = libevtx_file_get_record_written_time_by_index(
 	          file,
-	          &ascii_codepage,
+	          number_of_records - 1,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The written time must match the written time of the record
+	 */
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          number_of_records - 1,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_get_written_time(
+	          record,
+	          &record_filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "filetime",
+	 filetime,
+	 record_filetime );
+
+	result = libevtx_record_free(
+	          &record,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1262,9 +3563,10 @@ int evtx_test_file_get_ascii_codepage(
 
 	/* Test error cases
 	 */
-	result = libevtx_file_get_ascii_codepage(
+	result = libevtx_file_get_record_written_time_by_index(
 	          NULL,
-	          &ascii_codepage,
+	          0,
+	          &filetime,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1279,8 +3581,27 @@ int evtx_test_file_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_ascii_codepage(
+	result = libevtx_file_get_record_written_time_by_index(
+	          file,
+	          -1,
+	          &filetime,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_written_time_by_index(
 	          file,
+	          0,
 	          NULL,
 	          &error );
 
@@ -1304,125 +3625,128 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevtx_file_set_ascii_codepage function
+/* Tests the libevtx_file_get_record_header_values_by_index function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_set_ascii_codepage(
+int evtx_test_file_get_record_header_values_by_index(
      libevtx_file_t *file )
 {
-	int supported_codepages[ 15 ] = {
-		LIBEVTX_CODEPAGE_ASCII,
-		LIBEVTX_CODEPAGE_WINDOWS_874,
-		LIBEVTX_CODEPAGE_WINDOWS_932,
-		LIBEVTX_CODEPAGE_WINDOWS_936,
-		LIBEVTX_CODEPAGE_WINDOWS_949,
-		LIBEVTX_CODEPAGE_WINDOWS_950,
-		LIBEVTX_CODEPAGE_WINDOWS_1250,
-		LIBEVTX_CODEPAGE_WINDOWS_1251,
-		LIBEVTX_CODEPAGE_WINDOWS_1252,
-		LIBEVTX_CODEPAGE_WINDOWS_1253,
-		LIBEVTX_CODEPAGE_WINDOWS_1254,
-		LIBEVTX_CODEPAGE_WINDOWS_1255,
-		LIBEVTX_CODEPAGE_WINDOWS_1256,
-		LIBEVTX_CODEPAGE_WINDOWS_1257,
-		LIBEVTX_CODEPAGE_WINDOWS_1258 };
-
-	int unsupported_codepages[ 17 ] = {
-		LIBEVTX_CODEPAGE_ISO_8859_1,
-		LIBEVTX_CODEPAGE_ISO_8859_2,
-		LIBEVTX_CODEPAGE_ISO_8859_3,
-		LIBEVTX_CODEPAGE_ISO_8859_4,
-		LIBEVTX_CODEPAGE_ISO_8859_5,
-		LIBEVTX_CODEPAGE_ISO_8859_6,
-		LIBEVTX_CODEPAGE_ISO_8859_7,
-		LIBEVTX_CODEPAGE_ISO_8859_8,
-		LIBEVTX_CODEPAGE_ISO_8859_9,
-		LIBEVTX_CODEPAGE_ISO_8859_10,
-		LIBEVTX_CODEPAGE_ISO_8859_11,
-		LIBEVTX_CODEPAGE_ISO_8859_13,
-		LIBEVTX_CODEPAGE_ISO_8859_14,
-		LIBEVTX_CODEPAGE_ISO_8859_15,
-		LIBEVTX_CODEPAGE_ISO_8859_16,
-		LIBEVTX_CODEPAGE_KOI8_R,
-		LIBEVTX_CODEPAGE_KOI8_U };
-
-	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
-	int result               = 0;
+	libcerror_error_t *error   = NULL;
+	libevtx_record_t *record   = 0;
+	off64_t offset             = 0;
+	uint64_t identifier        = 0;
+	uint64_t record_filetime   = 0;
+	uint64_t record_identifier = 0;
+	uint64_t written_time      = 0;
+	uint32_t size              = 0;
+	int chunk_index            = 0;
+	int number_of_records      = 0;
+	int result                 = 0;
 
-	/* Test set ASCII codepage
+	/* Initialize test
 	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
-	{
-		codepage = supported_codepages[ index ];
+	result = libevtx_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
 
-		result = libevtx_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		EVTX_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
+	if( number_of_records == 0 )
+	{
+		return( 1 );
 	}
-	/* Test error cases
+	/* Test regular cases
 	 */
-	result = libevtx_file_set_ascii_codepage(
-	          NULL,
-	          LIBEVTX_CODEPAGE_ASCII,
+	result = libevtx_file_get_record_header_values_by_index(
+	          file,
+	          number_of_records - 1,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
+	          &size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_GREATER_THAN_INT(
+	 "chunk_index",
+	 chunk_index,
+	 -1 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) 0 );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT32(
+	 "size",
+	 (int32_t) size,
+	 0 );
+
+	/* The header values must match the values of the record
+	 */
+	result = libevtx_file_get_record_by_index(
+	          file,
+	          number_of_records - 1,
+	          &record,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	EVTX_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+	result = libevtx_record_get_identifier(
+	          record,
+	          &record_identifier,
+	          &error );
 
-		result = libevtx_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		EVTX_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		EVTX_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "identifier",
+	 identifier,
+	 record_identifier );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libevtx_file_set_ascii_codepage(
-	          file,
-	          LIBEVTX_CODEPAGE_WINDOWS_1252,
+	result = libevtx_record_get_written_time(
+	          record,
+	          &record_filetime,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1434,32 +3758,13 @@ int evtx_test_file_set_ascii_codepage(
 	 "error",
 	 error );
 
-	return( 1 );
-
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
-
-/* Tests the libevtx_file_get_flags function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_get_flags(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	uint32_t flags           = 0;
-	int result               = 0;
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "written_time",
+	 written_time,
+	 record_filetime );
 
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_flags(
-	          file,
-	          &flags,
+	result = libevtx_record_free(
+	          &record,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1473,9 +3778,14 @@ int evtx_test_file_get_flags(
 
 	/* Test error cases
 	 */
-	result = libevtx_file_get_flags(
+	result = libevtx_file_get_record_header_values_by_index(
 	          NULL,
-	          &flags,
+	          0,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
+	          &size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1490,9 +3800,36 @@ int evtx_test_file_get_flags(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_flags(
+	result = libevtx_file_get_record_header_values_by_index(
+	          file,
+	          -1,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
+	          &size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_header_values_by_index(
 	          file,
+	          0,
 	          NULL,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
+	          &size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1507,48 +3844,58 @@ int evtx_test_file_get_flags(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libevtx_file_get_record_header_values_by_index(
+	          file,
+	          0,
+	          &identifier,
+	          NULL,
+	          &chunk_index,
+	          &offset,
+	          &size,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libevtx_file_get_number_of_records function
- * Returns 1 if successful or 0 if not
- */
-int evtx_test_file_get_number_of_records(
-     libevtx_file_t *file )
-{
-	libcerror_error_t *error = NULL;
-	int number_of_records    = 0;
-	int result               = 0;
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_number_of_records(
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_header_values_by_index(
 	          file,
-	          &number_of_records,
+	          0,
+	          &identifier,
+	          &written_time,
+	          NULL,
+	          &offset,
+	          &size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libevtx_file_get_number_of_records(
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_file_get_record_header_values_by_index(
+	          file,
+	          0,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
 	          NULL,
-	          &number_of_records,
+	          &size,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1563,8 +3910,13 @@ int evtx_test_file_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_number_of_records(
+	result = libevtx_file_get_record_header_values_by_index(
 	          file,
+	          0,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
 	          NULL,
 	          &error );
 
@@ -1588,24 +3940,56 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevtx_file_get_record_by_index function
+/* Tests the libevtx_file_get_records_after_identifier function
  * Returns 1 if successful or 0 if not
  */
-int evtx_test_file_get_record_by_index(
+int evtx_test_file_get_records_after_identifier(
      libevtx_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	libevtx_record_t *record = 0;
-	int number_of_records    = 0;
-	int result               = 0;
+	libcerror_error_t *error    = NULL;
+	off64_t offset              = 0;
+	uint64_t identifier         = 0;
+	uint64_t written_time       = 0;
+	uint32_t size               = 0;
+	int chunk_index             = 0;
+	int first_record_index      = 0;
+	int number_of_records       = 0;
+	int oldest_record_index     = 0;
+	int result                  = 0;
+	int total_number_of_records = 0;
 
 	/* Initialize test
 	 */
 	result = libevtx_file_get_number_of_records(
 	          file,
+	          &total_number_of_records,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Record identifiers start at 1 so all records follow identifier 0
+	 */
+	result = libevtx_file_get_records_after_identifier(
+	          file,
+	          0,
+	          &oldest_record_index,
 	          &number_of_records,
 	          &error );
 
@@ -1618,20 +4002,42 @@ int evtx_test_file_get_record_by_index(
 	 "error",
 	 error );
 
-	if( number_of_records == 0 )
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 total_number_of_records );
+
+	if( total_number_of_records == 0 )
 	{
 		return( 1 );
 	}
-	/* Test regular cases
-	 */
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_get_record_header_values_by_index(
 	          file,
-	          0,
-	          &record,
+	          oldest_record_index,
+	          &identifier,
+	          &written_time,
+	          &chunk_index,
+	          &offset,
+	          &size,
 	          &error );
 
-	/* TODO: remove after troubleshooting failing tests */
-	EVTX_TEST_FPRINT_ERROR( error );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The oldest record is followed by all the other records
+	 */
+	result = libevtx_file_get_records_after_identifier(
+	          file,
+	          identifier,
+	          &first_record_index,
+	          &number_of_records,
+	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -1642,12 +4048,21 @@ int evtx_test_file_get_record_by_index(
 	 "error",
 	 error );
 
-	EVTX_TEST_ASSERT_IS_NOT_NULL(
-	 "record",
-	 record );
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "first_record_index",
+	 first_record_index,
+	 ( oldest_record_index + 1 ) % total_number_of_records );
 
-	result = libevtx_record_free(
-	          &record,
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 total_number_of_records - 1 );
+
+	result = libevtx_file_get_records_after_identifier(
+	          file,
+	          0xffffffffffffffffUL,
+	          &first_record_index,
+	          &number_of_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1659,12 +4074,18 @@ int evtx_test_file_get_record_by_index(
 	 "error",
 	 error );
 
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 0 );
+
 	/* Test error cases
 	 */
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_get_records_after_identifier(
 	          NULL,
 	          0,
-	          &record,
+	          &first_record_index,
+	          &number_of_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1672,10 +4093,6 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1683,10 +4100,11 @@ int evtx_test_file_get_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_get_records_after_identifier(
 	          file,
-	          -1,
-	          &record,
+	          0,
+	          NULL,
+	          &number_of_records,
 	          &error );
 
 	EVTX_TEST_ASSERT_EQUAL_INT(
@@ -1694,10 +4112,6 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1705,9 +4119,10 @@ int evtx_test_file_get_record_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libevtx_file_get_record_by_index(
+	result = libevtx_file_get_records_after_identifier(
 	          file,
 	          0,
+	          &first_record_index,
 	          NULL,
 	          &error );
 
@@ -1716,10 +4131,6 @@ int evtx_test_file_get_record_by_index(
 	 result,
 	 -1 );
 
-	EVTX_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
 	EVTX_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -2100,6 +4511,11 @@ int main(
 		 evtx_test_file_open_close,
 		 source );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_refresh",
+		 evtx_test_file_refresh,
+		 source );
+
 		/* Initialize file for tests
 		 */
 		result = evtx_test_file_open_source(
@@ -2143,6 +4559,26 @@ int main(
 		 evtx_test_file_set_ascii_codepage,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_cache_sizes",
+		 evtx_test_file_set_cache_sizes,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_read_ahead_depth",
+		 evtx_test_file_set_read_ahead_depth,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_read_buffer_size",
+		 evtx_test_file_set_read_buffer_size,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_set_number_of_decode_threads",
+		 evtx_test_file_set_number_of_decode_threads,
+		 file );
+
 		/* TODO: add tests for libevtx_file_get_format_version */
 
 		/* TODO: add tests for libevtx_file_get_version */
@@ -2162,11 +4598,36 @@ int main(
 		 evtx_test_file_get_record_by_index,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_record_by_index_into",
+		 evtx_test_file_get_record_by_index_into,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_record_written_time_by_index",
+		 evtx_test_file_get_record_written_time_by_index,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_record_header_values_by_index",
+		 evtx_test_file_get_record_header_values_by_index,
+		 file );
+
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_records_after_identifier",
+		 evtx_test_file_get_records_after_identifier,
+		 file );
+
 		EVTX_TEST_RUN_WITH_ARGS(
 		 "libevtx_file_get_number_of_recovered_records",
 		 evtx_test_file_get_number_of_recovered_records,
 		 file );
 
+		EVTX_TEST_RUN_WITH_ARGS(
+		 "libevtx_file_get_cache_statistics",
+		 evtx_test_file_get_cache_statistics,
+		 file );
+
 #if defined( TODO )
 
 		EVTX_TEST_RUN_WITH_ARGS(
@@ -0,0 +1,912 @@
+/*
+ * Library merge type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_getopt.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_merge.h"
+
+/* Tests the libevtx_merge_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_merge_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevtx_merge_t *merge          = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_merge_initialize(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_merge_free(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_merge_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	merge = (libevtx_merge_t *) 0x12345678UL;
+
+	result = libevtx_merge_initialize(
+	          &merge,
+	          &error );
+
+	merge = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_merge_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_merge_initialize(
+		          &merge,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( merge != NULL )
+			{
+				libevtx_merge_free(
+				 &merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "merge",
+			 merge );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_merge_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_merge_initialize(
+		          &merge,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( merge != NULL )
+			{
+				libevtx_merge_free(
+				 &merge,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "merge",
+			 merge );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge != NULL )
+	{
+		libevtx_merge_free(
+		 &merge,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_merge_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_merge_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_merge_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_merge_heap_sift_up and libevtx_merge_heap_sift_down functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_merge_heap(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_internal_merge_t *internal_merge = NULL;
+	libevtx_merge_t *merge                   = NULL;
+	int file_index                           = 0;
+	int result                               = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_merge_initialize(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_merge = (libevtx_internal_merge_t *) merge;
+
+	result = libevtx_merge_resize(
+	          internal_merge,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_merge->written_times[ 0 ] = 30;
+	internal_merge->written_times[ 1 ] = 10;
+	internal_merge->written_times[ 2 ] = 20;
+	internal_merge->written_times[ 3 ] = 10;
+
+	/* Test regular cases
+	 */
+	for( file_index = 0;
+	     file_index < 4;
+	     file_index++ )
+	{
+		internal_merge->heap[ file_index ] = file_index;
+
+		internal_merge->heap_size += 1;
+
+		result = libevtx_merge_heap_sift_up(
+		          internal_merge,
+		          file_index,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Files with an equal written time are ordered by file index
+	 */
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "internal_merge->heap[ 0 ]",
+	 internal_merge->heap[ 0 ],
+	 1 );
+
+	internal_merge->written_times[ 1 ] = 40;
+
+	result = libevtx_merge_heap_sift_down(
+	          internal_merge,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "internal_merge->heap[ 0 ]",
+	 internal_merge->heap[ 0 ],
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libevtx_merge_heap_sift_up(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_heap_sift_up(
+	          internal_merge,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_heap_sift_down(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_heap_sift_down(
+	          internal_merge,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_merge_free(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( merge != NULL )
+	{
+		libevtx_merge_free(
+		 &merge,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* Tests the libevtx_merge_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_merge_get_next_record(
+     libevtx_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	libevtx_merge_t *merge       = NULL;
+	libevtx_record_t *record     = NULL;
+	int file_index               = 0;
+	int number_of_files          = 0;
+	int number_of_merged_records = 0;
+	int number_of_records        = 0;
+	int result                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_merge_initialize(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_merge_get_next_record(
+	          merge,
+	          &file_index,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( file != NULL )
+	{
+		result = libevtx_file_get_number_of_records(
+		          file,
+		          &number_of_records,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The same file is appended twice, to merge 2 identical sequences of records
+		 */
+		for( file_index = 0;
+		     file_index < 2;
+		     file_index++ )
+		{
+			result = libevtx_merge_append_file(
+			          merge,
+			          file,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libevtx_merge_get_number_of_files(
+		          merge,
+		          &number_of_files,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "number_of_files",
+		 number_of_files,
+		 2 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		do
+		{
+			result = libevtx_merge_get_next_record(
+			          merge,
+			          &file_index,
+			          &record,
+			          &error );
+
+			EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			if( result != 0 )
+			{
+				EVTX_TEST_ASSERT_IS_NOT_NULL(
+				 "record",
+				 record );
+
+				EVTX_TEST_ASSERT_GREATER_THAN_INT(
+				 "file_index",
+				 file_index,
+				 -1 );
+
+				EVTX_TEST_ASSERT_LESS_THAN_INT(
+				 "file_index",
+				 file_index,
+				 2 );
+
+				result = libevtx_record_free(
+				          &record,
+				          &error );
+
+				EVTX_TEST_ASSERT_EQUAL_INT(
+				 "result",
+				 result,
+				 1 );
+
+				EVTX_TEST_ASSERT_IS_NULL(
+				 "error",
+				 error );
+
+				number_of_merged_records++;
+			}
+		}
+		while( result != 0 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "number_of_merged_records",
+		 number_of_merged_records,
+		 2 * number_of_records );
+	}
+	/* Test error cases
+	 */
+	result = libevtx_merge_get_next_record(
+	          NULL,
+	          &file_index,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_get_next_record(
+	          merge,
+	          NULL,
+	          &record,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_get_next_record(
+	          merge,
+	          &file_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_append_file(
+	          NULL,
+	          file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_merge_append_file(
+	          merge,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_merge_free(
+	          &merge,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "merge",
+	 merge );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevtx_record_free(
+		 &record,
+		 NULL );
+	}
+	if( merge != NULL )
+	{
+		libevtx_merge_free(
+		 &merge,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libcerror_error_t *error   = NULL;
+	libevtx_file_t *file       = NULL;
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+	int result                 = 0;
+
+	while( ( option = evtx_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+	EVTX_TEST_RUN(
+	 "libevtx_merge_initialize",
+	 evtx_test_merge_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_merge_free",
+	 evtx_test_merge_free );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_merge_heap",
+	 evtx_test_merge_heap );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+	if( source != NULL )
+	{
+		result = libevtx_file_initialize(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevtx_file_open_wide(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#else
+		result = libevtx_file_open(
+		          file,
+		          source,
+		          LIBEVTX_OPEN_READ,
+		          &error );
+#endif
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_merge_get_next_record",
+	 evtx_test_merge_get_next_record,
+	 file );
+
+	if( file != NULL )
+	{
+		result = libevtx_file_free(
+		          &file,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevtx_file_free(
+		 &file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,898 @@
+/*
+ * Library read_buffer type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_functions.h"
+#include "evtx_test_libbfio.h"
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_read_buffer.h"
+
+uint8_t evtx_test_read_buffer_data[ 16384 ];
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_read_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_read_buffer_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libevtx_read_buffer_t *read_buffer = NULL;
+	int result                         = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests    = 2;
+	int number_of_memset_fail_tests    = 1;
+	int test_number                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          1000,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_buffer->size",
+	 read_buffer->size,
+	 (size_t) 4096 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "read_buffer->data alignment",
+	 (int) ( (intptr_t) read_buffer->data % 4096 ),
+	 0 );
+
+	result = libevtx_read_buffer_free(
+	          &read_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_read_buffer_initialize(
+	          NULL,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_buffer = (libevtx_read_buffer_t *) 0x12345678UL;
+
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          4096,
+	          &error );
+
+	read_buffer = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          (size_t) LIBEVTX_READ_BUFFER_MAXIMUM_SIZE + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_read_buffer_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_read_buffer_initialize(
+		          &read_buffer,
+		          4096,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( read_buffer != NULL )
+			{
+				libevtx_read_buffer_free(
+				 &read_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "read_buffer",
+			 read_buffer );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_read_buffer_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_read_buffer_initialize(
+		          &read_buffer,
+		          4096,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( read_buffer != NULL )
+			{
+				libevtx_read_buffer_free(
+				 &read_buffer,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "read_buffer",
+			 read_buffer );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 &read_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_read_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_read_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_read_buffer_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_read_buffer_read_at_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_read_buffer_read_at_offset(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_read_buffer_t *read_buffer = NULL;
+	off64_t file_offset                = 0;
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_read_buffer_data,
+	          16384,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( file_offset = 0;
+	     file_offset < 16384;
+	     file_offset += 512 )
+	{
+		read_count = libevtx_read_buffer_read_at_offset(
+		              read_buffer,
+		              file_io_handle,
+		              file_offset,
+		              data,
+		              512,
+		              &error );
+
+		EVTX_TEST_ASSERT_EQUAL_SSIZE(
+		 "read_count",
+		 read_count,
+		 (ssize_t) 512 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ 0 ]",
+		 data[ 0 ],
+		 (uint8_t) ( file_offset / 512 ) );
+
+		EVTX_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ 511 ]",
+		 data[ 511 ],
+		 (uint8_t) ( file_offset / 512 ) );
+	}
+	/* The sequential reads are served by a single read per 4096 bytes
+	 */
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "read_buffer->number_of_reads",
+	 read_buffer->number_of_reads,
+	 (uint64_t) 4 );
+
+	/* A read that is not in sequence is passed to the file IO handle
+	 */
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              1024,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "read_buffer->number_of_reads",
+	 read_buffer->number_of_reads,
+	 (uint64_t) 5 );
+
+	/* The read that follows it fills the read buffer
+	 */
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              1536,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 3 );
+
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              2048,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 4 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "read_buffer->number_of_reads",
+	 read_buffer->number_of_reads,
+	 (uint64_t) 6 );
+
+	/* Test error cases
+	 */
+	read_count = libevtx_read_buffer_read_at_offset(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              -1,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              0,
+	              NULL,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              0,
+	              data,
+	              (size_t) SSIZE_MAX + 1,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_read_buffer_free(
+	          &read_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 &read_buffer,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_read_buffer_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_read_buffer_empty(
+     void )
+{
+	uint8_t data[ 512 ];
+
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libevtx_read_buffer_t *read_buffer = NULL;
+	ssize_t read_count                 = 0;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = evtx_test_open_file_io_handle(
+	          &file_io_handle,
+	          evtx_test_read_buffer_data,
+	          16384,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_read_buffer_initialize(
+	          &read_buffer,
+	          4096,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              0,
+	              data,
+	              512,
+	              &error );
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_buffer->buffered_size",
+	 read_buffer->buffered_size,
+	 (size_t) 4096 );
+
+	result = libevtx_read_buffer_empty(
+	          read_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_buffer->buffered_size",
+	 read_buffer->buffered_size,
+	 (size_t) 0 );
+
+	/* The read that follows is not served from the emptied read buffer
+	 */
+	evtx_test_read_buffer_data[ 512 ] = 0xff;
+
+	read_count = libevtx_read_buffer_read_at_offset(
+	              read_buffer,
+	              file_io_handle,
+	              512,
+	              data,
+	              512,
+	              &error );
+
+	evtx_test_read_buffer_data[ 512 ] = 1;
+
+	EVTX_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 0 ]",
+	 data[ 0 ],
+	 (uint8_t) 0xff );
+
+	/* Test error cases
+	 */
+	result = libevtx_read_buffer_empty(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_read_buffer_free(
+	          &read_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "read_buffer",
+	 read_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( read_buffer != NULL )
+	{
+		libevtx_read_buffer_free(
+		 &read_buffer,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	int data_offset = 0;
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	/* Each 512 bytes of the test data are filled with their block number
+	 */
+	for( data_offset = 0;
+	     data_offset < 16384;
+	     data_offset++ )
+	{
+		evtx_test_read_buffer_data[ data_offset ] = (uint8_t) ( data_offset / 512 );
+	}
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_read_buffer_initialize",
+	 evtx_test_read_buffer_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_read_buffer_free",
+	 evtx_test_read_buffer_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_read_buffer_read_at_offset",
+	 evtx_test_read_buffer_read_at_offset );
+
+	EVTX_TEST_RUN(
+	 "libevtx_read_buffer_empty",
+	 evtx_test_read_buffer_empty );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
@@ -116,6 +116,8 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_provider_identifier */
 
+	/* TODO: add tests for libevtx_record_get_utf8_provider_identifier_with_size */
+
 	/* TODO: add tests for libevtx_record_get_utf16_provider_identifier_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_provider_identifier */
@@ -124,6 +126,8 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_source_name */
 
+	/* TODO: add tests for libevtx_record_get_utf8_source_name_with_size */
+
 	/* TODO: add tests for libevtx_record_get_utf16_source_name_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_source_name */
@@ -132,6 +136,8 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_computer_name */
 
+	/* TODO: add tests for libevtx_record_get_utf8_computer_name_with_size */
+
 	/* TODO: add tests for libevtx_record_get_utf16_computer_name_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_computer_name */
@@ -140,6 +146,8 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_user_security_identifier */
 
+	/* TODO: add tests for libevtx_record_get_utf8_user_security_identifier_with_size */
+
 	/* TODO: add tests for libevtx_record_get_utf16_user_security_identifier_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_user_security_identifier */
@@ -152,6 +160,8 @@ int main(
 
 	/* TODO: add tests for libevtx_record_get_utf8_string */
 
+	/* TODO: add tests for libevtx_record_get_utf8_string_with_size */
+
 	/* TODO: add tests for libevtx_record_get_utf16_string_size */
 
 	/* TODO: add tests for libevtx_record_get_utf16_string */
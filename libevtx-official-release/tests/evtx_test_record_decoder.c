@@ -0,0 +1,697 @@
+/*
+ * Library record_decoder type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_io_handle.h"
+#include "../libevtx/libevtx_record_decoder.h"
+#include "../libevtx/libevtx_record_values.h"
+
+uint8_t evtx_test_record_decoder_chunk_data[ 512 ];
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+/* Tests the libevtx_record_decoder_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 2;
+	int number_of_memset_fail_tests          = 2;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_initialize(
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_decoder = (libevtx_record_decoder_t *) 0x12345678UL;
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          2,
+	          &error );
+
+	record_decoder = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          LIBEVTX_RECORD_DECODER_MAXIMUM_NUMBER_OF_THREADS + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_decoder_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_record_decoder_initialize(
+		          &record_decoder,
+		          2,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( record_decoder != NULL )
+			{
+				libevtx_record_decoder_free(
+				 &record_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_decoder",
+			 record_decoder );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_record_decoder_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_record_decoder_initialize(
+		          &record_decoder,
+		          2,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( record_decoder != NULL )
+			{
+				libevtx_record_decoder_free(
+				 &record_decoder,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "record_decoder",
+			 record_decoder );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_decoder_decode_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_decoder_decode_records(
+     void )
+{
+	libevtx_record_values_t *records_values[ 16 ];
+
+	libcerror_error_t *error                 = NULL;
+	libevtx_io_handle_t *io_handle           = NULL;
+	libevtx_record_decoder_t *record_decoder = NULL;
+	int iteration                            = 0;
+	int record_index                         = 0;
+	int result                               = 0;
+
+	for( record_index = 0;
+	     record_index < 16;
+	     record_index++ )
+	{
+		records_values[ record_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libevtx_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_decoder_initialize(
+	          &record_decoder,
+	          3,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < 16;
+	     record_index++ )
+	{
+		result = libevtx_record_values_initialize(
+		          &( records_values[ record_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "records_values[ record_index ]",
+		 records_values[ record_index ] );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* The record data exceeds the chunk data so the record cannot be decoded
+		 */
+		records_values[ record_index ]->chunk_data_offset = 512 - 32;
+		records_values[ record_index ]->data_size         = 128;
+	}
+	/* Test regular cases
+	 * The records are handed to the record decoder multiple times to make sure
+	 * the worker threads pick up each batch of records
+	 */
+	for( iteration = 0;
+	     iteration < 4;
+	     iteration++ )
+	{
+		result = libevtx_record_decoder_decode_records(
+		          record_decoder,
+		          io_handle,
+		          evtx_test_record_decoder_chunk_data,
+		          512,
+		          records_values,
+		          16,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "record_decoder->number_of_records",
+		 record_decoder->number_of_records,
+		 0 );
+
+		/* A record that cannot be decoded is left without XML document
+		 */
+		for( record_index = 0;
+		     record_index < 16;
+		     record_index++ )
+		{
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "records_values[ record_index ]->xml_document",
+			 records_values[ record_index ]->xml_document );
+		}
+	}
+	result = libevtx_record_decoder_decode_records(
+	          record_decoder,
+	          io_handle,
+	          evtx_test_record_decoder_chunk_data,
+	          512,
+	          records_values,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_decoder_decode_records(
+	          NULL,
+	          io_handle,
+	          evtx_test_record_decoder_chunk_data,
+	          512,
+	          records_values,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_decode_records(
+	          record_decoder,
+	          NULL,
+	          evtx_test_record_decoder_chunk_data,
+	          512,
+	          records_values,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_decode_records(
+	          record_decoder,
+	          io_handle,
+	          NULL,
+	          512,
+	          records_values,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_decode_records(
+	          record_decoder,
+	          io_handle,
+	          evtx_test_record_decoder_chunk_data,
+	          512,
+	          NULL,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_decoder_decode_records(
+	          record_decoder,
+	          io_handle,
+	          evtx_test_record_decoder_chunk_data,
+	          512,
+	          records_values,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( record_index = 0;
+	     record_index < 16;
+	     record_index++ )
+	{
+		result = libevtx_record_values_free(
+		          &( records_values[ record_index ] ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_record_decoder_free(
+	          &record_decoder,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "record_decoder",
+	 record_decoder );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( record_index = 0;
+	     record_index < 16;
+	     record_index++ )
+	{
+		if( records_values[ record_index ] != NULL )
+		{
+			libevtx_record_values_free(
+			 &( records_values[ record_index ] ),
+			 NULL );
+		}
+	}
+	if( record_decoder != NULL )
+	{
+		libevtx_record_decoder_free(
+		 &record_decoder,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevtx_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_initialize",
+	 evtx_test_record_decoder_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_free",
+	 evtx_test_record_decoder_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_decoder_decode_records",
+	 evtx_test_record_decoder_decode_records );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) && defined( HAVE_LIBEVTX_MULTI_THREAD_SUPPORT ) */
+}
+
@@ -0,0 +1,517 @@
+/*
+ * Library event record signature functions test program
+ *
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_record_signature.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Sets an event record with a size and size copy in the chunk data
+ */
+void evtx_test_record_signature_set_record(
+      uint8_t *chunk_data,
+      size_t chunk_data_offset,
+      uint32_t data_size,
+      uint32_t size_copy )
+{
+	chunk_data[ chunk_data_offset ]     = 0x2a;
+	chunk_data[ chunk_data_offset + 1 ] = 0x2a;
+	chunk_data[ chunk_data_offset + 2 ] = 0x00;
+	chunk_data[ chunk_data_offset + 3 ] = 0x00;
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ chunk_data_offset + 4 ] ),
+	 data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( chunk_data[ chunk_data_offset + data_size - 4 ] ),
+	 size_copy );
+}
+
+/* Tests the libevtx_record_signature_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_signature_scan(
+     void )
+{
+	uint8_t chunk_data[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	size_t signature_offset  = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = ( memory_set(
+	            chunk_data,
+	            0x2a,
+	            512 ) != NULL );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          512,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signature beyond the first block of 32 bytes
+	 */
+	evtx_test_record_signature_set_record(
+	 chunk_data,
+	 296,
+	 32,
+	 32 );
+
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          512,
+	          8,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 296 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that only offsets that are a multiple of 4 from the start are scanned
+	 */
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          512,
+	          2,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a signature in the last scanned offset
+	 */
+	chunk_data[ 504 ] = 0x2a;
+	chunk_data[ 505 ] = 0x2a;
+	chunk_data[ 506 ] = 0x00;
+	chunk_data[ 507 ] = 0x00;
+
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          512,
+	          300,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "signature_offset",
+	 signature_offset,
+	 (size_t) 504 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the last 4 bytes are not scanned
+	 */
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          508,
+	          300,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          4,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_signature_scan(
+	          NULL,
+	          512,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &signature_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_signature_scan(
+	          chunk_data,
+	          512,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_record_signature_check_header function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_record_signature_check_header(
+     void )
+{
+	uint8_t chunk_data[ 512 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = ( memory_set(
+	            chunk_data,
+	            0,
+	            512 ) != NULL );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	evtx_test_record_signature_set_record(
+	 chunk_data,
+	 0,
+	 64,
+	 64 );
+
+	evtx_test_record_signature_set_record(
+	 chunk_data,
+	 64,
+	 64,
+	 48 );
+
+	evtx_test_record_signature_set_record(
+	 chunk_data,
+	 128,
+	 16,
+	 16 );
+
+	evtx_test_record_signature_set_record(
+	 chunk_data,
+	 448,
+	 64,
+	 64 );
+
+	/* Test regular cases
+	 */
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that does not match the size copy
+	 */
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that is smaller than the event record header
+	 */
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          128,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a size that exceeds the remaining chunk data
+	 */
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          448,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          496,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          512,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_record_signature_check_header(
+	          NULL,
+	          512,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_signature_check_header(
+	          chunk_data,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_signature_scan",
+	 evtx_test_record_signature_scan );
+
+	EVTX_TEST_RUN(
+	 "libevtx_record_signature_check_header",
+	 evtx_test_record_signature_check_header );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,1358 @@
+/*
+ * Library records cache type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_record_values.h"
+#include "../libevtx/libevtx_records_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_records_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_records_cache_t *records_cache = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 4;
+	int number_of_memset_fail_tests        = 3;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_cache_initialize(
+	          NULL,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records_cache = (libevtx_records_cache_t *) 0x12345678UL;
+
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records_cache = NULL;
+
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_records_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_records_cache_initialize(
+		          &records_cache,
+		          8,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( records_cache != NULL )
+			{
+				libevtx_records_cache_free(
+				 &records_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "records_cache",
+			 records_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_records_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_records_cache_initialize(
+		          &records_cache,
+		          8,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( records_cache != NULL )
+			{
+				libevtx_records_cache_free(
+				 &records_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "records_cache",
+			 records_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_records_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_cache_set_record_values and libevtx_records_cache_get_record_values functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_set_record_values(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevtx_record_values_t *cached_record_values = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	libevtx_record_values_t *set_record_values[ 4 ];
+	libevtx_records_cache_t *records_cache        = NULL;
+	off64_t record_offset                         = 0;
+	int record_index                              = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Set more record values than the records cache can contain so that cache entries are replaced
+	 */
+	for( record_index = 0;
+	     record_index < 256;
+	     record_index++ )
+	{
+		record_offset = 0x1200 + ( (off64_t) record_index * 0x58 );
+
+		result = libevtx_record_values_initialize(
+		          &record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "record_values",
+		 record_values );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevtx_records_cache_set_record_values(
+		          records_cache,
+		          record_offset,
+		          record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		set_record_values[ record_index % 4 ] = record_values;
+
+		record_values = NULL;
+
+		/* The 4 most recently set record values are cached
+		 */
+		result = libevtx_records_cache_get_record_values(
+		          records_cache,
+		          record_offset,
+		          &cached_record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NOT_NULL(
+		 "cached_record_values",
+		 cached_record_values );
+
+		result = ( cached_record_values == set_record_values[ record_index % 4 ] );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( record_index >= 3 )
+		{
+			result = libevtx_records_cache_get_record_values(
+			          records_cache,
+			          record_offset - ( 3 * 0x58 ),
+			          &cached_record_values,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "cached_record_values",
+			 cached_record_values );
+
+			result = ( cached_record_values == set_record_values[ ( record_index - 3 ) % 4 ] );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		if( record_index >= 4 )
+		{
+			result = libevtx_records_cache_get_record_values(
+			          records_cache,
+			          record_offset - ( 4 * 0x58 ),
+			          &cached_record_values,
+			          &error );
+
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	/* Test error cases
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_set_record_values(
+	          NULL,
+	          0x1200,
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_set_record_values(
+	          records_cache,
+	          -1,
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_set_record_values(
+	          records_cache,
+	          0x1200,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test setting record values at an offset that is already cached
+	 */
+	result = libevtx_records_cache_set_record_values(
+	          records_cache,
+	          record_offset,
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_get_record_values(
+	          NULL,
+	          record_offset,
+	          &cached_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_get_record_values(
+	          records_cache,
+	          record_offset,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_cache_has_record_values function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_has_record_values(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_record_values_t *record_values = NULL;
+	libevtx_records_cache_t *records_cache = NULL;
+	int result                             = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_set_record_values(
+	          records_cache,
+	          0x1200,
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_values = NULL;
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_cache_has_record_values(
+	          records_cache,
+	          0x1200,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_has_record_values(
+	          records_cache,
+	          0x1258,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cache statistics are not updated
+	 */
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 records_cache->number_of_hits,
+	 (uint64_t) 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 records_cache->number_of_misses,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_cache_has_record_values(
+	          NULL,
+	          0x1200,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_cache_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_resize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevtx_record_values_t *cached_record_values = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	libevtx_records_cache_t *records_cache        = NULL;
+	int record_index                              = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libevtx_record_values_initialize(
+		          &record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values->data_size = 0x58;
+
+		result = libevtx_records_cache_set_record_values(
+		          records_cache,
+		          0x1200 + ( (off64_t) record_index * 0x58 ),
+		          record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values = NULL;
+	}
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 records_cache->resident_size,
+	 (uint64_t) 8 * 0x58 );
+
+	/* Test shrinking the records cache, the 4 most recently set record values are kept
+	 */
+	result = libevtx_records_cache_resize(
+	          records_cache,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 records_cache->number_of_evictions,
+	 (uint64_t) 4 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 records_cache->resident_size,
+	 (uint64_t) 4 * 0x58 );
+
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libevtx_records_cache_get_record_values(
+		          records_cache,
+		          0x1200 + ( (off64_t) record_index * 0x58 ),
+		          &cached_record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( record_index < 4 ) ? 0 : 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test growing the records cache
+	 */
+	result = libevtx_records_cache_resize(
+	          records_cache,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_get_record_values(
+	          records_cache,
+	          0x1200 + ( 7 * 0x58 ),
+	          &cached_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 records_cache->number_of_hits,
+	 (uint64_t) 5 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 records_cache->number_of_misses,
+	 (uint64_t) 4 );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_cache_resize(
+	          NULL,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_resize(
+	          records_cache,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_resize(
+	          records_cache,
+	          LIBEVTX_RECORDS_CACHE_MAXIMUM_NUMBER_OF_ENTRIES + 1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_cache_remove_from_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_cache_remove_from_offset(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libevtx_record_values_t *cached_record_values = NULL;
+	libevtx_record_values_t *record_values        = NULL;
+	libevtx_records_cache_t *records_cache        = NULL;
+	int record_index                              = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_records_cache_initialize(
+	          &records_cache,
+	          8,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libevtx_record_values_initialize(
+		          &record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values->data_size = 0x58;
+
+		result = libevtx_records_cache_set_record_values(
+		          records_cache,
+		          0x1200 + ( (off64_t) record_index * 0x58 ),
+		          record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libevtx_records_cache_remove_from_offset(
+	          records_cache,
+	          0x1200 + ( 4 * 0x58 ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 records_cache->resident_size,
+	 (uint64_t) 4 * 0x58 );
+
+	for( record_index = 0;
+	     record_index < 8;
+	     record_index++ )
+	{
+		result = libevtx_records_cache_get_record_values(
+		          records_cache,
+		          0x1200 + ( (off64_t) record_index * 0x58 ),
+		          &cached_record_values,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 ( record_index < 4 ) ? 1 : 0 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The record values of a removed record offset can be set again
+	 */
+	result = libevtx_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_cache_set_record_values(
+	          records_cache,
+	          0x1200 + ( 5 * 0x58 ),
+	          record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_values = NULL;
+
+	result = libevtx_records_cache_get_record_values(
+	          records_cache,
+	          0x1200 + ( 5 * 0x58 ),
+	          &cached_record_values,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_cache_remove_from_offset(
+	          NULL,
+	          0x1200,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_cache_remove_from_offset(
+	          records_cache,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevtx_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevtx_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevtx_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_initialize",
+	 evtx_test_records_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_free",
+	 evtx_test_records_cache_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_set_record_values",
+	 evtx_test_records_cache_set_record_values );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_has_record_values",
+	 evtx_test_records_cache_has_record_values );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_resize",
+	 evtx_test_records_cache_resize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_cache_remove_from_offset",
+	 evtx_test_records_cache_remove_from_offset );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
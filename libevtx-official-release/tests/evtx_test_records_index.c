@@ -0,0 +1,1126 @@
+/*
+ * Library records index type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_records_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_records_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevtx_records_index_t *records_index = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 1;
+	int number_of_memset_fail_tests        = 1;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_index_initialize(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_index",
+	 records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_free(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_index",
+	 records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records_index = (libevtx_records_index_t *) 0x12345678UL;
+
+	result = libevtx_records_index_initialize(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records_index = NULL;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_records_index_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_records_index_initialize(
+		          &records_index,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( records_index != NULL )
+			{
+				libevtx_records_index_free(
+				 &records_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "records_index",
+			 records_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_records_index_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_records_index_initialize(
+		          &records_index,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( records_index != NULL )
+			{
+				libevtx_records_index_free(
+				 &records_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "records_index",
+			 records_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &records_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_index_append_entry function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_append_entry(
+     libevtx_records_index_t *records_index )
+{
+	libcerror_error_t *error = NULL;
+	int entry_index          = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * Append enough entries to make sure the records index is resized more than once
+	 */
+	for( entry_index = 0;
+	     entry_index < ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1;
+	     entry_index++ )
+	{
+		result = libevtx_records_index_append_entry(
+		          records_index,
+		          (uint32_t) ( entry_index / 64 ),
+		          (uint16_t) ( 512 + ( ( entry_index % 64 ) * 128 ) ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevtx_records_index_get_number_of_entries(
+	          records_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_append_entry(
+	          NULL,
+	          0,
+	          512,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_number_of_entries(
+	          NULL,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_number_of_entries(
+	          records_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_index_get_entry_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_get_entry_by_index(
+     libevtx_records_index_t *records_index )
+{
+	libcerror_error_t *error   = NULL;
+	uint16_t chunk_data_offset = 0;
+	uint32_t chunk_index       = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          0,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 (uint32_t) ( ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) / 64 ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          65,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 640 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_get_entry_by_index(
+	          NULL,
+	          0,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          -1,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          0,
+	          NULL,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          0,
+	          &chunk_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_index_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_clone(
+     libevtx_records_index_t *records_index )
+{
+	libcerror_error_t *error                           = NULL;
+	libevtx_records_index_t *destination_records_index = NULL;
+	uint16_t chunk_data_offset                         = 0;
+	uint32_t chunk_index                               = 0;
+	int number_of_entries                              = 0;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_index_clone(
+	          &destination_records_index,
+	          records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_records_index",
+	 destination_records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_number_of_entries(
+	          destination_records_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) + 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          destination_records_index,
+	          4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 (uint32_t) ( ( 4 * LIBEVTX_RECORDS_INDEX_INITIAL_NUMBER_OF_ENTRIES ) / 64 ) );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Make sure the source is not changed by changes to the clone
+	 */
+	result = libevtx_records_index_truncate(
+	          destination_records_index,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_append_entry(
+	          destination_records_index,
+	          70000,
+	          1024,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          0,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 512 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          destination_records_index,
+	          0,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 70000 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 1024 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_free(
+	          &destination_records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "destination_records_index",
+	 destination_records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_clone(
+	          &destination_records_index,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "destination_records_index",
+	 destination_records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_clone(
+	          NULL,
+	          records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_records_index = (libevtx_records_index_t *) 0x12345678UL;
+
+	result = libevtx_records_index_clone(
+	          &destination_records_index,
+	          records_index,
+	          &error );
+
+	destination_records_index = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &destination_records_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_records_index_truncate function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_records_index_truncate(
+     libevtx_records_index_t *records_index )
+{
+	libcerror_error_t *error   = NULL;
+	uint16_t chunk_data_offset = 0;
+	uint32_t chunk_index       = 0;
+	int number_of_entries      = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_records_index_truncate(
+	          records_index,
+	          65,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_number_of_entries(
+	          records_index,
+	          &number_of_entries,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 65 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          65,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Make sure entries can be appended after the truncated entries
+	 */
+	result = libevtx_records_index_append_entry(
+	          records_index,
+	          2,
+	          768,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_records_index_get_entry_by_index(
+	          records_index,
+	          65,
+	          &chunk_index,
+	          &chunk_data_offset,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "chunk_index",
+	 chunk_index,
+	 2 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT16(
+	 "chunk_data_offset",
+	 chunk_data_offset,
+	 768 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_records_index_truncate(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_truncate(
+	          records_index,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_records_index_truncate(
+	          records_index,
+	          67,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+	libcerror_error_t *error               = NULL;
+	libevtx_records_index_t *records_index = NULL;
+	int result                             = 0;
+#endif
+
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_index_initialize",
+	 evtx_test_records_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_records_index_free",
+	 evtx_test_records_index_free );
+
+	/* Initialize records index for tests
+	 */
+	result = libevtx_records_index_initialize(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "records_index",
+	 records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_records_index_append_entry",
+	 evtx_test_records_index_append_entry,
+	 records_index );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_records_index_get_entry_by_index",
+	 evtx_test_records_index_get_entry_by_index,
+	 records_index );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_records_index_clone",
+	 evtx_test_records_index_clone,
+	 records_index );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "libevtx_records_index_truncate",
+	 evtx_test_records_index_truncate,
+	 records_index );
+
+	/* Clean up
+	 */
+	result = libevtx_records_index_free(
+	          &records_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "records_index",
+	 records_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( records_index != NULL )
+	{
+		libevtx_records_index_free(
+		 &records_index,
+		 NULL );
+	}
+#endif
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1118 @@
+/*
+ * Library string_table type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_libfvalue.h"
+#include "../libevtx/libevtx_string_table.h"
+
+/* "WKS-01" without an end-of-string character
+ */
+uint8_t evtx_test_string_table_utf16_stream1[ 12 ] = {
+	'W', 0, 'K', 0, 'S', 0, '-', 0, '0', 0, '1', 0 };
+
+/* "WKS-02" without an end-of-string character
+ */
+uint8_t evtx_test_string_table_utf16_stream2[ 12 ] = {
+	'W', 0, 'K', 0, 'S', 0, '-', 0, '0', 0, '2', 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Creates an UTF-16 string value
+ * Returns 1 if successful or -1 on error
+ */
+int evtx_test_string_table_value_initialize(
+     libfvalue_value_t **value,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	if( libfvalue_value_type_initialize(
+	     value,
+	     LIBFVALUE_VALUE_TYPE_STRING_UTF16,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfvalue_value_set_data(
+	     *value,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBFVALUE_CODEPAGE_UTF16_LITTLE_ENDIAN,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libfvalue_value_free(
+		 value,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libevtx_string_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_string_table_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libevtx_string_table_t *string_table = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "string_table",
+	 string_table );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_free(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "string_table",
+	 string_table );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_string_table_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	string_table = (libevtx_string_table_t *) 0x12345678UL;
+
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	string_table = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_string_table_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = libevtx_string_table_initialize(
+		          &string_table,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( string_table != NULL )
+			{
+				libevtx_string_table_free(
+				 &string_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "string_table",
+			 string_table );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevtx_string_table_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = libevtx_string_table_initialize(
+		          &string_table,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( string_table != NULL )
+			{
+				libevtx_string_table_free(
+				 &string_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "string_table",
+			 string_table );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_string_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_string_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevtx_string_table_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_string_table_get_interned_string_by_value function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_string_table_get_interned_string_by_value(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libevtx_interned_string_t *interned_string1 = NULL;
+	libevtx_interned_string_t *interned_string2 = NULL;
+	libevtx_string_table_t *string_table        = NULL;
+	libfvalue_value_t *value1                   = NULL;
+	libfvalue_value_t *value2                   = NULL;
+	libfvalue_value_t *value3                   = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_string_table_value_initialize(
+	          &value1,
+	          evtx_test_string_table_utf16_stream1,
+	          12,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_string_table_value_initialize(
+	          &value2,
+	          evtx_test_string_table_utf16_stream1,
+	          12,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_string_table_value_initialize(
+	          &value3,
+	          evtx_test_string_table_utf16_stream2,
+	          12,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value1,
+	          &interned_string1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "interned_string1",
+	 interned_string1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A value with the same data returns the same interned string
+	 */
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value2,
+	          &interned_string2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "interned_string2 == interned_string1",
+	 (int) ( interned_string2 == interned_string1 ),
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_table->number_of_interned_strings",
+	 string_table->number_of_interned_strings,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value3,
+	          &interned_string2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "interned_string2 == interned_string1",
+	 (int) ( interned_string2 == interned_string1 ),
+	 0 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "string_table->number_of_interned_strings",
+	 string_table->number_of_interned_strings,
+	 2 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_string_table_get_interned_string_by_value(
+	          NULL,
+	          value1,
+	          &interned_string1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          NULL,
+	          &interned_string1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_get_interned_string_by_value(
+	          string_table,
+	          value1,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value3,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfvalue_value_free(
+	          &value1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_free(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value3 != NULL )
+	{
+		libfvalue_value_free(
+		 &value3,
+		 NULL );
+	}
+	if( value2 != NULL )
+	{
+		libfvalue_value_free(
+		 &value2,
+		 NULL );
+	}
+	if( value1 != NULL )
+	{
+		libfvalue_value_free(
+		 &value1,
+		 NULL );
+	}
+	if( string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_string_table_copy_value_to_utf8_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_string_table_copy_value_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libevtx_string_table_t *string_table = NULL;
+	libfvalue_value_t *value             = NULL;
+	size_t required_utf8_string_size     = 0;
+	size_t utf8_string_size              = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_string_table_value_initialize(
+	          &value,
+	          evtx_test_string_table_utf16_stream1,
+	          12,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_string_table_get_utf8_string_size_from_value(
+	          string_table,
+	          value,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 7 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_copy_value_to_utf8_string(
+	          string_table,
+	          value,
+	          utf8_string,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "WKS-01",
+	          7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_string_table_copy_value_to_utf8_string_with_size(
+	          string_table,
+	          value,
+	          NULL,
+	          0,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "required_utf8_string_size",
+	 required_utf8_string_size,
+	 (size_t) 7 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test without a string table
+	 */
+	result = libevtx_string_table_copy_value_to_utf8_string(
+	          NULL,
+	          value,
+	          utf8_string,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "WKS-01",
+	          7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_string_table_get_utf8_string_size_from_value(
+	          string_table,
+	          value,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_copy_value_to_utf8_string(
+	          string_table,
+	          value,
+	          NULL,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_copy_value_to_utf8_string(
+	          string_table,
+	          value,
+	          utf8_string,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_copy_value_to_utf8_string_with_size(
+	          string_table,
+	          value,
+	          utf8_string,
+	          16,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_free(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_string_table_copy_value_to_utf16_string functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_string_table_copy_value_to_utf16_string(
+     void )
+{
+	uint16_t expected_utf16_string[ 7 ] = {
+		'W', 'K', 'S', '-', '0', '1', 0 };
+
+	uint16_t utf16_string[ 16 ];
+
+	libcerror_error_t *error             = NULL;
+	libevtx_string_table_t *string_table = NULL;
+	libfvalue_value_t *value             = NULL;
+	size_t utf16_string_size             = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libevtx_string_table_initialize(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtx_test_string_table_value_initialize(
+	          &value,
+	          evtx_test_string_table_utf16_stream1,
+	          12,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevtx_string_table_get_utf16_string_size_from_value(
+	          string_table,
+	          value,
+	          &utf16_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 7 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_copy_value_to_utf16_string(
+	          string_table,
+	          value,
+	          utf16_string,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 7 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_string_table_get_utf16_string_size_from_value(
+	          string_table,
+	          value,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_string_table_copy_value_to_utf16_string(
+	          string_table,
+	          value,
+	          utf16_string,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfvalue_value_free(
+	          &value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_string_table_free(
+	          &string_table,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( value != NULL )
+	{
+		libfvalue_value_free(
+		 &value,
+		 NULL );
+	}
+	if( string_table != NULL )
+	{
+		libevtx_string_table_free(
+		 &string_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_string_table_initialize",
+	 evtx_test_string_table_initialize );
+
+	EVTX_TEST_RUN(
+	 "libevtx_string_table_free",
+	 evtx_test_string_table_free );
+
+	EVTX_TEST_RUN(
+	 "libevtx_string_table_get_interned_string_by_value",
+	 evtx_test_string_table_get_interned_string_by_value );
+
+	EVTX_TEST_RUN(
+	 "libevtx_string_table_copy_value_to_utf8_string",
+	 evtx_test_string_table_copy_value_to_utf8_string );
+
+	EVTX_TEST_RUN(
+	 "libevtx_string_table_copy_value_to_utf16_string",
+	 evtx_test_string_table_copy_value_to_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,413 @@
+/*
+ * Tools checkpoint file functions test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/checkpoint_file.h"
+
+#define EVTX_TEST_CHECKPOINT_FILENAME	"evtx_test_tools_checkpoint_file.tmp"
+
+/* Tests the checkpoint_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_checkpoint_file_initialize(
+     void )
+{
+	checkpoint_file_t *checkpoint_file = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = checkpoint_file_initialize(
+	          &checkpoint_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint_file",
+	 checkpoint_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = checkpoint_file_free(
+	          &checkpoint_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "checkpoint_file",
+	 checkpoint_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	checkpoint_file = (checkpoint_file_t *) 0x12345678UL;
+
+	result = checkpoint_file_initialize(
+	          &checkpoint_file,
+	          &error );
+
+	checkpoint_file = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint_file != NULL )
+	{
+		checkpoint_file_free(
+		 &checkpoint_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the checkpoint_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_checkpoint_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the checkpoint_file_write and checkpoint_file_read functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_checkpoint_file_write_and_read(
+     void )
+{
+	checkpoint_file_t *checkpoint_file = NULL;
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	result = checkpoint_file_initialize(
+	          &checkpoint_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "checkpoint_file",
+	 checkpoint_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	checkpoint_file->record_identifier = 0x0102030405060708UL;
+	checkpoint_file->written_time      = 0x01d0a2b3c4d5e6f7UL;
+
+	result = checkpoint_file_write(
+	          checkpoint_file,
+	          _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	checkpoint_file->record_identifier = 0;
+	checkpoint_file->written_time      = 0;
+
+	result = checkpoint_file_read(
+	          checkpoint_file,
+	          _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	_wremove(
+	 _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ) );
+#else
+	remove(
+	 EVTX_TEST_CHECKPOINT_FILENAME );
+#endif
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "record_identifier",
+	 checkpoint_file->record_identifier,
+	 (uint64_t) 0x0102030405060708UL );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT64(
+	 "written_time",
+	 checkpoint_file->written_time,
+	 (uint64_t) 0x01d0a2b3c4d5e6f7UL );
+
+	/* Test reading a checkpoint file that does not exist
+	 */
+	result = checkpoint_file_read(
+	          checkpoint_file,
+	          _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = checkpoint_file_write(
+	          NULL,
+	          _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_write(
+	          checkpoint_file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_read(
+	          NULL,
+	          _SYSTEM_STRING( EVTX_TEST_CHECKPOINT_FILENAME ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = checkpoint_file_read(
+	          checkpoint_file,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = checkpoint_file_free(
+	          &checkpoint_file,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "checkpoint_file",
+	 checkpoint_file );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( checkpoint_file != NULL )
+	{
+		checkpoint_file_free(
+		 &checkpoint_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "checkpoint_file_initialize",
+	 evtx_test_tools_checkpoint_file_initialize )
+
+	EVTX_TEST_RUN(
+	 "checkpoint_file_free",
+	 evtx_test_tools_checkpoint_file_free )
+
+	EVTX_TEST_RUN(
+	 "checkpoint_file_write_and_read",
+	 evtx_test_tools_checkpoint_file_write_and_read )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,510 @@
+/*
+ * Tools FILETIME formatting functions test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/evtxtools_filetime.h"
+
+/* Tests the evtxtools_filetime_formatter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_filetime_formatter_initialize(
+     void )
+{
+	evtxtools_filetime_formatter_t *filetime_formatter = NULL;
+	libcerror_error_t *error                           = NULL;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = evtxtools_filetime_formatter_initialize(
+	          &filetime_formatter,
+	          EVTXTOOLS_FILETIME_FORMAT_CTIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "filetime_formatter",
+	 filetime_formatter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_filetime_formatter_free(
+	          &filetime_formatter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "filetime_formatter",
+	 filetime_formatter );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = evtxtools_filetime_formatter_initialize(
+	          NULL,
+	          EVTXTOOLS_FILETIME_FORMAT_CTIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filetime_formatter = (evtxtools_filetime_formatter_t *) 0x12345678UL;
+
+	result = evtxtools_filetime_formatter_initialize(
+	          &filetime_formatter,
+	          EVTXTOOLS_FILETIME_FORMAT_CTIME,
+	          &error );
+
+	filetime_formatter = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_filetime_formatter_initialize(
+	          &filetime_formatter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime_formatter != NULL )
+	{
+		evtxtools_filetime_formatter_free(
+		 &filetime_formatter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the evtxtools_filetime_formatter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_filetime_formatter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = evtxtools_filetime_formatter_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the evtxtools_filetime_formatter_copy_to_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_filetime_formatter_copy_to_string(
+     void )
+{
+	system_character_t filetime_string[ EVTXTOOLS_FILETIME_STRING_SIZE ];
+
+	evtxtools_filetime_formatter_t *filetime_formatter = NULL;
+	libcerror_error_t *error                           = NULL;
+	int result                                         = 0;
+
+	result = evtxtools_filetime_formatter_initialize(
+	          &filetime_formatter,
+	          EVTXTOOLS_FILETIME_FORMAT_CTIME,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          0,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          filetime_string,
+	          _SYSTEM_STRING( "Jan 01, 1601 00:00:00.000000000 UTC" ),
+	          36 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Format a value on the same day to test the cached date
+	 */
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          (uint64_t) 132223104001234567ULL,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          filetime_string,
+	          _SYSTEM_STRING( "Jan 01, 2020 00:00:00.123456700 UTC" ),
+	          36 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          (uint64_t) 132223967999999999ULL,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          filetime_string,
+	          _SYSTEM_STRING( "Jan 01, 2020 23:59:59.999999900 UTC" ),
+	          36 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          (uint64_t) 0xffffffffffffffffULL,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          filetime_string,
+	          _SYSTEM_STRING( "(0xffffffff 0xffffffff) UTC" ),
+	          28 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = evtxtools_filetime_formatter_set_format(
+	          filetime_formatter,
+	          EVTXTOOLS_FILETIME_FORMAT_ISO8601,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          (uint64_t) 132223104001234567ULL,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = system_string_compare(
+	          filetime_string,
+	          _SYSTEM_STRING( "2020-01-01T00:00:00.1234567Z" ),
+	          29 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          NULL,
+	          0,
+	          filetime_string,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          0,
+	          NULL,
+	          EVTXTOOLS_FILETIME_STRING_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_filetime_formatter_copy_to_string(
+	          filetime_formatter,
+	          0,
+	          filetime_string,
+	          16,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_filetime_formatter_set_format(
+	          filetime_formatter,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtxtools_filetime_formatter_free(
+	          &filetime_formatter,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filetime_formatter != NULL )
+	{
+		evtxtools_filetime_formatter_free(
+		 &filetime_formatter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "evtxtools_filetime_formatter_initialize",
+	 evtx_test_tools_filetime_formatter_initialize )
+
+	EVTX_TEST_RUN(
+	 "evtxtools_filetime_formatter_free",
+	 evtx_test_tools_filetime_formatter_free )
+
+	EVTX_TEST_RUN(
+	 "evtxtools_filetime_formatter_copy_to_string",
+	 evtx_test_tools_filetime_formatter_copy_to_string )
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
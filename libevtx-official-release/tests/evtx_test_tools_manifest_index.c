@@ -0,0 +1,849 @@
+/*
+ * Tools manifest_index type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/manifest_index.h"
+
+/* Tests the manifest_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_initialize(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	manifest_index_t *manifest_index = NULL;
+	int result                       = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests  = 1;
+	int number_of_memset_fail_tests  = 1;
+	int test_number                  = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = manifest_index_initialize(
+	          &manifest_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest_index",
+	 manifest_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = manifest_index_free(
+	          &manifest_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "manifest_index",
+	 manifest_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = manifest_index_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	manifest_index = (manifest_index_t *) 0x12345678UL;
+
+	result = manifest_index_initialize(
+	          &manifest_index,
+	          &error );
+
+	manifest_index = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test manifest_index_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = manifest_index_initialize(
+		          &manifest_index,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( manifest_index != NULL )
+			{
+				manifest_index_free(
+				 &manifest_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "manifest_index",
+			 manifest_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test manifest_index_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = manifest_index_initialize(
+		          &manifest_index,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( manifest_index != NULL )
+			{
+				manifest_index_free(
+				 &manifest_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "manifest_index",
+			 manifest_index );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest_index != NULL )
+	{
+		manifest_index_free(
+		 &manifest_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = manifest_index_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_values_table functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_values_table(
+     void )
+{
+	manifest_index_value_t **values_table = NULL;
+	libcerror_error_t *error              = NULL;
+	intptr_t *value                       = NULL;
+	uint32_t key                          = 0;
+	uint32_t values_table_size            = 0;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = manifest_index_values_table_initialize(
+	          &values_table,
+	          &values_table_size,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "values_table",
+	 values_table );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "values_table_size",
+	 values_table_size,
+	 (uint32_t) 64 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key = 0;
+	     key < 256;
+	     key++ )
+	{
+		result = manifest_index_values_table_append_value(
+		          values_table,
+		          values_table_size,
+		          key,
+		          (intptr_t *) ( (size_t) key + 1 ),
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The first value appended for a key takes precedence
+	 */
+	result = manifest_index_values_table_append_value(
+	          values_table,
+	          values_table_size,
+	          100,
+	          (intptr_t *) 0x12345678UL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key = 0;
+	     key < 256;
+	     key++ )
+	{
+		result = manifest_index_values_table_get_value_by_key(
+		          values_table,
+		          values_table_size,
+		          key,
+		          &value,
+		          &error );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVTX_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 (int) (size_t) value,
+		 (int) key + 1 );
+
+		EVTX_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = manifest_index_values_table_get_value_by_key(
+	          values_table,
+	          values_table_size,
+	          0xffffffffUL,
+	          &value,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = manifest_index_values_table_get_value_by_key(
+	          values_table,
+	          values_table_size,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_values_table_append_value(
+	          values_table,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_values_table_initialize(
+	          &values_table,
+	          &values_table_size,
+	          40,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = manifest_index_values_table_free(
+	          &values_table,
+	          values_table_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "values_table",
+	 values_table );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( values_table != NULL )
+	{
+		manifest_index_values_table_free(
+		 &values_table,
+		 values_table_size,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_get_provider_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_get_provider_by_identifier(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x7f, 0x2f, 0x0a, 0x55, 0x0b, 0x1b, 0x48, 0x40, 0x83, 0xd5, 0x6d, 0x71, 0x0a, 0x45, 0xd5, 0xb3 };
+
+	libcerror_error_t *error                  = NULL;
+	manifest_index_t *manifest_index          = NULL;
+	manifest_index_provider_t *index_provider = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = manifest_index_initialize(
+	          &manifest_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest_index",
+	 manifest_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = manifest_index_get_provider_by_identifier(
+	          manifest_index,
+	          provider_identifier,
+	          16,
+	          &index_provider,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "index_provider",
+	 index_provider );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = manifest_index_get_provider_by_identifier(
+	          NULL,
+	          provider_identifier,
+	          16,
+	          &index_provider,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_get_provider_by_identifier(
+	          manifest_index,
+	          NULL,
+	          16,
+	          &index_provider,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_get_provider_by_identifier(
+	          manifest_index,
+	          provider_identifier,
+	          8,
+	          &index_provider,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_get_provider_by_identifier(
+	          manifest_index,
+	          provider_identifier,
+	          16,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = manifest_index_free(
+	          &manifest_index,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "manifest_index",
+	 manifest_index );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest_index != NULL )
+	{
+		manifest_index_free(
+		 &manifest_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_provider_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_provider_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	manifest_index_provider_t *index_provider = NULL;
+	int result                                = 0;
+
+	/* Test error cases
+	 */
+	result = manifest_index_provider_initialize(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = manifest_index_provider_initialize(
+	          &index_provider,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "index_provider",
+	 index_provider );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_provider_get_event_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_provider_get_event_by_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwevt_event_t *event  = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = manifest_index_provider_get_event_by_identifier(
+	          NULL,
+	          1,
+	          &event,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the manifest_index_provider_get_template_by_offset function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_manifest_index_provider_get_template_by_offset(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfwevt_template_t *wevt_template = NULL;
+	int result                         = 0;
+
+	/* Test error cases
+	 */
+	result = manifest_index_provider_get_template_by_offset(
+	          NULL,
+	          0x00001000UL,
+	          &wevt_template,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "manifest_index_initialize",
+	 evtx_test_tools_manifest_index_initialize );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_free",
+	 evtx_test_tools_manifest_index_free );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_values_table",
+	 evtx_test_tools_manifest_index_values_table );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_get_provider_by_identifier",
+	 evtx_test_tools_manifest_index_get_provider_by_identifier );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_provider_initialize",
+	 evtx_test_tools_manifest_index_provider_initialize );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_provider_get_event_by_identifier",
+	 evtx_test_tools_manifest_index_provider_get_event_by_identifier );
+
+	EVTX_TEST_RUN(
+	 "manifest_index_provider_get_template_by_offset",
+	 evtx_test_tools_manifest_index_provider_get_template_by_offset );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -268,6 +268,123 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the message_handle_set_eventlog_key_name function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_message_handle_set_eventlog_key_name(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	message_handle_t *message_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = message_handle_initialize(
+	          &message_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "message_handle",
+	 message_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = message_handle_set_eventlog_key_name(
+	          message_handle,
+	          "Application",
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = message_handle_set_eventlog_key_name(
+	          NULL,
+	          "Application",
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = message_handle_set_eventlog_key_name(
+	          message_handle,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = message_handle_free(
+	          &message_handle,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "message_handle",
+	 message_handle );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( message_handle != NULL )
+	{
+		message_handle_free(
+		 &message_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +408,10 @@ int main(
 	 "message_handle_free",
 	 evtx_test_tools_message_handle_free );
 
+	EVTX_TEST_RUN(
+	 "message_handle_set_eventlog_key_name",
+	 evtx_test_tools_message_handle_set_eventlog_key_name );
+
 	return( EXIT_SUCCESS );
 
 on_error:
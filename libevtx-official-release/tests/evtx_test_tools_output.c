@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #include <stdio.h>
@@ -72,6 +73,486 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the evtxtools_output_buffer_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_initialize(
+     void )
+{
+	evtxtools_output_buffer_t *output_buffer = NULL;
+	libcerror_error_t *error                 = NULL;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = evtxtools_output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          EVTXTOOLS_OUTPUT_BUFFER_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "output_buffer",
+	 output_buffer );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = evtxtools_output_buffer_initialize(
+	          NULL,
+	          stdout,
+	          EVTXTOOLS_OUTPUT_BUFFER_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer = (evtxtools_output_buffer_t *) 0x12345678UL;
+
+	result = evtxtools_output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          EVTXTOOLS_OUTPUT_BUFFER_SIZE,
+	          &error );
+
+	output_buffer = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_output_buffer_initialize(
+	          &output_buffer,
+	          NULL,
+	          EVTXTOOLS_OUTPUT_BUFFER_SIZE,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_output_buffer_initialize(
+	          &output_buffer,
+	          stdout,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		evtxtools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the evtxtools_output_buffer_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = evtxtools_output_buffer_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the evtxtools_output_buffer_append functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_output_buffer_append(
+     void )
+{
+	char expected_string[ 128 ];
+	char output_string[ 128 ];
+
+	evtxtools_output_buffer_t *output_buffer = NULL;
+	libcerror_error_t *error                 = NULL;
+	FILE *stream                             = NULL;
+	size_t read_count                        = 0;
+	int expected_length                      = 0;
+	int result                               = 0;
+
+	stream = tmpfile();
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "stream",
+	 stream );
+
+	/* Use a small buffer to make sure appending flushes
+	 */
+	result = evtxtools_output_buffer_initialize(
+	          &output_buffer,
+	          stream,
+	          64,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = evtxtools_output_buffer_append_ascii_string(
+	          output_buffer,
+	          "Event identifier\t\t: ",
+	          20,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_hexadecimal(
+	          output_buffer,
+	          0x0000abcdUL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( " (" ),
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_decimal(
+	          output_buffer,
+	          43981,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_string(
+	          output_buffer,
+	          _SYSTEM_STRING( ")\nEvent number\t\t\t: " ),
+	          19,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_decimal(
+	          output_buffer,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_append_decimal(
+	          output_buffer,
+	          (uint64_t) 0xffffffffffffffffULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_output_buffer_flush(
+	          output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_length = snprintf(
+	                   expected_string,
+	                   128,
+	                   "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\nEvent number\t\t\t: %" PRIu64 "%" PRIu64 "",
+	                   (uint32_t) 0x0000abcdUL,
+	                   (uint32_t) 43981,
+	                   (uint64_t) 0,
+	                   (uint64_t) 0xffffffffffffffffULL );
+
+	rewind(
+	 stream );
+
+	read_count = fread(
+	              output_string,
+	              1,
+	              128,
+	              stream );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) expected_length );
+
+	result = memory_compare(
+	          output_string,
+	          expected_string,
+	          (size_t) expected_length );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = evtxtools_output_buffer_append_string(
+	          NULL,
+	          _SYSTEM_STRING( "test" ),
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_output_buffer_append_string(
+	          output_buffer,
+	          NULL,
+	          4,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_output_buffer_append_decimal(
+	          NULL,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_output_buffer_flush(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evtxtools_output_buffer_free(
+	          &output_buffer,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	fclose(
+	 stream );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer != NULL )
+	{
+		evtxtools_output_buffer_free(
+		 &output_buffer,
+		 NULL );
+	}
+	if( stream != NULL )
+	{
+		fclose(
+		 stream );
+	}
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -97,6 +578,18 @@ int main(
 
 	/* TODO add tests for evtxtools_output_version_detailed_fprint */
 
+	EVTX_TEST_RUN(
+	 "evtxtools_output_buffer_initialize",
+	 evtx_test_tools_output_buffer_initialize )
+
+	EVTX_TEST_RUN(
+	 "evtxtools_output_buffer_free",
+	 evtx_test_tools_output_buffer_free )
+
+	EVTX_TEST_RUN(
+	 "evtxtools_output_buffer_append",
+	 evtx_test_tools_output_buffer_append )
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <system_string.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -268,6 +269,270 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the path_handle_directory_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_directory_initialize(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	path_handle_directory_t *directory = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = path_handle_directory_initialize(
+	          &directory,
+	          _SYSTEM_STRING( "." ),
+	          1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "directory",
+	 directory );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = path_handle_directory_free(
+	          &directory,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "directory",
+	 directory );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = path_handle_directory_initialize(
+	          NULL,
+	          _SYSTEM_STRING( "." ),
+	          1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	directory = (path_handle_directory_t *) 0x12345678UL;
+
+	result = path_handle_directory_initialize(
+	          &directory,
+	          _SYSTEM_STRING( "." ),
+	          1,
+	          0,
+	          &error );
+
+	directory = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_handle_directory_initialize(
+	          &directory,
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = path_handle_directory_initialize(
+	          &directory,
+	          _SYSTEM_STRING( "." ),
+	          0,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( directory != NULL )
+	{
+		path_handle_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the path_handle_directory_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_directory_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = path_handle_directory_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the path_handle_get_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_get_name_hash(
+     void )
+{
+	uint32_t lower_case_hash = 0;
+	uint32_t upper_case_hash = 0;
+
+	/* Test regular cases
+	 */
+	lower_case_hash = path_handle_get_name_hash(
+	                   _SYSTEM_STRING( "wevtapi.dll" ),
+	                   11 );
+
+	upper_case_hash = path_handle_get_name_hash(
+	                   _SYSTEM_STRING( "WEVTAPI.DLL" ),
+	                   11 );
+
+	EVTX_TEST_ASSERT_EQUAL_UINT32(
+	 "upper_case_hash",
+	 upper_case_hash,
+	 lower_case_hash );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the path_handle_compare_name_no_case function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_path_handle_compare_name_no_case(
+     void )
+{
+	int result = 0;
+
+	/* Test regular cases
+	 */
+	result = path_handle_compare_name_no_case(
+	          _SYSTEM_STRING( "wevtapi.dll" ),
+	          _SYSTEM_STRING( "WEVTAPI.DLL" ),
+	          11 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = path_handle_compare_name_no_case(
+	          _SYSTEM_STRING( "wevtapi.dll" ),
+	          _SYSTEM_STRING( "WEVTAPI.DLX" ),
+	          11 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = path_handle_compare_name_no_case(
+	          NULL,
+	          _SYSTEM_STRING( "WEVTAPI.DLL" ),
+	          11 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
 /* The main program
  */
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
@@ -291,6 +556,22 @@ int main(
 	 "path_handle_free",
 	 evtx_test_tools_path_handle_free );
 
+	EVTX_TEST_RUN(
+	 "path_handle_get_name_hash",
+	 evtx_test_tools_path_handle_get_name_hash );
+
+	EVTX_TEST_RUN(
+	 "path_handle_compare_name_no_case",
+	 evtx_test_tools_path_handle_compare_name_no_case );
+
+	EVTX_TEST_RUN(
+	 "path_handle_directory_initialize",
+	 evtx_test_tools_path_handle_directory_initialize );
+
+	EVTX_TEST_RUN(
+	 "path_handle_directory_free",
+	 evtx_test_tools_path_handle_directory_free );
+
 	return( EXIT_SUCCESS );
 
 on_error:
@@ -0,0 +1,242 @@
+/*
+ * Tools prefetch functions test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/evtxtools_prefetch.h"
+
+/* Tests the evtxtools_prefetch_file function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_prefetch_file(
+     const system_character_t *filename )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = evtxtools_prefetch_file(
+	          filename,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A file that does not exist is not prefetched
+	 */
+	result = evtxtools_prefetch_file(
+	          _SYSTEM_STRING( "evtx_test_tools_prefetch.nonexistent" ),
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = evtxtools_prefetch_file(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the evtxtools_prefetch_files function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_prefetch_files(
+     const system_character_t *filename )
+{
+	system_character_t *filenames[ 2 ] = { NULL, NULL };
+	libcerror_error_t *error           = NULL;
+	int result                         = 0;
+
+	filenames[ 0 ] = (system_character_t *) _SYSTEM_STRING( "evtx_test_tools_prefetch.nonexistent" );
+	filenames[ 1 ] = (system_character_t *) filename;
+
+	/* Test regular cases
+	 */
+	result = evtxtools_prefetch_files(
+	          filenames,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Files that do not exist are not prefetched
+	 */
+	result = evtxtools_prefetch_files(
+	          filenames,
+	          1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evtxtools_prefetch_files(
+	          filenames,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = evtxtools_prefetch_files(
+	          NULL,
+	          2,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evtxtools_prefetch_files(
+	          filenames,
+	          -1,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+
+	/* The test program itself is used as the file to prefetch
+	 */
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "evtxtools_prefetch_file",
+	 evtx_test_tools_prefetch_file,
+	 argv[ 0 ] );
+
+	EVTX_TEST_RUN_WITH_ARGS(
+	 "evtxtools_prefetch_files",
+	 evtx_test_tools_prefetch_files,
+	 argv[ 0 ] );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
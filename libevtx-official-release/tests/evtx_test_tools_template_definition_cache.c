@@ -0,0 +1,594 @@
+/*
+ * Tools template_definition_cache type test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_memory.h"
+#include "evtx_test_unused.h"
+
+#include "../evtxtools/template_definition_cache.h"
+
+/* Tests the template_definition_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	template_definition_cache_t *template_definition_cache = NULL;
+	int result                                             = 0;
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+	int number_of_malloc_fail_tests                        = 1;
+	int number_of_memset_fail_tests                        = 1;
+	int test_number                                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_free(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_initialize(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	template_definition_cache = (template_definition_cache_t *) 0x12345678UL;
+
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	template_definition_cache = NULL;
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVTX_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_initialize with malloc failing
+		 */
+		evtx_test_malloc_attempts_before_fail = test_number;
+
+		result = template_definition_cache_initialize(
+		          &template_definition_cache,
+		          &error );
+
+		if( evtx_test_malloc_attempts_before_fail != -1 )
+		{
+			evtx_test_malloc_attempts_before_fail = -1;
+
+			if( template_definition_cache != NULL )
+			{
+				template_definition_cache_free(
+				 &template_definition_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "template_definition_cache",
+			 template_definition_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test template_definition_cache_initialize with memset failing
+		 */
+		evtx_test_memset_attempts_before_fail = test_number;
+
+		result = template_definition_cache_initialize(
+		          &template_definition_cache,
+		          &error );
+
+		if( evtx_test_memset_attempts_before_fail != -1 )
+		{
+			evtx_test_memset_attempts_before_fail = -1;
+
+			if( template_definition_cache != NULL )
+			{
+				template_definition_cache_free(
+				 &template_definition_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVTX_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVTX_TEST_ASSERT_IS_NULL(
+			 "template_definition_cache",
+			 template_definition_cache );
+
+			EVTX_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVTX_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition_cache != NULL )
+	{
+		template_definition_cache_free(
+		 &template_definition_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_free(
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the template_definition_cache_get_template_definition and template_definition_cache_set_template_definition functions
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_tools_template_definition_cache_get_and_set_template_definition(
+     void )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0x7f, 0x2f, 0x0a, 0x55, 0x0b, 0x1b, 0x48, 0x40, 0x83, 0xd5, 0x6d, 0x71, 0x0a, 0x45, 0xd5, 0xb3 };
+
+	libcerror_error_t *error                                  = NULL;
+	libevtx_template_definition_t *cached_template_definition = NULL;
+	libevtx_template_definition_t *template_definition        = NULL;
+	template_definition_cache_t *template_definition_cache    = NULL;
+	int result                                                = 0;
+
+	/* Initialize test
+	 */
+	result = template_definition_cache_initialize(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_template_definition_initialize(
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          &cached_template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_set_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_template_definition = template_definition;
+	template_definition        = NULL;
+
+	result = template_definition_cache_set_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "template_definition",
+	 (int) ( template_definition == cached_template_definition ),
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	template_definition = (libevtx_template_definition_t *) 0x12345678UL;
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition",
+	 template_definition );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = template_definition_cache_set_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4625,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_template_definition(
+	          NULL,
+	          provider_identifier,
+	          16,
+	          4624,
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          NULL,
+	          16,
+	          4624,
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          8,
+	          4624,
+	          &template_definition,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = template_definition_cache_get_template_definition(
+	          template_definition_cache,
+	          provider_identifier,
+	          16,
+	          4624,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = template_definition_cache_free(
+	          &template_definition_cache,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "template_definition_cache",
+	 template_definition_cache );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition_cache != NULL )
+	{
+		template_definition_cache_free(
+		 &template_definition_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_initialize",
+	 evtx_test_tools_template_definition_cache_initialize );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_free",
+	 evtx_test_tools_template_definition_cache_free );
+
+	EVTX_TEST_RUN(
+	 "template_definition_cache_get_and_set_template_definition",
+	 evtx_test_tools_template_definition_cache_get_and_set_template_definition );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
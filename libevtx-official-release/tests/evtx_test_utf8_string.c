@@ -0,0 +1,703 @@
+/*
+ * Library UTF-8 string functions test program
+ *
+ * Copyright (C) 2011-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evtx_test_libcerror.h"
+#include "evtx_test_libevtx.h"
+#include "evtx_test_macros.h"
+#include "evtx_test_unused.h"
+
+#include "../libevtx/libevtx_utf8_string.h"
+
+/* "Security-Auditing: " followed by U+00E9, U+20AC, U+1F600 and "Auditing events"
+ * without an end-of-string character
+ */
+uint8_t evtx_test_utf8_string_utf16_stream1[ 76 ] = {
+	'S', 0, 'e', 0, 'c', 0, 'u', 0, 'r', 0, 'i', 0, 't', 0, 'y', 0,
+	'-', 0, 'A', 0, 'u', 0, 'd', 0, 'i', 0, 't', 0, 'i', 0, 'n', 0,
+	'g', 0, ':', 0, ' ', 0, 0xe9, 0x00, 0xac, 0x20, 0x3d, 0xd8, 0x00, 0xde,
+	'A', 0, 'u', 0, 'd', 0, 'i', 0, 't', 0, 'i', 0, 'n', 0, 'g', 0,
+	' ', 0, 'e', 0, 'v', 0, 'e', 0, 'n', 0, 't', 0, 's', 0 };
+
+uint8_t evtx_test_utf8_string1[ 44 ] = {
+	'S', 'e', 'c', 'u', 'r', 'i', 't', 'y', '-', 'A', 'u', 'd', 'i', 't', 'i', 'n',
+	'g', ':', ' ', 0xc3, 0xa9, 0xe2, 0x82, 0xac, 0xf0, 0x9f, 0x98, 0x80,
+	'A', 'u', 'd', 'i', 't', 'i', 'n', 'g', ' ', 'e', 'v', 'e', 'n', 't', 's', 0 };
+
+/* A byte order mark followed by "ABCDEFGHIJ", an end-of-string character and "KLMNOPQRS"
+ */
+uint8_t evtx_test_utf8_string_utf16_stream2[ 42 ] = {
+	0xff, 0xfe, 'A', 0, 'B', 0, 'C', 0, 'D', 0, 'E', 0, 'F', 0, 'G', 0,
+	'H', 0, 'I', 0, 'J', 0, 0, 0, 'K', 0, 'L', 0, 'M', 0, 'N', 0,
+	'O', 0, 'P', 0, 'Q', 0, 'R', 0, 'S', 0 };
+
+uint8_t evtx_test_utf8_string2[ 11 ] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+/* Tests the libevtx_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 44 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream2,
+	          42,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 11 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream1,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 0 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          76,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream1,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream1,
+	          77,
+	          &utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_size_from_utf16_stream(
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_utf8_string_copy_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf8_string_copy_from_utf16_stream(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          44,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          evtx_test_utf8_string1,
+	          44 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          64,
+	          evtx_test_utf8_string_utf16_stream2,
+	          42,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          evtx_test_utf8_string2,
+	          11 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          NULL,
+	          44,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          44,
+	          NULL,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          44,
+	          evtx_test_utf8_string_utf16_stream1,
+	          0,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small for the end-of-string character
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          43,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small for the 3-byte character
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream(
+	          utf8_string,
+	          23,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevtx_utf8_string_copy_from_utf16_stream_with_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evtx_test_utf8_string_copy_from_utf16_stream_with_size(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error         = NULL;
+	size_t required_utf8_string_size = 0;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          64,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "required_utf8_string_size",
+	 required_utf8_string_size,
+	 (size_t) 44 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          evtx_test_utf8_string1,
+	          44 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          64,
+	          evtx_test_utf8_string_utf16_stream2,
+	          42,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "required_utf8_string_size",
+	 required_utf8_string_size,
+	 (size_t) 11 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          evtx_test_utf8_string2,
+	          11 );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          23,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "required_utf8_string_size",
+	 required_utf8_string_size,
+	 (size_t) 44 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          NULL,
+	          0,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVTX_TEST_ASSERT_EQUAL_SIZE(
+	 "required_utf8_string_size",
+	 required_utf8_string_size,
+	 (size_t) 44 );
+
+	EVTX_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          NULL,
+	          64,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          64,
+	          NULL,
+	          76,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          64,
+	          evtx_test_utf8_string_utf16_stream1,
+	          0,
+	          &required_utf8_string_size,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevtx_utf8_string_copy_from_utf16_stream_with_size(
+	          utf8_string,
+	          64,
+	          evtx_test_utf8_string_utf16_stream1,
+	          76,
+	          NULL,
+	          &error );
+
+	EVTX_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVTX_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVTX_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVTX_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVTX_TEST_UNREFERENCED_PARAMETER( argc )
+	EVTX_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf8_string_size_from_utf16_stream",
+	 evtx_test_utf8_string_size_from_utf16_stream );
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf8_string_copy_from_utf16_stream",
+	 evtx_test_utf8_string_copy_from_utf16_stream );
+
+	EVTX_TEST_RUN(
+	 "libevtx_utf8_string_copy_from_utf16_stream_with_size",
+	 evtx_test_utf8_string_copy_from_utf16_stream_with_size );
+
+	/* TODO: add tests for libevtx_utf8_string_size_from_value */
+
+	/* TODO: add tests for libevtx_utf8_string_copy_from_value */
+
+	/* TODO: add tests for libevtx_utf8_string_copy_from_value_with_size */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVTX_DLL_IMPORT ) */
+}
+
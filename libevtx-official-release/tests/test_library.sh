@@ -7,8 +7,8 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="chunk chunks_table error io_handle notify record record_values template_definition";
-LIBRARY_TESTS_WITH_INPUT="file support";
+LIBRARY_TESTS="chunk chunk_read_ahead chunk_signature chunks_table error io_handle notify read_buffer record record_decoder record_signature record_values records_cache records_index string_table template_definition utf8_string";
+LIBRARY_TESTS_WITH_INPUT="file merge support";
 OPTION_SETS="";
 
 INPUT_GLOB="*";
@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="info_handle message_handle message_string output path_handle registry_file resource_file signal";
+TOOLS_TESTS="checkpoint_file filetime info_handle input_list manifest_index message_handle message_string output path_handle prefetch registry_file resource_file signal template_definition_cache";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 